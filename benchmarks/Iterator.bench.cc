@@ -0,0 +1,108 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Iterator.h>
+#include <violet/Iterator/Filter.h>
+#include <violet/Iterator/Map.h>
+#include <violet/Iterator/Skip.h>
+#include <violet/Iterator/Take.h>
+
+#include <numeric>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet;
+
+namespace {
+
+auto makeInput(UInt size) -> Vec<Int32>
+{
+    Vec<Int32> data(size);
+    std::iota(data.begin(), data.end(), 0);
+
+    return data;
+}
+
+void BM_HandWrittenLoop(benchmark::State& state)
+{
+    auto data = makeInput(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        Int64 sum = 0;
+        for (Int32 x: data) {
+            if (x % 2 == 0) {
+                sum += static_cast<Int64>(x) * 3;
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MapFilterFold(benchmark::State& state)
+{
+    auto data = makeInput(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        auto sum = MkIterable(data)
+                       .Filter([](Int32 x) -> bool { return x % 2 == 0; })
+                       .Map([](Int32 x) -> Int64 { return static_cast<Int64>(x) * 3; })
+                       .Fold(Int64{ 0 }, [](const Int64& acc, Int64 x) -> Int64 { return acc + x; });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SkipTakeCount(benchmark::State& state)
+{
+    auto data = makeInput(static_cast<UInt>(state.range(0)));
+    auto half = static_cast<UInt>(state.range(0) / 2);
+
+    for (auto _: state) {
+        auto count = MkIterable(data).Skip(half / 2).Take(half).Count();
+        benchmark::DoNotOptimize(count);
+    }
+
+    // report the items that were taken, not the whole input
+    state.SetItemsProcessed(state.iterations() * static_cast<Int64>(half));
+}
+
+void BM_Collect(benchmark::State& state)
+{
+    auto data = makeInput(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        auto out = MkIterable(data).Map([](Int32 x) -> Int32 { return x + 1; }).Collect<Vec<Int32>>();
+        benchmark::DoNotOptimize(out);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_HandWrittenLoop)->Range(64, 1 << 16);
+BENCHMARK(BM_MapFilterFold)->Range(64, 1 << 16);
+BENCHMARK(BM_SkipTakeCount)->Range(64, 1 << 16);
+BENCHMARK(BM_Collect)->Range(64, 1 << 16);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -0,0 +1,88 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Container/Optional.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet;
+
+namespace {
+
+void BM_OptionalConstructTrivial(benchmark::State& state)
+{
+    Int32 value = 42;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(value);
+
+        Optional<Int32> opt = value;
+        benchmark::DoNotOptimize(opt);
+    }
+}
+
+void BM_OptionalConstructString(benchmark::State& state)
+{
+    const String value(static_cast<UInt>(state.range(0)), 'x');
+    for (auto _: state) {
+        Optional<String> opt = value;
+        benchmark::DoNotOptimize(opt);
+    }
+}
+
+void BM_OptionalMoveString(benchmark::State& state)
+{
+    const String value(static_cast<UInt>(state.range(0)), 'x');
+    for (auto _: state) {
+        Optional<String> opt = value;
+        Optional<String> moved = VIOLET_MOVE(opt);
+
+        benchmark::DoNotOptimize(moved);
+    }
+}
+
+void BM_OptionalNothing(benchmark::State& state)
+{
+    for (auto _: state) {
+        Optional<String> opt = Nothing;
+        benchmark::DoNotOptimize(opt);
+    }
+}
+
+void BM_OptionalMapChain(benchmark::State& state)
+{
+    Int32 value = 21;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(value);
+
+        auto res = Optional<Int32>(value).Map([](Int32 x) -> Int32 { return x * 2; }).UnwrapOr(0);
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_OptionalConstructTrivial);
+BENCHMARK(BM_OptionalConstructString)->Arg(8)->Arg(64)->Arg(1024);
+BENCHMARK(BM_OptionalMoveString)->Arg(8)->Arg(64)->Arg(1024);
+BENCHMARK(BM_OptionalNothing);
+BENCHMARK(BM_OptionalMapChain);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -0,0 +1,180 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Container/Result.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet;
+
+namespace {
+
+std::atomic<UInt64> g_allocations = 0;
+
+/// Reports how many heap allocations happened per iteration alongside the size of `R`.
+template<typename R>
+void reportAllocations(benchmark::State& state, UInt64 before)
+{
+    auto allocations = g_allocations.load(std::memory_order_relaxed) - before;
+    state.counters["allocs/iter"]
+        = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+
+    state.counters["sizeof"] = static_cast<double>(sizeof(R));
+}
+
+void BM_ResultConstructOk(benchmark::State& state)
+{
+    Int32 value = 42;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(value);
+
+        Result<Int32, String> res = value;
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+void BM_ResultConstructErr(benchmark::State& state)
+{
+    const String error(static_cast<UInt>(state.range(0)), 'e');
+    for (auto _: state) {
+        Result<Int32, String> res = Err<String>(error);
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+void BM_ResultMoveOk(benchmark::State& state)
+{
+    const String value(static_cast<UInt>(state.range(0)), 'x');
+    for (auto _: state) {
+        Result<String, Int32> res = value;
+        Result<String, Int32> moved = VIOLET_MOVE(res);
+
+        benchmark::DoNotOptimize(moved);
+    }
+}
+
+void BM_ResultVoidOk(benchmark::State& state)
+{
+    auto before = g_allocations.load(std::memory_order_relaxed);
+    for (auto _: state) {
+        Result<void, Int32> res;
+        benchmark::DoNotOptimize(res);
+    }
+
+    reportAllocations<Result<void, Int32>>(state, before);
+}
+
+void BM_ResultVoidErr(benchmark::State& state)
+{
+    Int32 code = 2;
+
+    auto before = g_allocations.load(std::memory_order_relaxed);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(code);
+
+        Result<void, Int32> res = Err<Int32>(code);
+        Result<void, Int32> moved = VIOLET_MOVE(res);
+
+        benchmark::DoNotOptimize(moved);
+    }
+
+    reportAllocations<Result<void, Int32>>(state, before);
+}
+
+/// Copies a failing `Result<void, E>` around, which used to allocate on every copy.
+void BM_ResultVoidErrCopy(benchmark::State& state)
+{
+    const Result<void, Int32> res = Err<Int32>(2);
+
+    auto before = g_allocations.load(std::memory_order_relaxed);
+    for (auto _: state) {
+        Result<void, Int32> copy = res;
+        benchmark::DoNotOptimize(copy);
+    }
+
+    reportAllocations<Result<void, Int32>>(state, before);
+}
+
+auto propagate(Int32 value) -> Result<Int32, Int32>
+{
+    if (value < 0) {
+        return Err<Int32>(value);
+    }
+
+    return value + 1;
+}
+
+auto chain(Int32 value) -> Result<Int32, Int32>
+{
+    auto first = VIOLET_TRY(propagate(value));
+    auto second = VIOLET_TRY(propagate(first));
+
+    return propagate(second);
+}
+
+void BM_ResultTryChain(benchmark::State& state)
+{
+    auto value = static_cast<Int32>(state.range(0));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(value);
+
+        auto res = chain(value);
+        benchmark::DoNotOptimize(res);
+    }
+}
+
+} // namespace
+
+// Count every global allocation so the `allocs/iter` counter can prove that a path
+// stays on the stack.
+auto operator new(std::size_t size) -> void*
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+BENCHMARK(BM_ResultConstructOk);
+BENCHMARK(BM_ResultConstructErr)->Arg(8)->Arg(64)->Arg(1024);
+BENCHMARK(BM_ResultMoveOk)->Arg(8)->Arg(64)->Arg(1024);
+BENCHMARK(BM_ResultVoidOk);
+BENCHMARK(BM_ResultVoidErr);
+BENCHMARK(BM_ResultVoidErrCopy);
+BENCHMARK(BM_ResultTryChain)->Arg(1)->Arg(-1);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -0,0 +1,77 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Events/EventEmitter.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet::events;
+using namespace violet;
+
+namespace {
+
+/// Fires one event to `state.range(0)` persistent listeners.
+void BM_EmitterFire(benchmark::State& state)
+{
+    Emitter<UInt32> emitter;
+    Event<UInt32> event = emitter.Event();
+
+    UInt64 sink = 0;
+    Vec<Emitter<UInt32>::Guard> guards;
+    guards.reserve(static_cast<UInt>(state.range(0)));
+
+    for (Int64 i = 0; i < state.range(0); i++) {
+        guards.push_back(event([&sink](UInt32 value) -> void { sink += value; }));
+    }
+
+    for (auto _: state) {
+        emitter.Fire(1);
+    }
+
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Subscribes and immediately disposes a listener while `state.range(0)` others stay registered.
+void BM_EmitterSubscribeDispose(benchmark::State& state)
+{
+    Emitter<UInt32> emitter;
+    Event<UInt32> event = emitter.Event();
+
+    Vec<Emitter<UInt32>::Guard> guards;
+    guards.reserve(static_cast<UInt>(state.range(0)));
+
+    for (Int64 i = 0; i < state.range(0); i++) {
+        guards.push_back(event([](UInt32) -> void { }));
+    }
+
+    for (auto _: state) {
+        auto guard = event([](UInt32) -> void { });
+        benchmark::DoNotOptimize(guard.ID());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_EmitterFire)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_EmitterSubscribeDispose)->RangeMultiplier(4)->Range(1, 1024);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
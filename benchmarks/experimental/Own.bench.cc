@@ -0,0 +1,87 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Experimental/Own.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet::experimental;
+using namespace violet;
+
+namespace {
+
+void BM_OwnNewDrop(benchmark::State& state)
+{
+    for (auto _: state) {
+        auto owned = Own<Int64>::New(42);
+        benchmark::DoNotOptimize(owned);
+    }
+}
+
+void BM_OwnClone(benchmark::State& state)
+{
+    auto owned = Own<Int64>::New(42);
+    for (auto _: state) {
+        Own<Int64> clone = owned; // NOLINT(performance-unnecessary-copy-initialization)
+        benchmark::DoNotOptimize(clone);
+    }
+}
+
+void BM_OwnMove(benchmark::State& state)
+{
+    auto owned = Own<Int64>::New(42);
+    for (auto _: state) {
+        Own<Int64> moved = VIOLET_MOVE(owned);
+        benchmark::DoNotOptimize(moved);
+
+        owned = VIOLET_MOVE(moved);
+    }
+}
+
+void BM_SharedPtrClone(benchmark::State& state)
+{
+    auto shared = std::make_shared<Int64>(42);
+    for (auto _: state) {
+        SharedPtr<Int64> clone = shared; // NOLINT(performance-unnecessary-copy-initialization)
+        benchmark::DoNotOptimize(clone);
+    }
+}
+
+/// Every thread clones and drops the same `Own<T>`, which measures contention on the
+/// shared reference count.
+void BM_OwnCloneContended(benchmark::State& state)
+{
+    static Own<Int64> shared = Own<Int64>::New(42);
+    for (auto _: state) {
+        Own<Int64> clone = shared; // NOLINT(performance-unnecessary-copy-initialization)
+        benchmark::DoNotOptimize(clone);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_OwnNewDrop);
+BENCHMARK(BM_OwnClone);
+BENCHMARK(BM_OwnMove);
+BENCHMARK(BM_SharedPtrClone);
+BENCHMARK(BM_OwnCloneContended)->ThreadRange(1, 8)->UseRealTime();
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -0,0 +1,80 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Experimental/Synchronization/ReadWriteLock.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet::experimental::sync;
+using namespace violet;
+
+namespace {
+
+/// Readers only: measures how well `Read()` scales as threads are added.
+void BM_ReadWriteLockReaders(benchmark::State& state)
+{
+    static ReadWriteLock<Vec<Int64>> lock(Vec<Int64>(64, 1));
+    for (auto _: state) {
+        auto guard = lock.Read();
+        benchmark::DoNotOptimize(guard->front());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Thread 0 writes, every other thread reads.
+void BM_ReadWriteLockMixed(benchmark::State& state)
+{
+    static ReadWriteLock<Vec<Int64>> lock(Vec<Int64>(64, 1));
+    for (auto _: state) {
+        if (state.thread_index() == 0) {
+            auto guard = lock.Write();
+            guard->front()++;
+        } else {
+            auto guard = lock.Read();
+            benchmark::DoNotOptimize(guard->front());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Baseline: an uncontended `std::mutex` lock/unlock pair.
+void BM_MutexBaseline(benchmark::State& state)
+{
+    static Mutex mux;
+    static Int64 value = 0;
+
+    for (auto _: state) {
+        std::scoped_lock lk(mux);
+        benchmark::DoNotOptimize(++value);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_ReadWriteLockReaders)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_ReadWriteLockMixed)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(BM_MutexBaseline)->ThreadRange(1, 16)->UseRealTime();
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
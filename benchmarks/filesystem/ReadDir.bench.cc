@@ -0,0 +1,145 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <benchmark/benchmark.h>
+#include <violet/Filesystem.h>
+#include <violet/Filesystem/Temporary.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <map>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet::filesystem;
+using namespace violet;
+
+namespace {
+
+/// Returns a scratch directory holding `count` empty files, creating it on first use. The directories
+/// are kept around for the whole run since populating the 1M-entry one dominates everything else.
+auto populated(UInt count) -> const Path&
+{
+    static std::map<UInt, TempDir> dirs;
+    if (auto it = dirs.find(count); it != dirs.end()) {
+        return it->second.Path();
+    }
+
+    auto dir = TempBuilder().WithPrefix("violet-readdir-").MkDir().Unwrap();
+    auto fd = dir.Path().WithCStr(
+        [](CStr path) -> Int32 { return ::open(path, O_DIRECTORY | O_RDONLY | O_CLOEXEC); });
+    for (UInt i = 0; i < count; i++) {
+        auto name = violet::ToString(i);
+        ::close(::openat(fd, name.c_str(), O_CREAT | O_WRONLY | O_CLOEXEC, 0644));
+    }
+
+    ::close(fd);
+    return dirs.emplace(count, VIOLET_MOVE(dir)).first->second.Path();
+}
+
+/// Iterates the directory through [`Dirs`], which reads it with `getdents64(2)` on Linux.
+void BM_ReadDir(benchmark::State& state)
+{
+    const auto& path = populated(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        auto dirs = ReadDir(path);
+        if (dirs.Err()) {
+            state.SkipWithError(dirs.Error().ToString());
+            break;
+        }
+
+        UInt total = 0;
+        for (auto entry: *dirs) {
+            benchmark::DoNotOptimize(entry->Name().data());
+            total++;
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Same as `BM_ReadDir`, but also builds every entry's full [`Path`].
+void BM_ReadDirWithPaths(benchmark::State& state)
+{
+    const auto& path = populated(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        auto dirs = ReadDir(path);
+        if (dirs.Err()) {
+            state.SkipWithError(dirs.Error().ToString());
+            break;
+        }
+
+        for (auto entry: *dirs) {
+            auto full = entry->Path();
+            benchmark::DoNotOptimize(full);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Baseline: a plain libc `opendir(3)`/`readdir(3)` loop over the same directory.
+void BM_ReadDirLibc(benchmark::State& state)
+{
+    const auto& path = populated(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        DIR* dir = path.WithCStr([](CStr path) -> DIR* { return ::opendir(path); });
+        if (dir == nullptr) {
+            state.SkipWithError("opendir failed");
+            break;
+        }
+
+        UInt total = 0;
+        while (const struct dirent* ent = ::readdir(dir)) {
+            benchmark::DoNotOptimize(ent->d_name);
+            total++;
+        }
+
+        ::closedir(dir);
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_ReadDir)
+    ->ArgName("entries")
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_ReadDirWithPaths)
+    ->ArgName("entries")
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_ReadDirLibc)
+    ->ArgName("entries")
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -0,0 +1,95 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/IO/Experimental/BufferedInputStream.h>
+#include <violet/IO/Experimental/Input/ByteArrayInputStream.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet::io::experimental;
+using namespace violet;
+
+namespace {
+
+constexpr UInt kPayloadSize = 4 * 1024 * 1024;
+
+auto payload() -> const Vec<UInt8>&
+{
+    static const Vec<UInt8> data(kPayloadSize, 0xAB);
+    return data;
+}
+
+/// Reads the whole payload through a [`BufferedInputStream`] using a caller buffer of
+/// `state.range(0)` bytes and an internal buffer of `state.range(1)` bytes.
+void BM_BufferedInputStreamRead(benchmark::State& state)
+{
+    Vec<UInt8> chunk(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        BufferedInputStream stream(ByteArrayInputStream(payload()), static_cast<UInt>(state.range(1)));
+
+        UInt total = 0;
+        while (true) {
+            auto read = stream.Read(chunk);
+            if (read.Err() || read.Value() == 0) {
+                break;
+            }
+
+            total += read.Value();
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(kPayloadSize));
+}
+
+/// Baseline: the same read loop directly against the unbuffered source.
+void BM_ByteArrayInputStreamRead(benchmark::State& state)
+{
+    Vec<UInt8> chunk(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        ByteArrayInputStream stream(payload());
+
+        UInt total = 0;
+        while (true) {
+            auto read = stream.Read(chunk);
+            if (read.Err() || read.Value() == 0) {
+                break;
+            }
+
+            total += read.Value();
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(kPayloadSize));
+}
+
+} // namespace
+
+BENCHMARK(BM_BufferedInputStreamRead)
+    ->ArgNames({ "chunk", "buffer" })
+    ->ArgsProduct({ { 16, 512, 64 * 1024 }, { 8192, 64 * 1024 } });
+
+BENCHMARK(BM_ByteArrayInputStreamRead)->ArgName("chunk")->Arg(16)->Arg(512)->Arg(64 * 1024);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -0,0 +1,88 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/IO/Experimental/BufferedOutputStream.h>
+#include <violet/IO/Experimental/Output/ByteArrayOutputStream.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet::io::experimental;
+using namespace violet;
+
+namespace {
+
+constexpr UInt kPayloadSize = 4 * 1024 * 1024;
+
+/// An output stream that discards everything, so only the buffering layer is measured.
+struct NullOutputStream final: public OutputStream {
+    auto Write(Span<const UInt8> data) noexcept -> io::Result<UInt> override
+    {
+        benchmark::DoNotOptimize(data.data());
+        return data.size();
+    }
+};
+
+/// Writes the payload through a [`BufferedOutputStream`] in chunks of `state.range(0)` bytes
+/// with an internal capacity of `state.range(1)` bytes.
+void BM_BufferedOutputStreamWrite(benchmark::State& state)
+{
+    const Vec<UInt8> chunk(static_cast<UInt>(state.range(0)), 0xCD);
+    for (auto _: state) {
+        BufferedOutputStream stream(NullOutputStream{ }, static_cast<UInt>(state.range(1)));
+        for (UInt written = 0; written < kPayloadSize; written += chunk.size()) {
+            auto res = stream.Write(chunk);
+            benchmark::DoNotOptimize(res);
+        }
+
+        auto res = stream.Flush();
+        benchmark::DoNotOptimize(res);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(kPayloadSize));
+}
+
+/// Same as `BM_BufferedOutputStreamWrite` but drains into a growing [`ByteArrayOutputStream`].
+void BM_BufferedOutputStreamToByteArray(benchmark::State& state)
+{
+    const Vec<UInt8> chunk(static_cast<UInt>(state.range(0)), 0xCD);
+    for (auto _: state) {
+        BufferedOutputStream stream(ByteArrayOutputStream{ }, 8192);
+        for (UInt written = 0; written < kPayloadSize; written += chunk.size()) {
+            auto res = stream.Write(chunk);
+            benchmark::DoNotOptimize(res);
+        }
+
+        auto res = stream.Flush();
+        benchmark::DoNotOptimize(res);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(kPayloadSize));
+}
+
+} // namespace
+
+BENCHMARK(BM_BufferedOutputStreamWrite)
+    ->ArgNames({ "chunk", "capacity" })
+    ->ArgsProduct({ { 16, 512, 64 * 1024 }, { 8192, 64 * 1024 } });
+
+BENCHMARK(BM_BufferedOutputStreamToByteArray)->ArgName("chunk")->Arg(16)->Arg(512)->Arg(64 * 1024);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
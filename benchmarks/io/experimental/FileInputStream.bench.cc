@@ -0,0 +1,118 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <benchmark/benchmark.h>
+#include <violet/Filesystem/Temporary.h>
+#include <violet/IO/Experimental/BufferedInputStream.h>
+#include <violet/IO/Experimental/Input/FileInputStream.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet::io::experimental;
+using namespace violet::filesystem;
+using namespace violet;
+
+namespace {
+
+constexpr UInt kFileSize = 64 * 1024 * 1024;
+
+/// Returns a scratch file of `kFileSize` bytes, creating it on first use.
+auto scratch() -> const Path&
+{
+    static const TempDir dir = TempBuilder().WithPrefix("violet-fileinput-").MkDir().Unwrap();
+    static const Path path = []() -> Path {
+        auto path = dir.Path().Join("payload.bin");
+        auto file = OpenOptions{ }.CreateNew().Write().Open(path).Unwrap();
+
+        const Vec<UInt8> chunk(1024 * 1024, 0xAB);
+        for (UInt written = 0; written < kFileSize; written += chunk.size()) {
+            (void)file.Write(chunk);
+        }
+
+        return path;
+    }();
+
+    return path;
+}
+
+/// Baseline: `read(2)` straight into a caller buffer of `state.range(0)` bytes.
+void BM_RawRead(benchmark::State& state)
+{
+    Vec<UInt8> chunk(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        auto fd = scratch().WithCStr([](CStr path) -> Int32 { return ::open(path, O_RDONLY | O_CLOEXEC); });
+
+        UInt total = 0;
+        while (true) {
+            auto bytes = ::read(fd, chunk.data(), chunk.size());
+            if (bytes <= 0) {
+                break;
+            }
+
+            total += static_cast<UInt>(bytes);
+        }
+
+        ::close(fd);
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(kFileSize));
+}
+
+/// Reads the scratch file through a [`BufferedInputStream`] over a [`FileInputStream`] using a
+/// caller buffer of `state.range(0)` bytes.
+void BM_BufferedFileInputStreamRead(benchmark::State& state)
+{
+    Vec<UInt8> chunk(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        auto file = FileInputStream::Open(scratch());
+        if (file.Err()) {
+            state.SkipWithError(file.Error().ToString());
+            break;
+        }
+
+        BufferedInputStream stream(VIOLET_MOVE(file.Value()));
+
+        UInt total = 0;
+        while (true) {
+            auto read = stream.Read(chunk);
+            if (read.Err() || read.Value() == 0) {
+                break;
+            }
+
+            total += read.Value();
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(kFileSize));
+}
+
+} // namespace
+
+BENCHMARK(BM_RawRead)->ArgName("chunk")->Arg(512)->Arg(64 * 1024)->Arg(1024 * 1024);
+BENCHMARK(BM_BufferedFileInputStreamRead)->ArgName("chunk")->Arg(512)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -0,0 +1,108 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Strings.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet;
+
+namespace {
+
+auto makeCsv(UInt fields) -> String
+{
+    String out;
+    out.reserve(fields * 8);
+
+    for (UInt i = 0; i < fields; i++) {
+        if (i != 0) {
+            out.push_back(',');
+        }
+
+        out.append("field");
+        out.append(violet::ToString(i % 100));
+    }
+
+    return out;
+}
+
+auto makeLines(UInt lines) -> String
+{
+    String out;
+    out.reserve(lines * 48);
+
+    for (UInt i = 0; i < lines; i++) {
+        out.append("2026-01-01T00:00:00Z INFO some log line ");
+        out.append(violet::ToString(i));
+        out.append(i % 4 == 0 ? "\r\n" : "\n");
+    }
+
+    return out;
+}
+
+void BM_Split(benchmark::State& state)
+{
+    auto input = makeCsv(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        UInt bytes = 0;
+        for (Str piece: strings::Split(input, ',')) {
+            bytes += piece.size();
+        }
+
+        benchmark::DoNotOptimize(bytes);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(input.size()));
+}
+
+void BM_SplitCount(benchmark::State& state)
+{
+    auto input = makeCsv(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        auto count = strings::Split(input, ',').Count();
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(input.size()));
+}
+
+void BM_Lines(benchmark::State& state)
+{
+    auto input = makeLines(static_cast<UInt>(state.range(0)));
+    for (auto _: state) {
+        UInt bytes = 0;
+        for (Str line: strings::Lines(input)) {
+            bytes += line.size();
+        }
+
+        benchmark::DoNotOptimize(bytes);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<Int64>(input.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_Split)->Range(16, 1 << 14);
+BENCHMARK(BM_SplitCount)->Range(16, 1 << 14);
+BENCHMARK(BM_Lines)->Range(16, 1 << 14);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
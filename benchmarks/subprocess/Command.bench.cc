@@ -0,0 +1,126 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <violet/Subprocess.h>
+#include <violet/Subprocess/PreparedCommand.h>
+
+// NOLINTBEGIN(google-build-using-namespace,readability-identifier-length)
+using namespace violet::subprocess;
+using namespace violet;
+
+namespace {
+
+/// End-to-end latency of spawning `true`, waiting on it and collecting (empty) output.
+void BM_CommandOutputTrue(benchmark::State& state)
+{
+    for (auto _: state) {
+        auto output = Command("true").Output();
+        if (output.Err()) {
+            state.SkipWithError(output.Error().ToString());
+            break;
+        }
+
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+/// Spawn latency plus draining `state.range(0)` bytes of stdout through `Command::Output`.
+void BM_CommandOutputCapture(benchmark::State& state)
+{
+    auto count = violet::ToString(state.range(0));
+    for (auto _: state) {
+        auto output = Command("head").WithArgs({ "-c", count, "/dev/zero" }).Output();
+        if (output.Err()) {
+            state.SkipWithError(output.Error().ToString());
+            break;
+        }
+
+        benchmark::DoNotOptimize(output->Stdout.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/// Spawn + wait only, without any piped streams.
+void BM_CommandStatus(benchmark::State& state)
+{
+    for (auto _: state) {
+        auto status = Command("true").WithStdout(Stdio::Null()).WithStderr(Stdio::Null()).Status();
+        if (status.Err()) {
+            state.SkipWithError(status.Error().ToString());
+            break;
+        }
+
+        benchmark::DoNotOptimize(status);
+    }
+}
+
+/// Spawn + wait from a parent holding `state.range(0)` MiB of touched heap, which is where
+/// copying the page tables on `fork` used to dominate.
+void BM_CommandStatusLargeParent(benchmark::State& state)
+{
+    Vec<UInt8> ballast(static_cast<UInt>(state.range(0)) << 20, 0xAB);
+    benchmark::DoNotOptimize(ballast.data());
+
+    for (auto _: state) {
+        auto status = Command("true").WithStdout(Stdio::Null()).WithStderr(Stdio::Null()).Status();
+        if (status.Err()) {
+            state.SkipWithError(status.Error().ToString());
+            break;
+        }
+
+        benchmark::DoNotOptimize(status);
+    }
+}
+
+/// Same as `BM_CommandStatus`, but spawning a [`PreparedCommand`] with one argument replaced each time.
+void BM_PreparedCommandStatus(benchmark::State& state)
+{
+    auto prepared = PreparedCommand::New(
+        Command("true").WithArg("<input>").WithStdout(Stdio::Null()).WithStderr(Stdio::Null()));
+
+    if (prepared.Err()) {
+        state.SkipWithError(prepared.Error().ToString());
+        return;
+    }
+
+    UInt64 input = 0;
+    for (auto _: state) {
+        auto status = prepared->WithArg(0, violet::ToString(input++)).Status();
+        if (status.Err()) {
+            state.SkipWithError(status.Error().ToString());
+            break;
+        }
+
+        benchmark::DoNotOptimize(status);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_CommandOutputTrue)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_CommandOutputCapture)->Unit(benchmark::kMicrosecond)->UseRealTime()->Range(1024, 16 << 20);
+BENCHMARK(BM_CommandStatus)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_PreparedCommandStatus)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_CommandStatusLargeParent)->Unit(benchmark::kMicrosecond)->UseRealTime()->Arg(64)->Arg(1024);
+
+// NOLINTEND(google-build-using-namespace,readability-identifier-length)
@@ -19,7 +19,7 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
 
-load("@rules_cc//cc:defs.bzl", "cc_library", "cc_test")
+load("@rules_cc//cc:defs.bzl", "cc_binary", "cc_library", "cc_test")
 load("//buildsystem/bazel:cc/defs.bzl", "sanitizer", other_copts = "copts", other_defines = "defines")
 load(":version.bzl", "DEVBUILD", "encode_as_int")
 
@@ -75,3 +75,17 @@ def violet_cc_runfile_test(name, deps = [], **kwargs):
         deps = deps + ["//violet/testing:runfiles", "//violet/testing:runfiles_main"],
         **kwargs
     )
+
+def violet_cc_benchmark(name, deps = [], copts = [], linkopts = [], with_benchmark_main = True, **kwargs):
+    if "visibility" in kwargs:
+        fail("`violet_cc_benchmark`(%s) defined `visibility` but all benchmarks are marked as private")
+
+    return cc_binary(
+        name = name,
+        deps = deps + ["@google_benchmark//:benchmark"] + (["@google_benchmark//:benchmark_main"] if with_benchmark_main else []),
+        copts = copts + sanitizer["copts"],
+        linkopts = linkopts + sanitizer["linkopts"],
+        visibility = ["//visibility:private"],
+        testonly = True,
+        **kwargs
+    )
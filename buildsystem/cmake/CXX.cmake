@@ -165,6 +165,35 @@ function(violet_cc_library TARGET)
     add_library(violet::${TARGET} ALIAS violet_${TARGET})
 endfunction()
 
+# --- Custom cc_binary mimic for Google Benchmark ---
+function(violet_cc_benchmark TARGET_NAME)
+    if(NOT VIOLET_ENABLE_BENCHMARKS)
+        return()
+    endif()
+
+    cmake_parse_arguments(
+        VCB
+        ""
+        ""
+        "SRCS;DEPS;COPTS;LINKOPTS"
+        ${ARGN}
+    )
+
+    # Not every framework has been migrated to CMake yet, so skip benchmarks
+    # whose dependencies don't exist rather than failing at configure time.
+    foreach(DEP ${VCB_DEPS})
+        if(NOT TARGET ${DEP})
+            message(STATUS "Skipping benchmark `${TARGET_NAME}`: target `${DEP}` is not available")
+            return()
+        endif()
+    endforeach()
+
+    add_executable(violet_${TARGET_NAME} ${VCB_SRCS})
+    target_compile_options(violet_${TARGET_NAME} PRIVATE ${VCB_COPTS} ${VIOLET_SANITIZER_COPTS})
+    target_link_options(violet_${TARGET_NAME} PRIVATE ${VCB_LINKOPTS} ${VIOLET_SANITIZER_LINKOPTS})
+    target_link_libraries(violet_${TARGET_NAME} PRIVATE ${VCB_DEPS} benchmark::benchmark benchmark::benchmark_main)
+endfunction()
+
 # # --- Custom cc_test mimic ---
 # function(violet_cc_test TARGET_NAME)
 #     if(NOT VIOLET_ENABLE_TESTS)
@@ -1817,69 +1817,80 @@ struct Result<void, E> final {
 
     /// Constructs the `Err` variant.
     constexpr VIOLET_IMPLICIT Result(const violet::Err<E>& err)
-        : n_value(new violet::Err<E>(err))
+        : n_ok(false)
     {
+        std::construct_at(std::addressof(this->n_storage.Error), err);
     }
 
     constexpr VIOLET_IMPLICIT Result(violet::Err<E>&& err) noexcept(std::is_nothrow_move_constructible_v<E>)
-        : n_value(new violet::Err<E>(VIOLET_MOVE(err)))
+        : n_ok(false)
     {
+        std::construct_at(std::addressof(this->n_storage.Error), VIOLET_MOVE(err));
     }
 
     template<typename U>
         requires(!std::same_as<std::decay_t<U>, Result<void, E>> && std::convertible_to<U, E>)
     constexpr VIOLET_IMPLICIT Result(const U& err)
-        : n_value(new violet::Err<E>(err))
+        : n_ok(false)
     {
+        std::construct_at(std::addressof(this->n_storage.Error), err);
     }
 
     template<typename U>
         requires(!std::same_as<std::decay_t<U>, Result<void, E>> && std::convertible_to<U, E>)
     constexpr VIOLET_IMPLICIT Result(U&& err)
-        : n_value(new violet::Err<E>(VIOLET_FWD(U, err)))
+        : n_ok(false)
     {
+        std::construct_at(std::addressof(this->n_storage.Error), VIOLET_FWD(U, err));
     }
 
     constexpr ~Result()
     {
-        if (this->n_value != nullptr) {
-            delete this->n_value;
-            this->n_value = nullptr;
-        }
+        this->destroy();
     }
 
     constexpr VIOLET_IMPLICIT Result(const Result& other)
+        : n_ok(other.n_ok)
     {
-        if (other.n_value != nullptr) {
-            this->n_value = new violet::Err<E>(*other.n_value);
+        if (!this->n_ok) {
+            std::construct_at(std::addressof(this->n_storage.Error), other.n_storage.Error);
         }
     }
 
-    constexpr auto operator=(const Result& other) noexcept -> Result&
+    constexpr auto operator=(const Result& other) -> Result&
     {
         if (this != &other) {
-            if (other.n_value != nullptr) {
-                this->n_value = new violet::Err<E>(*other.n_value);
+            this->destroy();
+            if (!other.n_ok) {
+                std::construct_at(std::addressof(this->n_storage.Error), other.n_storage.Error);
+                this->n_ok = false;
             }
         }
 
         return *this;
     }
 
-    constexpr VIOLET_IMPLICIT Result(Result&& other) noexcept
-        : n_value(std::exchange(other.n_value, nullptr))
+    constexpr VIOLET_IMPLICIT Result(Result&& other) noexcept(std::is_nothrow_move_constructible_v<E>)
+        : n_ok(other.n_ok)
     {
+        if (!this->n_ok) {
+            std::construct_at(std::addressof(this->n_storage.Error), VIOLET_MOVE(other.n_storage.Error));
+        }
     }
 
-    constexpr auto operator=(Result&& other) noexcept -> Result&
+    constexpr auto operator=(Result&& other) noexcept(std::is_nothrow_move_constructible_v<E>) -> Result&
     {
         if (this != &other) {
-            if (this->n_value != nullptr) {
-                delete this->n_value;
-                this->n_value = nullptr;
+            // If both are errors, move-assign; else destroy + reconstruct.
+            if (!this->n_ok && !other.n_ok) {
+                this->n_storage.Error = VIOLET_MOVE(other.n_storage.Error);
+            } else {
+                this->destroy();
+                if (!other.n_ok) {
+                    std::construct_at(std::addressof(this->n_storage.Error), VIOLET_MOVE(other.n_storage.Error));
+                    this->n_ok = false;
+                }
             }
-
-            this->n_value = std::exchange(other.n_value, nullptr);
         }
 
         return *this;
@@ -1891,7 +1902,8 @@ struct Result<void, E> final {
     constexpr VIOLET_IMPLICIT Result(const std::expected<void, E2>& other)
     {
         if (!other.has_value()) {
-            this->n_value = new violet::Err<E2>(other.error());
+            std::construct_at(std::addressof(this->n_storage.Error), violet::Err<E>(E(other.error())));
+            this->n_ok = false;
         }
     }
 
@@ -1900,14 +1912,17 @@ struct Result<void, E> final {
     constexpr VIOLET_IMPLICIT Result(std::expected<void, E2>&& other)
     {
         if (!other.has_value()) {
-            this->n_value = violet::Err<E2>(VIOLET_MOVE(other).error());
+            std::construct_at(std::addressof(this->n_storage.Error), violet::Err<E>(E(VIOLET_MOVE(other).error())));
+            this->n_ok = false;
         }
     }
 
     constexpr auto operator=(std::expected<void, E>& other) -> Result&
     {
+        this->destroy();
         if (!other.has_value()) {
-            this->n_value = new violet::Err<E>(other.error());
+            std::construct_at(std::addressof(this->n_storage.Error), violet::Err<E>(other.error()));
+            this->n_ok = false;
         }
 
         return *this;
@@ -1915,13 +1930,10 @@ struct Result<void, E> final {
 
     constexpr auto operator=(std::expected<void, E>&& other) -> Result&
     {
-        if (this->n_value != nullptr) {
-            delete this->n_value;
-            this->n_value = nullptr;
-        }
-
+        this->destroy();
         if (!other.has_value()) {
-            this->n_value = new violet::Err<E>(VIOLET_MOVE(other).error());
+            std::construct_at(std::addressof(this->n_storage.Error), violet::Err<E>(VIOLET_MOVE(other).error()));
+            this->n_ok = false;
         }
 
         return *this;
@@ -1931,37 +1943,37 @@ struct Result<void, E> final {
     /// Returns `true` if success.
     [[nodiscard]] constexpr auto Ok() const noexcept -> bool
     {
-        return this->n_value == nullptr;
+        return this->n_ok;
     }
 
     /// Returns `true` if failure.
     [[nodiscard]] constexpr auto Err() const noexcept -> bool
     {
-        return this->n_value != nullptr;
+        return !this->n_ok;
     }
 
     constexpr auto Error() & noexcept VIOLET_LIFETIMEBOUND -> E&
     {
         VIOLET_DEBUG_ASSERT(this->Err(), "`Result<void, E>` invariant reached");
-        return this->n_value->Error();
+        return this->getErrorRef();
     }
 
     constexpr auto Error() const& noexcept VIOLET_LIFETIMEBOUND -> const E&
     {
         VIOLET_DEBUG_ASSERT(this->Err(), "`Result<void, E>` invariant reached");
-        return this->n_value->Error();
+        return this->getErrorRef();
     }
 
     constexpr auto Error() && noexcept VIOLET_LIFETIMEBOUND -> E&&
     {
         VIOLET_DEBUG_ASSERT(this->Err(), "`Result<void, E>` invariant reached");
-        return VIOLET_MOVE(this->n_value->Error());
+        return VIOLET_MOVE(*this).getErrorRef();
     }
 
     constexpr auto Error() const&& noexcept -> const E&&
     {
         VIOLET_DEBUG_ASSERT(this->Err(), "`Result<void, E>` invariant reached");
-        return VIOLET_MOVE(this->n_value->Error());
+        return VIOLET_MOVE(*this).getErrorRef();
     }
 
     template<typename Fun>
@@ -1988,11 +2000,11 @@ struct Result<void, E> final {
     }
 
     template<typename Fun>
-        requires(callable<Fun> && callable_returns<Fun, void, const E&>)
+        requires(callable<Fun, const E&> && callable_returns<Fun, void, const E&>)
     constexpr auto InspectErr(Fun&& fun) noexcept(noexcept(std::invoke(VIOLET_FWD(Fun, fun), std::declval<E>())))
         -> Result&
     {
-        if (this->Ok()) {
+        if (this->Err()) {
             std::invoke(VIOLET_FWD(Fun, fun), Error());
         }
 
@@ -2002,7 +2014,7 @@ struct Result<void, E> final {
     constexpr auto IntoErr() && noexcept -> E
     {
         VIOLET_DEBUG_ASSERT(this->Err(), "`Result<void, E>` tried to consume an inexistent error");
-        return VIOLET_MOVE(this->n_value);
+        return VIOLET_MOVE(*this).getErrorRef();
     }
 
     template<typename Pred>
@@ -2053,7 +2065,61 @@ struct Result<void, E> final {
     }
 
 private:
-    violet::Err<E>* n_value = nullptr;
+    bool n_ok = true;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+    union storage_t {
+        char Empty = '\0'; ///< active while `Ok`, so that an `Ok` result is a constant expression
+        violet::Err<E> Error;
+
+        constexpr storage_t() noexcept { }
+        constexpr ~storage_t() { }
+    } n_storage;
+
+    constexpr void destroy() noexcept(std::is_nothrow_destructible_v<E>)
+    {
+        if (!this->n_ok) {
+            std::destroy_at(std::addressof(this->n_storage.Error));
+            this->n_storage.Empty = '\0';
+            this->n_ok = true;
+        }
+    }
+
+    constexpr auto getErrorRef() & noexcept -> error_type&
+    {
+        if VIOLET_IF_CONSTEVAL {
+            return this->n_storage.Error.Error();
+        } else {
+            return std::launder(std::addressof(this->n_storage.Error))->Error();
+        }
+    }
+
+    constexpr auto getErrorRef() const& noexcept -> const error_type&
+    {
+        if VIOLET_IF_CONSTEVAL {
+            return this->n_storage.Error.Error();
+        } else {
+            return std::launder(std::addressof(this->n_storage.Error))->Error();
+        }
+    }
+
+    constexpr auto getErrorRef() && noexcept -> error_type&&
+    {
+        if VIOLET_IF_CONSTEVAL {
+            return VIOLET_MOVE(this->n_storage.Error.Error());
+        } else {
+            return VIOLET_MOVE(std::launder(std::addressof(this->n_storage.Error))->Error());
+        }
+    }
+
+    constexpr auto getErrorRef() const&& noexcept -> const error_type&&
+    {
+        if VIOLET_IF_CONSTEVAL {
+            return VIOLET_MOVE(this->n_storage.Error.Error());
+        } else {
+            return VIOLET_MOVE(std::launder(std::addressof(this->n_storage.Error))->Error());
+        }
+    }
 };
 
 } // namespace violet
@@ -27,7 +27,9 @@
 
 #include <violet/Violet.h>
 
+#include <atomic>
 #include <functional>
+#include <memory>
 
 namespace violet::events {
 
@@ -39,6 +41,12 @@ struct Event;
 ///
 /// [`vscode.events.Emitter`]: https://code.visualstudio.com/api/references/vscode-api#EventEmitter&lt;T&gt;
 ///
+/// ## Remarks
+/// Listeners are kept in an immutable, reference-counted snapshot that is replaced (copy-on-write)
+/// whenever a listener is added or removed. [`Emitter::Fire`] only loads the current snapshot, so firing
+/// never takes the emitter's lock or allocates, and listeners that subscribe or unsubscribe while an event
+/// is being fired will only observe the next one.
+///
 /// ## Example
 /// ```cpp
 /// /* TODO(@auguwu): example here lol */
@@ -66,9 +74,10 @@ public:
         }
 
         Guard(Guard&& other) noexcept
-            : n_emitter(VIOLET_MOVE(other.n_emitter))
-            , n_id(other.n_id)
+            : n_alive(VIOLET_MOVE(other.n_alive))
+            , n_emitter(VIOLET_MOVE(other.n_emitter))
             , n_persist(other.n_persist)
+            , n_id(other.n_id)
         {
             other.n_id = -1;
             other.n_persist = false;
@@ -79,6 +88,7 @@ public:
             if (this != &other) {
                 this->Dispose();
 
+                this->n_alive = VIOLET_MOVE(other.n_alive);
                 this->n_emitter = VIOLET_MOVE(other.n_emitter);
                 this->n_persist = other.n_persist;
                 this->n_id = other.n_id;
@@ -156,7 +166,7 @@ public:
     /// @param persist whether if the listener should persist through the lifetime of this emitter.
     auto On(func_t fun, bool persist = false) -> Guard
     {
-        auto id = this->addListener(fun);
+        auto id = this->addListener(VIOLET_MOVE(fun));
         auto guard = Guard(std::weak_ptr(this->n_alive), this, id);
 
         if (persist) {
@@ -170,8 +180,8 @@ public:
     /// @param fun callback function to invoke once when the event fires.
     auto Once(func_t fun) -> Guard
     {
-        auto id = this->addListener(fun, true);
-        return Guard(this, id);
+        auto id = this->addListener(VIOLET_MOVE(fun), true);
+        return Guard(std::weak_ptr(this->n_alive), this, id);
     }
 
     /// Deregister a listener manually
@@ -182,14 +192,31 @@ public:
     }
 
     /// Fires a new event that all listeners will react to
+    ///
+    /// ## Remarks
+    /// This doesn't lock or allocate: it iterates over the snapshot of listeners that was current
+    /// when it was called. Only one-time listeners (registered with [`Emitter::Once`]) go through
+    /// the locked slow-path afterwards to deregister themselves.
+    ///
     /// @param args the arguments the listener will receive
     void Fire(Args&&... args)
     {
-        for (entry& ent: this->getSnapshot()) {
-            std::invoke(ent.Callback, VIOLET_FWD(Args, args)...);
+        auto snapshot = this->loadSnapshot();
+        if (snapshot == nullptr) {
+            return;
+        }
+
+        for (const SharedPtr<entry>& ent: *snapshot) {
+            // Concurrent `Fire` calls could both observe a one-time listener; only the
+            // first one to flip the flag gets to invoke it.
+            if (ent->Once && ent->Fired.exchange(true, std::memory_order_acq_rel)) {
+                continue;
+            }
 
-            if (ent.Once) {
-                this->removeListener(ent.ID);
+            std::invoke(ent->Callback, args...);
+
+            if (ent->Once) {
+                this->removeListener(ent->ID);
             }
         }
     }
@@ -205,46 +232,122 @@ private:
         Int64 ID;
         func_t Callback;
         bool Once;
+        std::atomic<bool> Fired = false;
+    };
+
+    using snapshot_t = Vec<SharedPtr<entry>>;
+
+    constexpr static UInt npos = static_cast<UInt>(-1);
+
+    /// A slot in the slot map that resolves listener IDs to their position in the current
+    /// snapshot. IDs are `(generation << 32) | slot`, so a stale ID (whose slot has since been
+    /// reused) never matches.
+    struct slot final {
+        UInt32 Generation = 1;
+        UInt Position = npos;
     };
 
-    auto getNextId() noexcept -> UInt64
+    auto loadSnapshot() const noexcept -> SharedPtr<const snapshot_t>
     {
-        return this->n_nextId.fetch_add(1, std::memory_order_relaxed);
+#ifdef __cpp_lib_atomic_shared_ptr
+        return this->n_snapshot.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&this->n_snapshot, std::memory_order_acquire);
+#endif
     }
 
-    auto addListener(func_t fun, bool once = false) noexcept -> Int64
+    void storeSnapshot(SharedPtr<const snapshot_t> snapshot) noexcept
     {
-        std::lock_guard lock(this->n_mu);
-
-        auto id = this->getNextId();
-        this->n_listeners.push_back(entry{ .ID = id, .Callback = fun, .Once = once });
-
-        return id;
+#ifdef __cpp_lib_atomic_shared_ptr
+        this->n_snapshot.store(VIOLET_MOVE(snapshot), std::memory_order_release);
+#else
+        std::atomic_store_explicit(&this->n_snapshot, VIOLET_MOVE(snapshot), std::memory_order_release);
+#endif
     }
 
-    auto getSnapshot() const noexcept -> Vec<entry>
+    auto addListener(func_t fun, bool once = false) -> Int64
     {
         std::lock_guard lock(this->n_mu);
-        return this->n_listeners;
+
+        UInt32 index = 0;
+        if (this->n_freeSlots.empty()) {
+            index = static_cast<UInt32>(this->n_slots.size());
+            this->n_slots.emplace_back();
+        } else {
+            index = this->n_freeSlots.back();
+            this->n_freeSlots.pop_back();
+        }
+
+        slot& current_slot = this->n_slots[index];
+        auto id = static_cast<Int64>((static_cast<UInt64>(current_slot.Generation) << 32) | index);
+
+        auto current = this->loadSnapshot();
+        auto next = current == nullptr ? std::make_shared<snapshot_t>() : std::make_shared<snapshot_t>(*current);
+
+        auto ent = std::make_shared<entry>();
+        ent->ID = id;
+        ent->Callback = VIOLET_MOVE(fun);
+        ent->Once = once;
+
+        next->push_back(VIOLET_MOVE(ent));
+        current_slot.Position = next->size() - 1;
+
+        this->storeSnapshot(VIOLET_MOVE(next));
+        return id;
     }
 
     void removeListener(Int64 id) noexcept
     {
         std::lock_guard lock(this->n_mu);
 
-        auto it = std::find_if(this->n_listeners.begin(), this->n_listeners.end(),
-            [id](auto const& entry) -> bool { return entry.ID == id; });
+        auto index = static_cast<UInt32>(static_cast<UInt64>(id) & 0xFFFFFFFF);
+        auto generation = static_cast<UInt32>(static_cast<UInt64>(id) >> 32);
+        if (id < 0 || index >= this->n_slots.size()) {
+            return;
+        }
+
+        slot& target = this->n_slots[index];
+        if (target.Generation != generation || target.Position == npos) {
+            return;
+        }
+
+        auto current = this->loadSnapshot();
+        auto next = std::make_shared<snapshot_t>();
+        next->reserve(current->size() - 1);
+
+        // Keep the subscription order intact; every listener after the removed one
+        // shifts down by one.
+        for (UInt i = 0; i < current->size(); i++) {
+            if (i == target.Position) {
+                continue;
+            }
 
-        if (it != this->n_listeners.end()) {
-            this->n_listeners.erase(it);
+            const auto& ent = (*current)[i];
+            this->n_slots[static_cast<UInt64>(ent->ID) & 0xFFFFFFFF].Position = next->size();
+            next->push_back(ent);
         }
+
+        target.Position = npos;
+        target.Generation++;
+        this->n_freeSlots.push_back(index);
+
+        this->storeSnapshot(VIOLET_MOVE(next));
     }
 
     event_t n_event;
     std::shared_ptr<void> n_alive = std::make_shared<Int32>(0);
-    mutable std::atomic<Int64> n_nextId = 0;
+
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::atomic<SharedPtr<const snapshot_t>> n_snapshot;
+#else
+    SharedPtr<const snapshot_t> n_snapshot;
+#endif
+
+    // The fields below are only touched by writers (subscribe/unsubscribe) and are
+    // guarded by `n_mu`. Readers only ever look at `n_snapshot`.
     mutable Mutex n_mu;
-    mutable Vec<entry> n_listeners;
+    Vec<slot> n_slots;
+    Vec<UInt32> n_freeSlots;
 };
 
 /// A handle that allows subscribing listeners from a [`Emitter<Args...>`].
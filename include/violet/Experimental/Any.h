@@ -33,10 +33,31 @@
 #include <typeindex>
 #endif
 
+#include <cstddef>
+#include <new>
 #include <sstream>
 
+/// The amount of bytes that [`violet::experimental::Any`] can store inline before it spills
+/// the value onto the heap. Defaults to three pointers, which is enough for most scalars,
+/// `std::string_view`-like views and small aggregates.
+///
+/// This changes the layout of `Any`, so it must be the same across every translation unit.
+#ifndef VIOLET_EXPERIMENTAL_ANY_INLINE_CAPACITY
+#define VIOLET_EXPERIMENTAL_ANY_INLINE_CAPACITY (3 * sizeof(void*))
+#endif
+
 namespace violet::experimental {
 
+/// Returns **true** if [`Any`] will store a `T` inside its inline buffer rather than
+/// allocating it on the heap.
+///
+/// A type is stored inline when it fits in `VIOLET_EXPERIMENTAL_ANY_INLINE_CAPACITY` bytes,
+/// its alignment is satisfied by the inline buffer, and it is nothrow move-constructible (so
+/// that moving an `Any` can never throw).
+template<typename T>
+constexpr inline bool any_stores_inline_v = sizeof(T) <= VIOLET_EXPERIMENTAL_ANY_INLINE_CAPACITY
+    && alignof(std::max_align_t) % alignof(T) == 0 && std::is_nothrow_move_constructible_v<T>;
+
 /// A type-erased virtual dispatch table for [`Any`]-like containers.
 ///
 /// `AnyVTable` stores function pointers for converting to string, cloning,
@@ -65,15 +86,28 @@ struct VIOLET_API AnyVTable {
     /// `nullptr` if `T` is not copy-constructible, callers must check before invoking.
     void* (*Clone)(const void* src, void* dst) = nullptr;
 
-    /// Destroys the object at `ptr` via `std::destroy_at` and deallocates
-    /// the memory with `::operator delete`.
+    /// Move-constructs `T` from `src` into the storage at `dst` and destroys `src`.
+    ///
+    /// Only populated for types that are stored inline (see [`any_stores_inline_v`]); heap
+    /// allocated values are moved by transferring ownership of the pointer instead.
+    void (*Relocate)(void* src, void* dst) noexcept = nullptr;
+
+    /// Destroys the object at `ptr` via `std::destroy_at`. This does not release
+    /// the storage itself, [`Any`] owns that.
     void (*Destruct)(void* ptr) = nullptr;
 
+    /// `sizeof(T)`
+    UInt Size = 0;
+
+    /// `alignof(T)`
+    UInt Align = 0;
+
     /// Constructs an `AnyVTable` for the given type `T` at compile time.
     ///
     /// The generated vtable adapts to `T`'s capabilities:
     /// - `ToString` is always populated.
     /// - `Clone` is only populated if `T` is copy-constructible.
+    /// - `Relocate` is only populated if `T` is stored inline.
     /// - `Destruct` is always populated.
     ///
     /// ## Type Requirements
@@ -118,14 +152,26 @@ struct VIOLET_API AnyVTable {
             };
         }
 
+        if constexpr (any_stores_inline_v<T>) {
+            vtable.Relocate = [](void* src, void* dst) noexcept -> void {
+                auto* self = static_cast<T*>(src);
+                VIOLET_DEBUG_ASSERT(self != nullptr, "object didn't outlive `AnyVTable`");
+
+                std::construct_at(static_cast<T*>(dst), VIOLET_MOVE(*self));
+                std::destroy_at(self);
+            };
+        }
+
         vtable.Destruct = [](void* ptr) -> void {
             auto* self = static_cast<T*>(ptr);
             VIOLET_DEBUG_ASSERT(self != nullptr, "object didn't outlive `AnyVTable`");
 
             std::destroy_at(self);
-            ::operator delete(self);
         };
 
+        vtable.Size = sizeof(T);
+        vtable.Align = alignof(T);
+
         return vtable;
     }
 };
@@ -155,6 +201,12 @@ struct VIOLET_API AnyVTable {
 /// [`violet::experimental::Any`] is both copyable and movable. Copies will perform a deep clone of the stored
 /// object via the virtual table's `Clone' entry. Moving `Any` will transfer ownership, leaving
 /// the source in a valid, but empty state.
+///
+/// ## Storage
+/// Small values (see [`any_stores_inline_v`]) are stored in an inline buffer of
+/// `VIOLET_EXPERIMENTAL_ANY_INLINE_CAPACITY` bytes, so constructing, copying or moving an `Any`
+/// holding an `int` never allocates. Larger or over-aligned values are allocated on the heap
+/// with respect to `alignof(T)`.
 struct VIOLET_API Any final {
     VIOLET_DISALLOW_CONSTRUCTOR(Any);
     ~Any();
@@ -175,16 +227,13 @@ struct VIOLET_API Any final {
 #endif
     {
         using U = std::decay_t<T>;
-
-        constexpr UInt size = sizeof(U);
         constexpr static auto vtable = AnyVTable::For<U>();
 
-        void* self = ::operator new(size);
-        std::construct_at(static_cast<T*>(self), VIOLET_FWD(T, value));
+        void* self = this->allocate<U>();
+        std::construct_at(static_cast<U*>(self), VIOLET_FWD(T, value));
 
         this->n_self = self;
-        this->n_size = size;
-        this->n_vtable = vtable;
+        this->n_vtable = &vtable;
     }
 
     template<typename T, typename... Args>
@@ -196,15 +245,13 @@ struct VIOLET_API Any final {
         : n_type(TypeId::Of<T>())
 #endif
     {
-        constexpr UInt size = sizeof(T);
         constexpr static auto vtable = AnyVTable::For<T>();
 
-        void* self = ::operator new(size);
+        void* self = this->allocate<T>();
         std::construct_at(static_cast<T*>(self), VIOLET_FWD(Args, args)...);
 
         this->n_self = self;
-        this->n_size = size;
-        this->n_vtable = vtable;
+        this->n_vtable = &vtable;
     }
 
     /// Construct a new [`Any`] object holding a value of `T`.
@@ -261,6 +308,12 @@ struct VIOLET_API Any final {
     [[nodiscard]] auto TypeName() const noexcept -> String;
 #endif
 
+    /// Returns **true** if the stored value lives in the inline buffer rather than on the heap.
+    [[nodiscard]] auto IsInline() const noexcept -> bool
+    {
+        return this->n_self != nullptr && this->n_self == static_cast<const void*>(this->n_buffer);
+    }
+
     /// Returns a string representation of the stored value.
     [[nodiscard]] auto ToString() const noexcept -> violet::String;
     friend auto operator<<(std::ostream& os, const Any& self) noexcept -> std::ostream&
@@ -275,18 +328,27 @@ private:
     using type_id = TypeId;
 #endif
 
-    VIOLET_EXPLICIT Any(void* self, UInt size, type_id type, AnyVTable vtable)
-        : n_self(self)
-        , n_vtable(vtable)
-        , n_size(size)
-        , n_type(type)
+    constexpr static UInt kInlineCapacity = VIOLET_EXPERIMENTAL_ANY_INLINE_CAPACITY;
+
+    alignas(std::max_align_t) std::byte n_buffer[kInlineCapacity];
+    void* n_self = nullptr;
+    const AnyVTable* n_vtable = nullptr;
+    type_id n_type;
+
+    /// Returns the storage that a `T` should be constructed in: the inline buffer if it
+    /// fits, or a heap allocation that respects `alignof(T)` otherwise.
+    template<typename T>
+    auto allocate() -> void*
     {
+        if constexpr (any_stores_inline_v<T>) {
+            return static_cast<void*>(this->n_buffer);
+        } else {
+            return allocateOnHeap(sizeof(T), alignof(T));
+        }
     }
 
-    void* n_self;
-    AnyVTable n_vtable;
-    UInt n_size;
-    type_id n_type;
+    static auto allocateOnHeap(UInt size, UInt align) -> void*;
+    static void deallocateOnHeap(void* ptr, UInt size, UInt align) noexcept;
 
     void destructObject();
 };
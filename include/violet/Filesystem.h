@@ -28,13 +28,22 @@
 #include <violet/IO/Error.h>
 #include <violet/Iterator.h>
 
-#if VIOLET_PLATFORM(UNIX)
-#include <dirent.h>
+#include <memory>
+
+/// The size of the buffer, in bytes, that each directory stream reads entries into with `getdents64(2)`
+/// on Linux. Larger buffers mean fewer syscalls on very large directories; walking a tree keeps one
+/// buffer alive per directory level that is still being read.
+///
+/// This only affects the library's translation units, so it has to be set when Violet itself is built.
+#ifndef VIOLET_FILESYSTEM_DIRENT_BUFFER_SIZE
+#define VIOLET_FILESYSTEM_DIRENT_BUFFER_SIZE (256 * 1024)
 #endif
 
 namespace violet::filesystem {
 namespace experimental {
     struct Dir;
+    struct ParallelWalkDirs;
+    struct tree;
 }
 
 struct Dirs;
@@ -78,9 +87,18 @@ VIOLET_API NOELDOC_SINCE("26.02") auto CreateFile(PathRef path) -> io::Result<Fi
 VIOLET_API NOELDOC_SINCE("26.02") auto Canonicalize(PathRef path) -> io::Result<Path>;
 
 /// Copies the contents of `srcs` into `dest`.
+///
+/// The destination is created (or truncated) with the permission bits of the source.
+///
+/// ## Platform-specific behaviour
+/// - **Linux**: tries to reflink the file with `ioctl(FICLONE)` first, which is instant on
+///   filesystems that share extents copy-on-write (btrfs, XFS, ...). Otherwise, only the data
+///   extents of the source (found with `SEEK_DATA`/`SEEK_HOLE`) are preallocated with
+///   `fallocate(2)` and copied with `copy_file_range(2)`, so sparse files stay sparse.
+///
 /// @param src source file
 /// @param dest destination file
-/// @returns the number of bytes, or an error if any occurs.
+/// @returns the number of bytes, or an error if any occurs. Holes of sparse files count towards it.
 VIOLET_API NOELDOC_SINCE("26.02") auto Copy(PathRef src, PathRef dest) -> io::Result<UInt64>;
 
 /// Returns metadata in the specified `path`, which includes the file size, permissions,
@@ -118,15 +136,65 @@ VIOLET_API NOELDOC_SINCE("26.02") auto SetPermissions(PathRef path, Permissions
 VIOLET_API NOELDOC_SINCE("26.02") auto Executable(PathRef path) -> io::Result<bool>;
 
 /// A entry from walking through a directory.
+///
+/// The entry's [`FileType`] is taken straight from the directory stream, so iterating a directory
+/// doesn't need to `stat` every entry. The full [`Metadata`] is only queried the first time it is
+/// asked for and then cached in the entry. Likewise, only the entry's name is stored; the full
+/// [`Path`] is joined onto the iterator's root when [`DirEntry::Path`] is called.
+///
+/// The name is copied out of the directory stream's read buffer, since that buffer is refilled
+/// by the next read while entries can be kept around for as long as the caller likes.
+///
+/// ## Platform-specific behaviour
+/// On Unix, the type comes from `dirent::d_type`. Filesystems that report `DT_UNKNOWN` fall back
+/// to a type-only `statx`/`fstatat` for that entry. [`DirEntry::Metadata`] is resolved relative
+/// to the directory the entry was read from while its iterator is still alive, and relative to
+/// [`DirEntry::Path`] afterwards.
 struct VIOLET_API NOELDOC_SINCE("26.02") DirEntry final {
-    /// The path of this entry.
-    struct Path Path;
+    /// The type of this entry. Symbolic links are reported as-is and never followed.
+    NOELDOC_SINCE("26.07.03") FileType Type;
+
+    /// Returns the file name of this entry, without any of its parent directories.
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") auto Name() const noexcept -> Str;
+
+    /// Returns the path of this entry, the iterator's root joined with every directory down to
+    /// this entry's [`DirEntry::Name`]. A new path is built on every call.
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") auto Path() const -> struct Path;
+
+    /// Returns the metadata about this entry without following symbolic links, querying it on first access.
+    ///
+    /// ## Remarks
+    /// The result is cached, later calls that ask for a subset of the fields already fetched don't
+    /// touch the filesystem again. As with any cached metadata, it can go stale if the entry is
+    /// modified after it was first queried.
+    ///
+    /// @param mask the fields the caller actually needs; see [`MetadataField`].
+    NOELDOC_SINCE("26.07.03")
+    auto Metadata(Bitflags<MetadataField> mask = MetadataField::All) -> io::Result<struct Metadata>;
 
-    /// Metadata about this entry.
-    struct Metadata Metadata;
+private:
+    friend struct Dirs;
+    friend struct WalkDirs;
+    friend struct experimental::ParallelWalkDirs;
+    friend struct experimental::tree;
+
+    /// platform-specific directory stream the entries are read from.
+    struct stream;
+
+    SharedPtr<const struct Path> n_parent; ///< the directory this entry lives in, shared with its siblings.
+    String n_name; ///< the file name of this entry, owned since the stream's buffer is reused by the next read.
+    Optional<struct Metadata> n_metadata; ///< the cached metadata, if it was queried before.
+    Bitflags<MetadataField> n_fetched; ///< which fields `n_metadata` was queried with.
+    std::weak_ptr<stream> n_stream; ///< the directory stream this entry was read from.
+
+    VIOLET_EXPLICIT DirEntry(SharedPtr<const struct Path> parent, Str name, FileType type, std::weak_ptr<stream> from);
 };
 
 /// A [`Iterator`] implementation that walks through a filesystem directory non-recursively.
+///
+/// ## Platform-specific behaviour
+/// On Linux, entries are read in bulk with `getdents64(2)` into a [`VIOLET_FILESYSTEM_DIRENT_BUFFER_SIZE`]
+/// buffer and parsed in place. Other Unix platforms go through `readdir(3)`.
 struct VIOLET_API NOELDOC_SINCE("26.02") Dirs final: public Iterator<Dirs> {
     VIOLET_DISALLOW_CONSTRUCTOR(Dirs);
     VIOLET_DISALLOW_COPY(Dirs);
@@ -155,6 +223,10 @@ private:
     VIOLET_EXPLICIT Dirs(Args&&... args);
 
     Impl* n_impl; ///< pointer to the implementation itself.
+
+#if VIOLET_PLATFORM(UNIX)
+    static auto fromDescriptor(Int32 fd, Path base) -> io::Result<Dirs>;
+#endif
 };
 
 /// A [`Iterator`] implementation that walks through a filesystem directory recursively.
@@ -188,7 +260,7 @@ private:
     Impl* n_impl; ///< pointer to the implementation itself.
 
 #if VIOLET_PLATFORM(UNIX)
-    static auto fromRootStream(DIR* stream, Path base) -> WalkDirs;
+    static auto fromDescriptor(Int32 fd, Path base) -> io::Result<WalkDirs>;
 #endif
 };
 
@@ -0,0 +1,131 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//! # 🌺💜 `violet/Filesystem/Experimental/ParallelWalkDir.h`
+
+#pragma once
+
+#include <violet/Experimental/Threading/CancellationToken.h>
+#include <violet/Filesystem.h>
+#include <violet/Iterator.h>
+
+namespace violet::filesystem::experimental {
+
+/// The order [`ParallelWalkDirs`] yields its entries in.
+enum struct NOELDOC_EXPERIMENTAL_SINCE("26.07.03") WalkOrder : UInt8 {
+    /// Entries are yielded as soon as the directory they live in has been read, in whichever order the
+    /// workers finish. Entries of a single directory are still yielded together.
+    Unordered,
+
+    /// Entries are yielded in the same depth-first, pre-order sequence [`WalkDir`] would yield them in.
+    Ordered
+};
+
+/// Extra options for [`ParallelWalkDir`].
+struct NOELDOC_EXPERIMENTAL_SINCE("26.07.03") ParallelWalkOptions final {
+    /// The order entries are yielded in.
+    WalkOrder Order = WalkOrder::Unordered;
+
+    /// A token that stops the walk early once cancellation is requested, as if
+    /// [`ParallelWalkDirs::StopTraversing`] was called.
+    Optional<violet::experimental::threading::CancellationToken> Cancellation;
+};
+
+/// A [`Iterator`] that walks through a filesystem directory recursively, reading subdirectories on a pool
+/// of worker threads.
+///
+/// Each worker owns a queue of directories to read. Every subdirectory a worker comes across is opened
+/// relative to its parent (`openat(2)`) and pushed onto that worker's own queue; idle workers steal the
+/// oldest directories queued by the others, which tend to be the largest untouched subtrees. This
+/// keeps many directory reads in flight at once, which is what matters on filesystems where walking
+/// a tree is bound by latency rather than CPU (NVMe, NFS, FUSE, ...).
+///
+/// ## Remarks
+/// Walking with [`WalkOrder::Ordered`] has the workers run ahead of the caller and keep every directory
+/// that was read but not yielded yet in memory, which is bounded only by the size of the tree.
+/// [`WalkOrder::Unordered`] stops the workers when too many directories are waiting to be yielded.
+///
+/// Errors are yielded in place of the directory that couldn't be read, right after that directory's
+/// entry; the walk carries on with the rest of the tree.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Filesystem/Experimental/ParallelWalkDir.h>
+///
+/// using namespace violet::filesystem::experimental;
+///
+/// auto walker = VIOLET_TRY(ParallelWalkDir("/srv/data", /*threads=*/16));
+/// for (auto entry: walker) {
+///     if (entry.Ok() && entry->Type.File()) {
+///         std::println("{}", entry->Path());
+///     }
+/// }
+/// ```
+struct VIOLET_API NOELDOC_EXPERIMENTAL_SINCE("26.07.03") ParallelWalkDirs final: public Iterator<ParallelWalkDirs> {
+    VIOLET_DISALLOW_CONSTRUCTOR(ParallelWalkDirs);
+    VIOLET_DISALLOW_COPY(ParallelWalkDirs);
+
+    /// Stops the walk and waits for every worker thread to exit.
+    ~ParallelWalkDirs();
+
+    VIOLET_IMPLICIT ParallelWalkDirs(ParallelWalkDirs&& other) noexcept;
+    auto operator=(ParallelWalkDirs&& other) noexcept -> ParallelWalkDirs& = delete;
+
+    /// The item that is returned from the iterator.
+    using Item = io::Result<DirEntry>;
+
+    /// Returns the next entry in the filesystem directory, blocking until one has been read.
+    VIOLET_API auto Next() noexcept -> Optional<Item>;
+
+    /// When called, the workers are stopped and iterations will return [`violet::Nothing`].
+    void StopTraversing();
+
+private:
+    friend auto ParallelWalkDir(PathRef, UInt, ParallelWalkOptions) -> io::Result<ParallelWalkDirs>;
+
+    /// the implementation of the walk itself.
+    struct Impl;
+
+    template<typename... Args>
+    VIOLET_EXPLICIT ParallelWalkDirs(Args&&... args);
+
+    Impl* n_impl; ///< pointer to the implementation itself.
+
+#if VIOLET_PLATFORM(UNIX)
+    static auto fromDescriptor(Int32 fd, Path base, UInt threads, ParallelWalkOptions options)
+        -> io::Result<ParallelWalkDirs>;
+#endif
+};
+
+/// Returns a recursive Violet-style iterator over the entries of the directory in `path`, which reads
+/// subdirectories in parallel.
+///
+/// ## Platform-specific behaviour
+/// This is only implemented on Unix. Every other platform returns [`io::ErrorKind::Unsupported`].
+///
+/// @param path the path to iterate over.
+/// @param threads the number of worker threads, or `0` to use one per hardware thread.
+/// @param options extra options for this walk.
+VIOLET_API NOELDOC_EXPERIMENTAL_SINCE("26.07.03") auto ParallelWalkDir(
+    PathRef path, UInt threads = 0, ParallelWalkOptions options = { }) -> io::Result<ParallelWalkDirs>;
+
+} // namespace violet::filesystem::experimental
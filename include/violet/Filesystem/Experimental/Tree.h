@@ -0,0 +1,152 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//! # 🌺💜 `violet/Filesystem/Experimental/Tree.h`
+
+#pragma once
+
+#include <violet/Experimental/Threading/CancellationToken.h>
+#include <violet/Filesystem.h>
+
+#include <chrono>
+#include <functional>
+
+namespace violet::filesystem::experimental {
+
+/// How far along [`CopyTree`] or [`RemoveAllDirs`] are.
+struct NOELDOC_EXPERIMENTAL_SINCE("26.07.03") TreeProgress final {
+    /// The number of non-directory entries (files, symbolic links, ...) that were copied or removed.
+    UInt64 Files = 0;
+
+    /// The number of directories that were created or removed.
+    UInt64 Directories = 0;
+
+    /// The number of bytes of file contents that were copied. Always `0` for [`RemoveAllDirs`].
+    UInt64 Bytes = 0;
+};
+
+/// A callback that is handed the [`TreeProgress`] of a running operation.
+using TreeProgressFn NOELDOC_EXPERIMENTAL_SINCE("26.07.03") = std::function<void(const TreeProgress&)>;
+
+/// Extra options for [`CopyTree`].
+struct NOELDOC_EXPERIMENTAL_SINCE("26.07.03") CopyTreeOptions final {
+    /// The number of worker threads, or `0` to use one per hardware thread.
+    UInt Threads = 0;
+
+    /// Copies the ownership, the exact permission bits (ignoring the `umask`) and the access and
+    /// modification times of every entry as well.
+    bool PreserveMetadata = false;
+
+    /// Copies the extended attributes of files and directories as well. Attributes that the
+    /// destination refuses (e.g. `security.*` without privileges, or no support at all) are skipped,
+    /// and so is everything on platforms where [`xattr::List`] isn't supported.
+    bool PreserveXAttrs = false;
+
+    /// A token that stops the copy once cancellation is requested, which then fails with
+    /// [`io::ErrorKind::Interrupted`]. Whatever was copied until then is left in place.
+    Optional<violet::experimental::threading::CancellationToken> Cancellation;
+
+    /// Called on the calling thread every [`CopyTreeOptions::ProgressInterval`] and once more when
+    /// the copy is done.
+    TreeProgressFn Progress;
+
+    /// How often [`CopyTreeOptions::Progress`] is called.
+    std::chrono::milliseconds ProgressInterval = std::chrono::milliseconds(100);
+};
+
+/// Extra options for [`RemoveAllDirs`].
+struct NOELDOC_EXPERIMENTAL_SINCE("26.07.03") RemoveAllDirsOptions final {
+    /// The number of worker threads, or `0` to use one per hardware thread.
+    UInt Threads = 0;
+
+    /// A token that stops the removal once cancellation is requested, which then fails with
+    /// [`io::ErrorKind::Interrupted`]. Whatever wasn't removed until then is left in place.
+    Optional<violet::experimental::threading::CancellationToken> Cancellation;
+
+    /// Called on the calling thread every [`RemoveAllDirsOptions::ProgressInterval`] and once more
+    /// when the removal is done.
+    TreeProgressFn Progress;
+
+    /// How often [`RemoveAllDirsOptions::Progress`] is called.
+    std::chrono::milliseconds ProgressInterval = std::chrono::milliseconds(100);
+};
+
+/// Recursively copies the directory `src` into `dst`, which must not exist yet, on a pool of worker
+/// threads.
+///
+/// Every directory is read once, by a single worker, and everything in it is opened relative to it
+/// (`openat(2)`), so no path is ever resolved twice. Subdirectories are handed to the other workers
+/// as soon as they are found, and the files of large directories are split into batches that are
+/// copied in parallel as well. Files are copied like [`filesystem::Copy`] does, so on Linux they are
+/// reflinked where the filesystem allows it and sparse files stay sparse.
+///
+/// ## Remarks
+/// Symbolic links are copied as links and never followed, FIFOs and device nodes are recreated
+/// and Unix sockets are skipped. Hard links are copied as separate files.
+///
+/// The first error stops every worker and is returned; whatever was copied until then is left in
+/// place.
+///
+/// ## Platform-specific behaviour
+/// This is only implemented on Unix. Every other platform returns [`io::ErrorKind::Unsupported`].
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Filesystem/Experimental/Tree.h>
+///
+/// using namespace violet::filesystem::experimental;
+///
+/// auto copied = VIOLET_TRY(CopyTree("/srv/cache", "/srv/cache.bak", {
+///     .PreserveMetadata = true,
+///     .Progress = [](const TreeProgress& progress) -> void {
+///         std::println("{} files, {} bytes", progress.Files, progress.Bytes);
+///     },
+/// }));
+/// ```
+///
+/// @param src the directory to copy.
+/// @param dst where the copy is created.
+/// @param options extra options for this copy.
+/// @returns what was copied, or the first error.
+VIOLET_API NOELDOC_EXPERIMENTAL_SINCE("26.07.03") auto CopyTree(
+    PathRef src, PathRef dst, CopyTreeOptions options = { }) -> io::Result<TreeProgress>;
+
+/// Removes the directory `path` and everything in it on a pool of worker threads.
+///
+/// Like [`CopyTree`], every directory is read by a single worker and its entries are removed relative
+/// to it (`unlinkat(2)`), while its subdirectories are handed to the other workers. A directory is
+/// removed by whichever worker finishes the last of its entries.
+///
+/// ## Remarks
+/// `path` itself must be a directory; a symbolic link to one is not followed. The first error stops
+/// every worker and is returned; whatever wasn't removed until then is left in place.
+///
+/// ## Platform-specific behaviour
+/// This is only implemented on Unix. Every other platform returns [`io::ErrorKind::Unsupported`].
+///
+/// @param path the directory to remove.
+/// @param options extra options for this removal.
+/// @returns what was removed, or the first error.
+VIOLET_API NOELDOC_EXPERIMENTAL_SINCE("26.07.03") auto RemoveAllDirs(PathRef path, RemoveAllDirsOptions options)
+    -> io::Result<TreeProgress>;
+
+} // namespace violet::filesystem::experimental
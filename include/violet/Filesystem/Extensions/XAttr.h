@@ -86,8 +86,14 @@ VIOLET_API NOELDOC_SINCE("26.04") auto List(io::FileDescriptor::value_type fd) n
 /// return [`violet::Nothing`].
 struct VIOLET_API NOELDOC_SINCE("26.04") Iter final: public Iterator<Iter> {
     VIOLET_DISALLOW_CONSTRUCTOR(Iter);
+    VIOLET_DISALLOW_COPY(Iter);
     ~Iter() noexcept;
 
+    VIOLET_IMPLICIT Iter(Iter&& other) noexcept
+        : n_impl(std::exchange(other.n_impl, nullptr))
+    {
+    }
+
     /// Item type that is returned.
     using Item = io::Result<Pair<String, Vec<UInt8>>>;
 
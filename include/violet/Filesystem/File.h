@@ -240,9 +240,54 @@ struct VIOLET_API NOELDOC_SINCE("26.02") File final {
     /// @param buf buffer to read from.
     [[nodiscard]] VIOLET_API auto Write(Span<const UInt8> buf) const noexcept -> io::Result<UInt>;
 
-    /// Flushes buffered writes to the underlying filesystem.
+    /// Reads up to `buf.size()` bytes at `offset`, without moving this file's offset.
+    /// @see violet::io::FileDescriptor::ReadAt
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto ReadAt(
+        Span<UInt8> buf, UInt64 offset, Bitflags<io::IOFlag> flags = { }) const noexcept -> io::Result<UInt>;
+
+    /// Writes all of `buf` at `offset`, without moving this file's offset.
+    /// @see violet::io::FileDescriptor::WriteAt
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto WriteAt(
+        Span<const UInt8> buf, UInt64 offset, Bitflags<io::IOFlag> flags = { }) const noexcept -> io::Result<UInt>;
+
+    /// Reads into every buffer of `bufs` in order, from this file's offset.
+    /// @see violet::io::FileDescriptor::ReadVectored
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto ReadVectored(Span<const Span<UInt8>> bufs) const noexcept
+        -> io::Result<UInt>;
+
+    /// Reads into every buffer of `bufs` in order at `offset`, without moving this file's offset.
+    /// @see violet::io::FileDescriptor::ReadVectoredAt
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto ReadVectoredAt(Span<const Span<UInt8>> bufs,
+        UInt64 offset, Bitflags<io::IOFlag> flags = { }) const noexcept -> io::Result<UInt>;
+
+    /// Writes every buffer of `bufs` in order at this file's offset.
+    /// @see violet::io::FileDescriptor::WriteVectored
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto WriteVectored(
+        Span<const Span<const UInt8>> bufs) const noexcept -> io::Result<UInt>;
+
+    /// Writes every buffer of `bufs` in order at `offset`, without moving this file's offset.
+    /// @see violet::io::FileDescriptor::WriteVectoredAt
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto WriteVectoredAt(Span<const Span<const UInt8>> bufs,
+        UInt64 offset, Bitflags<io::IOFlag> flags = { }) const noexcept -> io::Result<UInt>;
+
+    /// Flushes buffered writes. [`File`] doesn't buffer anything in userspace, so this is a no-op;
+    /// use [`File::Sync`] or [`File::SyncData`] to make the written data durable.
     [[nodiscard]] VIOLET_API auto Flush() const noexcept -> io::Result<void>;
 
+    /// Flushes all of this file's data and metadata to the storage device.
+    /// @see violet::io::FileDescriptor::Sync
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto Sync() const noexcept -> io::Result<void>;
+
+    /// Flushes this file's data to the storage device, without metadata that isn't needed
+    /// to read it back.
+    /// @see violet::io::FileDescriptor::SyncData
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto SyncData() const noexcept -> io::Result<void>;
+
+    /// Starts (and optionally waits on) writeback of the dirty pages in `[offset, offset + length)`.
+    /// @see violet::io::FileDescriptor::SyncRange
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto SyncRange(UInt64 offset, UInt64 length, bool wait = false) const noexcept
+        -> io::Result<void>;
+
     /// Locks the file exclusively. Blocks until the lock is acquired.
     [[nodiscard]] VIOLET_API auto Lock() const noexcept -> io::Result<void>;
 
@@ -37,6 +37,7 @@ namespace violet::filesystem {
 struct PathRef;
 struct Metadata;
 struct File;
+struct DirEntry;
 
 /// Representation of a filesystem entry's type.
 ///
@@ -161,6 +162,7 @@ struct VIOLET_API NOELDOC_SINCE("26.02") FileType final {
 private:
     friend struct violet::filesystem::File;
     friend struct violet::filesystem::Metadata;
+    friend struct violet::filesystem::DirEntry;
 
     enum struct tag : UInt8 {
         kFile = 1 << 0, ///< this is a file
@@ -246,6 +248,31 @@ enum struct SymlinkResolution : UInt8 {
     NoFollow
 };
 
+/// Selects which parts of a [`Metadata`] a query has to fill in.
+///
+/// Asking for less lets the kernel skip work it would otherwise do for every entry, like
+/// revalidating sizes and timestamps on network filesystems, which adds up quickly when
+/// walking large trees. Fields that weren't requested are left at their default values
+/// unless the filesystem hands them back anyway.
+///
+/// ## Platform-specific behaviour
+/// On Linux, this maps onto the `statx(2)` request mask. Other platforms always fill in every
+/// field and ignore the mask.
+enum struct NOELDOC_SINCE("26.07.03") MetadataField : UInt32 {
+    Type = 1 << 0, ///< [`Metadata::Type`]
+    Permissions = 1 << 1, ///< [`Metadata::Permissions`]
+    Size = 1 << 2, ///< [`Metadata::Size`]
+    ModifiedAt = 1 << 3, ///< [`Metadata::ModifiedAt`]
+    AccessedAt = 1 << 4, ///< [`Metadata::AccessedAt`]
+    CreatedAt = 1 << 5, ///< [`Metadata::CreatedAt`]
+    Owner = 1 << 6, ///< [`Metadata::UserID`] and [`Metadata::GroupID`]
+    HardLinks = 1 << 7, ///< [`Metadata::HardLinks`]
+    Inode = 1 << 8, ///< [`Metadata::Inode`]
+
+    /// Every field; what the overloads without a mask ask for.
+    All = Type | Permissions | Size | ModifiedAt | AccessedAt | CreatedAt | Owner | HardLinks | Inode
+};
+
 /// Represents filesystem metadata for a regular file, directory, special entry, etc.
 ///
 /// This struct provides low-level information about a filesystem object, including size,
@@ -356,6 +383,18 @@ struct VIOLET_API NOELDOC_SINCE("26.02") Metadata final {
     static auto For(io::FileDescriptor::value_type dirfd, PathRef path,
         SymlinkResolution resolution = SymlinkResolution::Follow) -> io::Result<Metadata>;
 
+    /// Queries only the fields selected by `mask` for `path`, relative to the directory `dirfd`.
+    ///
+    /// @param dirfd a borrowed directory descriptor that a relative `path` is resolved against.
+    /// @param path the path to query; an empty path queries `dirfd` itself.
+    /// @param resolution whether a trailing symbolic link is followed.
+    /// @param mask the fields the caller needs, see [`MetadataField`].
+    ///
+    /// @returns the file's `Metadata`, or an `io::Error` if the query failed.
+    NOELDOC_SINCE("26.07.03")
+    static auto For(io::FileDescriptor::value_type dirfd, PathRef path, SymlinkResolution resolution,
+        Bitflags<MetadataField> mask) -> io::Result<Metadata>;
+
     /// Queries metadata for the file at `path`.
     ///
     /// ## Example
@@ -376,6 +415,43 @@ struct VIOLET_API NOELDOC_SINCE("26.02") Metadata final {
     ///          on a permission failure, or `ENOTDIR` if a path component is not a directory.
     NOELDOC_SINCE("26.07")
     static auto For(PathRef path, SymlinkResolution resolution = SymlinkResolution::Follow) -> io::Result<Metadata>;
+
+    /// Queries the metadata of every path in `paths` at once.
+    ///
+    /// This is meant for tools that stat long lists of paths, like validating a cache or figuring out what
+    /// an incremental build has to redo. Asking only for the fields that are needed through `mask` lets
+    /// the kernel skip the rest, e.g. `MetadataField::Size | MetadataField::ModifiedAt`.
+    ///
+    /// ## Example
+    /// ```cpp
+    /// Vec<PathRef> inputs = { "src/main.cc", "src/util.cc", "include/util.h" };
+    /// auto results = Metadata::ForMany(inputs, MetadataField::Type | MetadataField::ModifiedAt);
+    ///
+    /// for (UInt i = 0; i < inputs.size(); i++) {
+    ///     if (results[i].Err() || results[i]->ModifiedAt > lastBuild) {
+    ///         rebuild(inputs[i]);
+    ///     }
+    /// }
+    /// ```
+    ///
+    /// ## Platform-specific behaviour
+    /// On Linux, the `statx(2)` calls are submitted to an `io_uring(7)` in batches of 256, so that a whole
+    /// batch costs a single system call. If io_uring isn't available (an older kernel, a seccomp filter, or
+    /// a build without liburing) they're spread across a pool of threads instead, which is also what
+    /// macOS does.
+    ///
+    /// @param paths the paths to query.
+    /// @param mask the fields the caller needs, see [`MetadataField`].
+    /// @param resolution whether a trailing symbolic link is followed.
+    ///
+    /// @returns one result per path, in the same order as `paths`.
+    NOELDOC_SINCE("26.07.03")
+    static auto ForMany(Span<const PathRef> paths, Bitflags<MetadataField> mask = MetadataField::All,
+        SymlinkResolution resolution = SymlinkResolution::Follow) -> Vec<io::Result<Metadata>>;
+
+private:
+    /// Returns the [`FileType`] that the file type bits (`S_IFMT`) of `mode` stand for.
+    static auto typeOf(UInt32 mode) noexcept -> FileType;
 };
 
 } // namespace violet::filesystem
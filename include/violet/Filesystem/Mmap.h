@@ -0,0 +1,236 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+//! # 🌺💜 `violet/Filesystem/Mmap.h`
+
+#pragma once
+
+#include <violet/Filesystem/File.h>
+#include <violet/IO/Error.h>
+
+namespace violet::filesystem {
+
+struct Mmap;
+
+/// Access-pattern hints for a [`Mmap`], passed to `madvise(2)`.
+enum struct NOELDOC_SINCE("26.07.03") MmapAdvice : UInt8 {
+    /// No special treatment; the kernel's default read-ahead.
+    Normal,
+
+    /// Pages will be accessed front to back, so read-ahead aggressively and
+    /// drop pages soon after they were touched.
+    Sequential,
+
+    /// Pages will be accessed in no particular order, so don't read ahead.
+    Random,
+
+    /// The range will be needed soon, so start paging it in now.
+    WillNeed,
+
+    /// The range won't be needed for a while, so its pages can be dropped.
+    DontNeed,
+};
+
+/// A builder that configures how a [`File`] is mapped into memory.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Filesystem/Mmap.h>
+///
+/// using namespace violet;
+/// using namespace violet::filesystem;
+///
+/// auto file = OpenOptions{}.Read().Open("index.bin");
+/// auto map = MmapOptions{}.Populate().Map(*file);
+/// ```
+struct VIOLET_API NOELDOC_SINCE("26.07.03") MmapOptions final {
+    constexpr VIOLET_IMPLICIT MmapOptions() noexcept = default;
+
+    /// Maps the file starting at `offset` bytes instead of the beginning. It doesn't
+    /// need to be page-aligned.
+    constexpr auto Offset(UInt64 offset) noexcept -> MmapOptions&
+    {
+        this->n_offset = offset;
+        return *this;
+    }
+
+    /// Maps only `length` bytes instead of everything from the offset to the end of the file.
+    constexpr auto Length(UInt length) noexcept -> MmapOptions&
+    {
+        this->n_length = length;
+        return *this;
+    }
+
+    /// Pre-faults the whole mapping up front so that the first access to every page
+    /// doesn't take a page fault.
+    ///
+    /// ## Platform-specific behaviour
+    /// This uses `MAP_POPULATE` on Linux, and is emulated with `MmapAdvice::WillNeed`
+    /// everywhere else.
+    constexpr auto Populate(bool yes = true) noexcept -> MmapOptions&
+    {
+        this->n_populate = yes;
+        return *this;
+    }
+
+    /// Hints that the mapping should be backed by transparent huge pages.
+    ///
+    /// ## Platform-specific behaviour
+    /// This is `madvise(MADV_HUGEPAGE)` on Linux and is only honoured if the kernel supports
+    /// huge pages for the file's filesystem; it is a no-op everywhere else.
+    constexpr auto HugePages(bool yes = true) noexcept -> MmapOptions&
+    {
+        this->n_hugePages = yes;
+        return *this;
+    }
+
+    /// Applies `advice` to the whole mapping once it is created.
+    constexpr auto Advise(MmapAdvice advice) noexcept -> MmapOptions&
+    {
+        this->n_advice = advice;
+        return *this;
+    }
+
+    /// Creates a read-only mapping of `file`, which must be opened for reading.
+    [[nodiscard]] VIOLET_API auto Map(const File& file) const noexcept -> io::Result<Mmap>;
+
+    /// Creates a shared, writable mapping of `file`, which must be opened for both reading
+    /// and writing. Stores into the mapping are written back to the file.
+    [[nodiscard]] VIOLET_API auto MapMut(const File& file) const noexcept -> io::Result<Mmap>;
+
+private:
+    [[nodiscard]] auto mapImpl(const File& file, bool writable) const noexcept -> io::Result<Mmap>;
+
+    UInt64 n_offset = 0;
+    Optional<UInt> n_length;
+    MmapAdvice n_advice = MmapAdvice::Normal;
+    bool n_populate = false;
+    bool n_hugePages = false;
+};
+
+/// A region of a file that is mapped into memory.
+///
+/// The mapping stays valid after the [`File`] it was created from is closed, and is
+/// unmapped when this object is dropped.
+///
+/// ## Remarks
+/// The mapping reflects the file as it changes: if another process truncates the file
+/// while it is mapped, touching the pages past the new end raises `SIGBUS`.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Filesystem/Mmap.h>
+///
+/// using namespace violet;
+/// using namespace violet::filesystem;
+///
+/// auto file = OpenOptions{}.Read().Open("index.bin");
+/// auto map = Mmap::Map(*file);
+///
+/// Span<const UInt8> bytes = map->Data();
+/// ```
+struct VIOLET_API NOELDOC_SINCE("26.07.03") Mmap final {
+    /// Creates an empty mapping.
+    constexpr VIOLET_IMPLICIT Mmap() noexcept = default;
+    ~Mmap();
+
+    VIOLET_DISALLOW_COPY(Mmap);
+
+    VIOLET_IMPLICIT Mmap(Mmap&& other) noexcept;
+    auto operator=(Mmap&& other) noexcept -> Mmap&;
+
+    /// Maps the whole of `file` read-only.
+    /// @see violet::filesystem::MmapOptions::Map
+    static auto Map(const File& file) noexcept -> io::Result<Mmap>
+    {
+        return MmapOptions{ }.Map(file);
+    }
+
+    /// Maps the whole of `file` for reading and writing.
+    /// @see violet::filesystem::MmapOptions::MapMut
+    static auto MapMut(const File& file) noexcept -> io::Result<Mmap>
+    {
+        return MmapOptions{ }.MapMut(file);
+    }
+
+    /// Returns the mapped bytes.
+    [[nodiscard]] constexpr auto Data() const noexcept -> Span<const UInt8>
+    {
+        return { this->n_data, this->n_size };
+    }
+
+    /// Returns the mapped bytes for writing.
+    ///
+    /// ## Remarks
+    /// The mapping must have been created with [`MmapOptions::MapMut`].
+    [[nodiscard]] auto DataMut() noexcept -> Span<UInt8>
+    {
+        VIOLET_ASSERT(this->n_writable, "`Mmap::DataMut` called on a read-only mapping");
+        return { this->n_data, this->n_size };
+    }
+
+    /// Returns the number of mapped bytes.
+    [[nodiscard]] constexpr auto Size() const noexcept -> UInt
+    {
+        return this->n_size;
+    }
+
+    /// Returns **true** if nothing is mapped.
+    [[nodiscard]] constexpr auto Empty() const noexcept -> bool
+    {
+        return this->n_size == 0;
+    }
+
+    /// Returns **true** if this mapping was created with [`MmapOptions::MapMut`].
+    [[nodiscard]] constexpr auto Writable() const noexcept -> bool
+    {
+        return this->n_writable;
+    }
+
+    /// Tells the kernel how the whole mapping is going to be accessed.
+    VIOLET_API auto Advise(MmapAdvice advice) const noexcept -> io::Result<void>;
+
+    /// Tells the kernel how `length` bytes starting at `offset` are going to be accessed.
+    VIOLET_API auto Advise(MmapAdvice advice, UInt offset, UInt length) const noexcept -> io::Result<void>;
+
+    /// Writes modified pages back to the file and waits for the writes to finish.
+    VIOLET_API auto Flush() const noexcept -> io::Result<void>;
+
+    /// Schedules modified pages to be written back to the file without waiting.
+    VIOLET_API auto FlushAsync() const noexcept -> io::Result<void>;
+
+    /// Unmaps the region, leaving this mapping empty.
+    VIOLET_API auto Unmap() noexcept -> io::Result<void>;
+
+private:
+    friend struct MmapOptions;
+
+    VIOLET_EXPLICIT Mmap(void* base, UInt length, UInt delta, bool writable) noexcept;
+
+    void* n_base = nullptr;
+    UInt n_length = 0;
+    UInt8* n_data = nullptr;
+    UInt n_size = 0;
+    bool n_writable = false;
+};
+
+} // namespace violet::filesystem
@@ -0,0 +1,244 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Filesystem.h>
+#include <violet/IO/Descriptor.h>
+
+#include <cerrno>
+#include <dirent.h>
+#include <fcntl.h>
+#include <memory>
+#include <unistd.h>
+
+#if VIOLET_PLATFORM(LINUX)
+#include <sys/syscall.h>
+#endif
+
+namespace violet::filesystem {
+namespace detail {
+    /// A single entry read from a [`DirEntry::stream`]. `Name` points into the stream's buffer, it is
+    /// NUL-terminated and only valid until the stream is advanced again.
+    struct rawdirent final {
+        Str Name;
+        FileType Type;
+    };
+
+#if VIOLET_PLATFORM(LINUX)
+    // The record layout `getdents64(2)` writes into the buffer. Not every libc exposes `struct dirent64`
+    // (musl only does with `_LARGEFILE64_SOURCE`), so it is spelled out here.
+    struct linux_dirent64 final {
+        UInt64 Inode;
+        Int64 Offset;
+        UInt16 RecordLength;
+        UInt8 Type;
+        char Name[1]; // NOLINT(modernize-avoid-c-arrays)
+    };
+#endif
+} // namespace detail
+
+/// An open directory that entries are read from. It is shared between the iterator that reads it and
+/// (weakly) every entry it yielded, so that [`DirEntry::Metadata`] can resolve relative to it.
+struct VIOLET_LOCAL NOELDOC_HIDE DirEntry::stream final {
+    VIOLET_DISALLOW_COPY_AND_MOVE(stream);
+
+#if VIOLET_PLATFORM(LINUX)
+    /// A buffer that `getdents64(2)` fills.
+    using buffer_type = UniquePtr<UInt8[]>; // NOLINT(modernize-avoid-c-arrays)
+#else
+    /// `readdir(3)` manages its own buffer, so there is nothing to hand around.
+    using buffer_type = std::nullptr_t;
+#endif
+
+    /// Wraps `fd`, taking ownership of it even if this fails.
+    static auto Open(Int32 fd, buffer_type buffer = { }) -> io::Result<SharedPtr<stream>>
+    {
+#if VIOLET_PLATFORM(LINUX)
+        return SharedPtr<stream>(new stream(fd, VIOLET_MOVE(buffer)));
+#else
+        DIR* dir = ::fdopendir(fd);
+        if (dir == nullptr) {
+            auto saved = errno;
+            ::close(fd);
+
+            return Err(io::Error::FromOSError(saved));
+        }
+
+        return SharedPtr<stream>(new stream(dir));
+#endif
+    }
+
+    ~stream()
+    {
+#if !VIOLET_PLATFORM(LINUX)
+        ::closedir(this->n_dir);
+#endif
+    }
+
+    [[nodiscard]] auto Descriptor() const noexcept -> Int32
+    {
+#if VIOLET_PLATFORM(LINUX)
+        return this->n_fd.Get();
+#else
+        return ::dirfd(this->n_dir);
+#endif
+    }
+
+    /// Hands out the read buffer once this stream has been exhausted, so the next directory
+    /// that is opened doesn't have to allocate its own.
+    auto TakeBuffer() noexcept -> buffer_type
+    {
+#if VIOLET_PLATFORM(LINUX)
+        return VIOLET_MOVE(this->n_buffer);
+#else
+        return nullptr;
+#endif
+    }
+
+    /// Returns the next entry, skipping `.` and `..`, or [`violet::Nothing`] at the end of the directory.
+    auto Next() -> io::Result<Optional<detail::rawdirent>>
+    {
+        while (true) {
+#if VIOLET_PLATFORM(LINUX)
+            if (this->n_offset >= this->n_length) {
+                auto filled = VIOLET_TRY(this->fill());
+                if (!filled) {
+                    return Nothing;
+                }
+            }
+
+            const auto* ent = reinterpret_cast<const detail::linux_dirent64*>(this->n_buffer.get() + this->n_offset);
+            this->n_offset += ent->RecordLength;
+
+            CStr name = ent->Name;
+            const UInt8 type = ent->Type;
+#else
+            errno = 0;
+            const struct dirent* ent = ::readdir(this->n_dir);
+            if (ent == nullptr) {
+                if (errno != 0) {
+                    return Err(io::Error::OSError());
+                }
+
+                return Nothing;
+            }
+
+            CStr name = ent->d_name;
+            const UInt8 type = ent->d_type;
+#endif
+
+            if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+                continue;
+            }
+
+            return detail::rawdirent{ .Name = Str(name), .Type = VIOLET_TRY(this->typeOf(name, type)) };
+        }
+    }
+
+private:
+#if VIOLET_PLATFORM(LINUX)
+    io::FileDescriptor n_fd;
+    buffer_type n_buffer;
+    UInt n_offset = 0;
+    UInt n_length = 0;
+    bool n_eof = false;
+
+    VIOLET_EXPLICIT stream(Int32 fd, buffer_type buffer)
+        : n_fd(fd)
+        , n_buffer(VIOLET_MOVE(buffer))
+    {
+    }
+
+    /// Reads the next batch of entries into the buffer, returning **false** at the end of the directory.
+    auto fill() -> io::Result<bool>
+    {
+        static constexpr UInt kBufferSize = VIOLET_FILESYSTEM_DIRENT_BUFFER_SIZE;
+        if (this->n_eof) {
+            return false;
+        }
+
+        if (this->n_buffer == nullptr) {
+            this->n_buffer = std::make_unique_for_overwrite<UInt8[]>(kBufferSize); // NOLINT(modernize-avoid-c-arrays)
+        }
+
+        while (true) {
+            auto read = ::syscall(SYS_getdents64, this->n_fd.Get(), this->n_buffer.get(), kBufferSize);
+            if (read < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                return Err(io::Error::OSError());
+            }
+
+            this->n_offset = 0;
+            this->n_length = static_cast<UInt>(read);
+            this->n_eof = read == 0;
+
+            return read != 0;
+        }
+    }
+#else
+    DIR* n_dir;
+
+    VIOLET_EXPLICIT stream(DIR* dir)
+        : n_dir(dir)
+    {
+    }
+#endif
+
+    // `d_type` is free, only filesystems that don't fill it in (`DT_UNKNOWN`) pay for a type-only query
+    auto typeOf(CStr name, UInt8 type) const -> io::Result<FileType>
+    {
+        switch (type) {
+        case DT_REG:
+            return FileType::mkfile();
+
+        case DT_DIR:
+            return FileType::mkdir();
+
+        case DT_LNK:
+            return FileType::mksymlink();
+
+        case DT_CHR:
+            return FileType::mkchardev();
+
+        case DT_BLK:
+            return FileType::mkblkdev();
+
+        case DT_FIFO:
+            return FileType::mkfifo();
+
+        case DT_SOCK:
+            return FileType::mksocket();
+
+        default: {
+            auto metadata = VIOLET_TRY(filesystem::Metadata::For(
+                this->Descriptor(), name, SymlinkResolution::NoFollow, MetadataField::Type));
+
+            return metadata.Type;
+        }
+        }
+    }
+};
+
+} // namespace violet::filesystem
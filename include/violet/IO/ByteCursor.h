@@ -0,0 +1,164 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+//! # 🌺💜 `violet/IO/ByteCursor.h`
+
+#pragma once
+
+#include <violet/IO/Error.h>
+#include <violet/Violet.h>
+
+#include <deque>
+
+namespace violet::io {
+
+/// A [`Readable`] view over a contiguous run of bytes that it reads from front to back.
+///
+/// Reading only moves an offset forward, so draining `N` bytes in small chunks costs
+/// `O(N)` in total, unlike [`io::Read(Vec<UInt8>&, Span<UInt8>)`][violet::io::Read] which
+/// has to shift the rest of the vector down on every call.
+///
+/// ## Remarks
+/// The cursor borrows the bytes; they have to outlive it.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/IO/ByteCursor.h>
+///
+/// using namespace violet;
+///
+/// auto output = VIOLET_TRY(Command("git").WithArg("log").Output());
+/// io::ByteCursor cursor(output.Stdout);
+///
+/// auto contents = VIOLET_TRY(io::ReadToString(cursor));
+/// ```
+struct VIOLET_API NOELDOC_SINCE("26.07.03") ByteCursor final {
+    /// Creates a cursor over nothing.
+    constexpr VIOLET_IMPLICIT ByteCursor() noexcept = default;
+
+    /// Creates a cursor that starts at the front of `data`.
+    constexpr VIOLET_IMPLICIT ByteCursor(Span<const UInt8> data) noexcept
+        : n_data(data)
+    {
+    }
+
+    /// Copies up to `buf.size()` bytes into `buf` and moves past them. Returns `0` once
+    /// every byte was read.
+    VIOLET_API auto Read(Span<UInt8> buf) noexcept -> Result<UInt>;
+
+    /// Returns the bytes that haven't been read yet.
+    [[nodiscard]] constexpr auto Remaining() const noexcept -> Span<const UInt8>
+    {
+        return this->n_data.subspan(this->n_pos);
+    }
+
+    /// Moves past `bytes` bytes without copying them, clamped to what is left.
+    constexpr void Consume(UInt bytes) noexcept
+    {
+        this->n_pos += std::min(bytes, this->n_data.size() - this->n_pos);
+    }
+
+    /// Returns how many bytes were read so far.
+    [[nodiscard]] constexpr auto Position() const noexcept -> UInt
+    {
+        return this->n_pos;
+    }
+
+    /// Moves the cursor to `pos`, clamped to the end of the bytes.
+    constexpr void SetPosition(UInt pos) noexcept
+    {
+        this->n_pos = std::min(pos, this->n_data.size());
+    }
+
+    /// Returns **true** if every byte was read.
+    [[nodiscard]] constexpr auto EOS() const noexcept -> bool
+    {
+        return this->n_pos >= this->n_data.size();
+    }
+
+private:
+    Span<const UInt8> n_data;
+    UInt n_pos = 0;
+};
+
+/// An owning, growable FIFO of bytes that is [`Readable`].
+///
+/// Bytes are pushed at the back in chunks and read from the front. Chunks are moved in
+/// rather than copied when possible, and reading never shifts the bytes that are left, so
+/// both ends are `O(1)` per chunk plus the bytes that are copied out.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/IO/ByteCursor.h>
+///
+/// using namespace violet;
+///
+/// io::ByteQueue queue;
+/// queue.Push(Vec<UInt8>{ 'h', 'i' });
+///
+/// Array<UInt8, 1> buf;
+/// auto bytes = queue.Read(buf); // => 1, `h`
+/// ```
+struct VIOLET_API NOELDOC_SINCE("26.07.03") ByteQueue final {
+    /// Creates an empty queue.
+    VIOLET_IMPLICIT ByteQueue() noexcept = default;
+
+    /// Appends `chunk` to the back of the queue without copying it.
+    VIOLET_API void Push(Vec<UInt8>&& chunk);
+
+    /// Appends a copy of `bytes` to the back of the queue.
+    VIOLET_API void Push(Span<const UInt8> bytes);
+
+    /// Copies up to `buf.size()` bytes from the front of the queue into `buf` and removes
+    /// them. Returns `0` if the queue is empty.
+    VIOLET_API auto Read(Span<UInt8> buf) noexcept -> Result<UInt>;
+
+    /// Returns the contiguous bytes at the front of the queue, which may be fewer than
+    /// [`ByteQueue::Size`] if more than one chunk is queued. Use [`ByteQueue::Consume`] to
+    /// remove them.
+    [[nodiscard]] VIOLET_API auto Front() const noexcept -> Span<const UInt8>;
+
+    /// Removes `bytes` bytes from the front of the queue, clamped to [`ByteQueue::Size`].
+    VIOLET_API void Consume(UInt bytes) noexcept;
+
+    /// Returns how many bytes are queued.
+    [[nodiscard]] constexpr auto Size() const noexcept -> UInt
+    {
+        return this->n_size;
+    }
+
+    /// Returns **true** if no bytes are queued.
+    [[nodiscard]] constexpr auto Empty() const noexcept -> bool
+    {
+        return this->n_size == 0;
+    }
+
+    /// Drops every queued byte.
+    VIOLET_API void Clear() noexcept;
+
+private:
+    std::deque<Vec<UInt8>> n_chunks;
+    UInt n_offset = 0; ///< how much of `n_chunks.front()` was already read
+    UInt n_size = 0;
+};
+
+} // namespace violet::io
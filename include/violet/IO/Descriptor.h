@@ -23,6 +23,7 @@
 
 #include <violet/IO/Read.h>
 #include <violet/IO/Write.h>
+#include <violet/Support/Bitflags.h>
 
 #if VIOLET_PLATFORM(WINDOWS)
 #include <windows.h>
@@ -30,6 +31,27 @@
 
 namespace violet::io {
 
+/// Per-call flags for the positional reads and writes of a [`FileDescriptor`].
+///
+/// ## Platform-specific behaviour
+/// On Linux, these map onto the `RWF_*` flags of `preadv2(2)`/`pwritev2(2)`. Other Unix platforms
+/// emulate [`IOFlag::DataSync`] and [`IOFlag::Sync`] with a sync after the write, ignore
+/// [`IOFlag::HighPriority`] and fail with [`ErrorKind::Unsupported`] on [`IOFlag::NoWait`].
+enum struct NOELDOC_SINCE("26.07.03") IOFlag : UInt32 {
+    /// Fail with [`ErrorKind::WouldBlock`] instead of waiting on the disk, i.e. only read data that is
+    /// already in the page cache (`RWF_NOWAIT`).
+    NoWait = 1 << 0,
+
+    /// Make this write durable like `fdatasync(2)` before returning (`RWF_DSYNC`).
+    DataSync = 1 << 1,
+
+    /// Make this write and the file's metadata durable like `fsync(2)` before returning (`RWF_SYNC`).
+    Sync = 1 << 2,
+
+    /// Poll for completion instead of sleeping, on devices that support it (`RWF_HIPRI`).
+    HighPriority = 1 << 3,
+};
+
 /// A zero-cost, tiny abstraction around OS-related file descriptors.
 struct VIOLET_API NOELDOC_SINCE("26.02") FileDescriptor final {
 #if VIOLET_PLATFORM(UNIX) || VIOLET_FEATURE(NOELDOC)
@@ -86,9 +108,101 @@ struct VIOLET_API NOELDOC_SINCE("26.02") FileDescriptor final {
     [[nodiscard]] VIOLET_API NOELDOC_SEE("violet::io::Writable") auto Write(Span<const UInt8> buf) const noexcept
         -> io::Result<UInt>;
 
+    /// Reads up to `buf.size()` bytes at `offset` without moving the descriptor's offset, so that any
+    /// number of threads can read from the same descriptor at once.
+    ///
+    /// @param buf the buffer to read into.
+    /// @param offset the offset to read from.
+    /// @param flags per-call flags; see [`IOFlag`].
+    /// @returns the number of bytes read, `0` at the end of the file.
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto ReadAt(
+        Span<UInt8> buf, UInt64 offset, Bitflags<IOFlag> flags = { }) const noexcept -> io::Result<UInt>;
+
+    /// Writes all of `buf` at `offset` without moving the descriptor's offset.
+    ///
+    /// @param buf the bytes to write.
+    /// @param offset the offset to write at.
+    /// @param flags per-call flags; see [`IOFlag`]. With [`IOFlag::NoWait`], this stops at the first
+    ///   write that would block and returns how much was written up to that point.
+    /// @returns the number of bytes written.
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto WriteAt(
+        Span<const UInt8> buf, UInt64 offset, Bitflags<IOFlag> flags = { }) const noexcept -> io::Result<UInt>;
+
+    /// Reads into every buffer of `bufs` in order with a single system call (`readv(2)`), from the
+    /// descriptor's offset.
+    ///
+    /// @param bufs the buffers to scatter the data into.
+    /// @returns the number of bytes read across all buffers, `0` at the end of the file.
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto ReadVectored(Span<const Span<UInt8>> bufs) const noexcept
+        -> io::Result<UInt>;
+
+    /// Like [`FileDescriptor::ReadVectored`], but reads at `offset` without moving the descriptor's
+    /// offset (`preadv(2)`, or `preadv2(2)` when `flags` are given).
+    ///
+    /// @param bufs the buffers to scatter the data into.
+    /// @param offset the offset to read from.
+    /// @param flags per-call flags; see [`IOFlag`].
+    /// @returns the number of bytes read across all buffers, `0` at the end of the file.
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto ReadVectoredAt(Span<const Span<UInt8>> bufs,
+        UInt64 offset, Bitflags<IOFlag> flags = { }) const noexcept -> io::Result<UInt>;
+
+    /// Writes every buffer of `bufs` in order (`writev(2)`) at the descriptor's offset, without having
+    /// to copy them into one contiguous buffer first.
+    ///
+    /// Like [`FileDescriptor::Write`], this keeps going until everything was written.
+    ///
+    /// @param bufs the buffers to gather the data from.
+    /// @returns the number of bytes written.
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto WriteVectored(
+        Span<const Span<const UInt8>> bufs) const noexcept -> io::Result<UInt>;
+
+    /// Like [`FileDescriptor::WriteVectored`], but writes at `offset` without moving the descriptor's
+    /// offset (`pwritev(2)`, or `pwritev2(2)` when `flags` are given).
+    ///
+    /// @param bufs the buffers to gather the data from.
+    /// @param offset the offset to write at.
+    /// @param flags per-call flags; see [`IOFlag`] and [`FileDescriptor::WriteAt`].
+    /// @returns the number of bytes written.
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto WriteVectoredAt(Span<const Span<const UInt8>> bufs,
+        UInt64 offset, Bitflags<IOFlag> flags = { }) const noexcept -> io::Result<UInt>;
+
+    /// Flushes buffered writes. Writes on a file descriptor go straight to the kernel, so
+    /// this is a no-op; use [`FileDescriptor::Sync`] or [`FileDescriptor::SyncData`] when the
+    /// data has to be durable.
+    ///
     /// @see violet::io::Writable
     [[nodiscard]] VIOLET_API NOELDOC_SEE("violet::io::Writable") auto Flush() const noexcept -> io::Result<void>;
 
+    /// Flushes both the data and metadata of this file descriptor to the storage device.
+    ///
+    /// ## Platform-specific behaviour
+    /// - **Linux**: `fsync(2)`
+    /// - **macOS**: `fcntl(F_FULLFSYNC)`, falling back to `fsync(2)` if the filesystem doesn't support it.
+    ///
+    /// Descriptors that can't be synchronized (pipes, sockets, terminals) are silently ignored.
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto Sync() const noexcept -> io::Result<void>;
+
+    /// Flushes the data of this file descriptor to the storage device, skipping metadata that
+    /// isn't required to read it back (like the modification time).
+    ///
+    /// ## Platform-specific behaviour
+    /// - **Linux**: `fdatasync(2)`
+    /// - **macOS**: same as [`FileDescriptor::Sync`].
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto SyncData() const noexcept -> io::Result<void>;
+
+    /// Initiates writeback of the dirty pages in `[offset, offset + length)`. If `wait` is **true**,
+    /// this blocks until that range was written to the device.
+    ///
+    /// ## Remarks
+    /// This doesn't flush the metadata or the disk's write cache and is not a durability guarantee;
+    /// it is meant to keep the amount of dirty page cache bounded when streaming large files.
+    ///
+    /// ## Platform-specific behaviour
+    /// - **Linux**: `sync_file_range(2)`
+    /// - **macOS**: a no-op unless `wait` is **true**, in which case it is the same as [`FileDescriptor::SyncData`].
+    [[nodiscard]] VIOLET_API NOELDOC_SINCE("26.07.03") auto SyncRange(UInt64 offset, UInt64 length, bool wait = false) const noexcept
+        -> io::Result<void>;
+
     VIOLET_EXPLICIT operator bool() const noexcept;
     VIOLET_EXPLICIT operator value_type() const noexcept;
 
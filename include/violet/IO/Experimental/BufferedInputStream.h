@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <violet/Container/Optional.h>
 #include <violet/IO/Experimental/InputStream.h>
 #include <violet/Violet.h>
 
@@ -35,6 +36,11 @@ namespace violet::io::experimental {
 /// This is particularly useful when the wrapped stream performs expensive syscalls like
 /// file descriptors, sockets, pipes, etc where amortizing reads improves performance.
 ///
+/// ## Remarks
+/// Reads that are at least as large as the internal buffer skip it and go straight to the
+/// underlying stream whenever nothing is buffered. When the underlying stream keeps filling
+/// the whole buffer, the buffer doubles in size (up to 1 MiB) to make sequential scans cheaper.
+///
 /// ## Examples
 /// ```cpp
 /// #include <violet/IO/Experimental/BufferedInputStream.h>
@@ -75,13 +81,76 @@ struct VIOLET_API BufferedInputStream final: public InputStream {
     /// @inheritdoc violet::io::experimental::InputStream::Skip(violet::UInt8)
     VIOLET_API auto Skip(UInt bytes) noexcept -> Result<void> override;
 
+    /// Returns the bytes that are currently buffered, refilling the buffer from the
+    /// underlying stream first if it is empty.
+    ///
+    /// The returned view borrows the internal buffer and nothing is consumed: pair it with
+    /// [`BufferedInputStream::Consume`] to mark how much of it was used. An empty span means
+    /// that the underlying stream reached end-of-stream.
+    ///
+    /// ## Remarks
+    /// The view is only valid until the next call that reads from, skips over or consumes
+    /// this stream.
+    ///
+    /// ## Example
+    /// ```cpp
+    /// while (true) {
+    ///     auto buf = VIOLET_TRY(stream.FillBuf());
+    ///     if (buf.empty()) {
+    ///         break;
+    ///     }
+    ///
+    ///     parse(buf);
+    ///     stream.Consume(buf.size());
+    /// }
+    /// ```
+    VIOLET_API NOELDOC_SINCE("26.07.03") auto FillBuf() noexcept -> Result<Span<const UInt8>>;
+
+    /// Marks `bytes` of the view returned by [`BufferedInputStream::FillBuf`] as consumed so
+    /// that they won't be returned again. `bytes` is clamped to what is currently buffered.
+    VIOLET_API NOELDOC_SINCE("26.07.03") void Consume(UInt bytes) noexcept;
+
+    /// Reads up to and including the next `delim` byte and returns a view of it.
+    ///
+    /// The view borrows the internal buffer, so the common case doesn't copy anything. A run
+    /// that straddles the end of the buffer is moved to its front, and one that is longer than
+    /// the whole buffer grows it.
+    ///
+    /// If the stream ends before another `delim` shows up, the remaining bytes are returned
+    /// without it; an empty span means end-of-stream.
+    ///
+    /// ## Remarks
+    /// The view is only valid until the next call that reads from, skips over or consumes
+    /// this stream.
+    VIOLET_API NOELDOC_SINCE("26.07.03") auto ReadUntil(UInt8 delim) noexcept -> Result<Span<const UInt8>>;
+
+    /// Reads the next line, without its trailing `\n` or `\r\n`.
+    ///
+    /// This is [`BufferedInputStream::ReadUntil`] with `'\n'` as the delimiter, so the same
+    /// borrowing rules apply to the returned view. Returns [`Nothing`] at end-of-stream.
+    ///
+    /// ## Example
+    /// ```cpp
+    /// while (auto line = VIOLET_TRY(stream.ReadLine())) {
+    ///     std::println("{}", *line);
+    /// }
+    /// ```
+    VIOLET_API NOELDOC_SINCE("26.07.03") auto ReadLine() noexcept -> Result<Optional<Str>>;
+
 private:
+    /// How many refills in a row have to fill the whole buffer before it is grown.
+    static constexpr UInt kGrowAfterFullRefills = 4;
+
+    /// The buffer is never grown past this size on its own.
+    static constexpr UInt kMaxAdaptiveSize = 1024 * 1024;
+
     violet::SharedPtr<InputStream> n_src;
     Vec<UInt8> n_buf;
     UInt n_pos = 0;
     UInt n_end = 0;
+    UInt n_fullRefills = 0;
 
-    void doRefill() noexcept;
+    auto doRefill() noexcept -> Result<void>;
 };
 
 } // namespace violet::io::experimental
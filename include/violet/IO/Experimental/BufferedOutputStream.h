@@ -27,32 +27,60 @@
 
 namespace violet::io::experimental {
 
+/// A buffered wrapper around an [`OutputStream`].
+///
+/// Small writes are collected in a fixed-size buffer that is allocated once up front and
+/// only drained into the wrapped stream when it runs out of room, or when it is flushed.
+///
+/// ## Remarks
+/// Writes that are at least as large as the buffer aren't copied into it: whatever is
+/// buffered and the new data are handed to the wrapped stream together through
+/// [`OutputStream::WriteVectored`]. If the wrapped stream fails after it took part of the
+/// new data, the write reports how much of it was taken and the error is returned by the
+/// next call instead.
+///
+/// ## Thread Safety
+/// This type is NOT thread-safe. External synchronization is required if used
+/// from multiple threads.
 struct VIOLET_API BufferedOutputStream final: public OutputStream {
     VIOLET_IMPLICIT BufferedOutputStream(SharedPtr<OutputStream> stream, UInt capacity = 8192) noexcept
         : n_source(VIOLET_MOVE(stream))
+        , n_buffer(std::make_unique_for_overwrite<UInt8[]>(capacity))
         , n_capacity(capacity)
     {
-        this->n_buffer.reserve(capacity);
     }
 
     template<typename Stream>
         requires(std::is_base_of_v<OutputStream, std::remove_cvref_t<Stream>>)
     VIOLET_IMPLICIT BufferedOutputStream(Stream&& source, UInt capacity = 8192) noexcept
         : n_source(std::make_shared<std::remove_cvref_t<Stream>>(VIOLET_FWD(Stream, source)))
+        , n_buffer(std::make_unique_for_overwrite<UInt8[]>(capacity))
         , n_capacity(capacity)
     {
-        this->n_buffer.reserve(capacity);
     }
 
     VIOLET_API auto Write(Span<const UInt8> data) noexcept -> io::Result<UInt> override;
+    VIOLET_API auto WriteVectored(Span<const Span<const UInt8>> bufs) noexcept -> io::Result<UInt> override;
     VIOLET_API auto Flush() noexcept -> io::Result<void> override;
+    VIOLET_API auto Sync() noexcept -> io::Result<void> override;
+    VIOLET_API auto SyncData() noexcept -> io::Result<void> override;
 
 private:
     SharedPtr<OutputStream> n_source;
-    Vec<UInt8> n_buffer;
+    UniquePtr<UInt8[]> n_buffer; // NOLINT(modernize-avoid-c-arrays)
     UInt n_capacity;
 
+    // Pending bytes are `[n_start, n_end)` of `n_buffer`; a partial drain only moves `n_start`.
+    UInt n_start = 0;
+    UInt n_end = 0;
+
+    // An error that happened after a write-through already reported some of its bytes as written.
+    Optional<io::Error> n_pending;
+
     auto doFlush() noexcept -> io::Result<UInt>;
+    auto makeRoom(UInt bytes) noexcept -> io::Result<void>;
+    auto takePending() noexcept -> io::Result<void>;
+    auto writeThrough(Span<Span<const UInt8>> bufs) noexcept -> io::Result<UInt>;
 };
 
 } // namespace violet::io::experimental
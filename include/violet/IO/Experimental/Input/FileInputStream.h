@@ -65,10 +65,20 @@ struct VIOLET_API FileInputStream final: public InputStream {
     template<std::convertible_to<filesystem::PathRef> Path>
     static auto Open(Path&& path) noexcept -> Result<FileInputStream>
     {
-        filesystem::File file = VIOLET_TRY(filesystem::OpenOptions{ }.Read().Open(VIOLET_FWD(Path, path)));
-        return FileInputStream(VIOLET_MOVE(file));
+        FileInputStream stream(VIOLET_TRY(filesystem::OpenOptions{ }.Read().Open(VIOLET_FWD(Path, path))));
+
+        // Readahead is only a hint, so a filesystem that doesn't take it isn't an error.
+        (void)stream.HintSequential();
+        return stream;
     }
 
+    /// Tells the kernel that this file will be read front to back, so that it reads ahead
+    /// more aggressively. [`FileInputStream::Open`] does this on its own.
+    ///
+    /// ## Platform-specific behaviour
+    /// This is `posix_fadvise(POSIX_FADV_SEQUENTIAL)` on Linux and `fcntl(F_RDAHEAD)` on macOS.
+    VIOLET_API NOELDOC_SINCE("26.07.03") auto HintSequential() const noexcept -> Result<void>;
+
     /// @inheritdoc violet::io::experimental::InputStream::Read(violet::Span<violet::UInt8>)
     VIOLET_API auto Read(Span<UInt8> buf) noexcept -> Result<UInt> override;
 
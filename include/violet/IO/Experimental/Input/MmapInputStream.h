@@ -0,0 +1,123 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include <violet/Filesystem/File.h>
+#include <violet/Filesystem/Mmap.h>
+#include <violet/Filesystem/Path.h>
+#include <violet/IO/Error.h>
+#include <violet/IO/Experimental/InputStream.h>
+
+namespace violet::io::experimental {
+
+/// An [`InputStream`] over a memory-mapped file.
+///
+/// Unlike [`FileInputStream`], reading doesn't go through a syscall: the whole file is
+/// mapped up front and [`MmapInputStream::Read`] copies straight out of the page cache.
+/// Callers that can work with the bytes in place should use [`MmapInputStream::Data`]
+/// or [`MmapInputStream::Remaining`] and skip the copy entirely.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/IO/Experimental/Input/MmapInputStream.h>
+///
+/// using namespace violet;
+/// using namespace violet::io::experimental;
+///
+/// auto stream = MmapInputStream::Open("index.bin");
+/// if (stream.Err()) {
+///     std::println(std::cerr, "failed to map file `index.bin': {}", stream.Error());
+///     std::abort();
+/// }
+///
+/// Span<const UInt8> bytes = stream->Data();
+/// ```
+struct VIOLET_API NOELDOC_SINCE("26.07.03") MmapInputStream final: public InputStream {
+    VIOLET_DISALLOW_CONSTRUCTOR(MmapInputStream);
+
+    /// Constructs a `MmapInputStream` over an existing mapping.
+    /// @param map the mapping, moved into the stream.
+    VIOLET_IMPLICIT MmapInputStream(filesystem::Mmap&& map) noexcept
+        : n_map(VIOLET_MOVE(map))
+    {
+    }
+
+    /// Maps the file at the specified path read-only, hinting that it'll be read sequentially.
+    /// @param path the file path to open.
+    template<std::convertible_to<filesystem::PathRef> Path>
+    static auto Open(Path&& path) noexcept -> Result<MmapInputStream>
+    {
+        filesystem::File file = VIOLET_TRY(filesystem::OpenOptions{ }.Read().Open(VIOLET_FWD(Path, path)));
+        return Open(file);
+    }
+
+    /// Maps `file` read-only, hinting that it'll be read sequentially. The file can
+    /// be closed afterwards.
+    /// @param file a file opened for reading.
+    VIOLET_API static auto Open(const filesystem::File& file) noexcept -> Result<MmapInputStream>;
+
+    /// @inheritdoc violet::io::experimental::InputStream::Read(violet::Span<violet::UInt8>)
+    VIOLET_API auto Read(Span<UInt8> buf) noexcept -> Result<UInt> override;
+
+    /// @inheritdoc violet::io::experimental::InputStream::Available()
+    [[nodiscard]] VIOLET_API auto Available() const noexcept -> Result<UInt> override;
+
+    /// @inheritdoc violet::io::experimental::InputStream::Skip(violet::UInt8)
+    VIOLET_API auto Skip(UInt bytes) noexcept -> Result<void> override;
+
+    /// Returns the whole mapped file, regardless of how much of it was already read.
+    [[nodiscard]] constexpr auto Data() const noexcept -> Span<const UInt8>
+    {
+        return this->n_map.Data();
+    }
+
+    /// Returns the bytes that haven't been read or skipped yet.
+    [[nodiscard]] constexpr auto Remaining() const noexcept -> Span<const UInt8>
+    {
+        return this->n_map.Data().subspan(this->n_pos);
+    }
+
+    /// Returns the current read position within the mapping.
+    [[nodiscard]] constexpr auto Position() const noexcept -> UInt
+    {
+        return this->n_pos;
+    }
+
+    /// Returns **true** if the stream has reached the end of the mapping.
+    [[nodiscard]] constexpr auto EOS() const noexcept -> bool
+    {
+        return this->n_pos >= this->n_map.Size();
+    }
+
+    /// Returns the underlying mapping, e.g. to give the kernel a different access hint.
+    [[nodiscard]] constexpr auto Mapping() const noexcept -> const filesystem::Mmap&
+    {
+        return this->n_map;
+    }
+
+private:
+    filesystem::Mmap n_map;
+    UInt n_pos = 0;
+};
+
+} // namespace violet::io::experimental
@@ -95,6 +95,18 @@ auto ReadToString(Stream& src) noexcept -> Result<String>
 {
     StringType out;
 
+    // Streams that already hold their contents contiguously (i.e. `MmapInputStream`) can be
+    // appended in one go instead of bouncing through the stack buffer below.
+    if constexpr (requires {
+                      { src.Remaining() } -> std::convertible_to<Span<const UInt8>>;
+                  }) {
+        Span<const UInt8> remaining = src.Remaining();
+        out.append(reinterpret_cast<const char*>(remaining.data()), remaining.size());
+        VIOLET_TRY_VOID(src.Skip(remaining.size()));
+
+        return out;
+    }
+
     if (auto available = src.Available(); available.Ok() && *available > 0) {
         out.reserve(available.Value());
     }
@@ -0,0 +1,100 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include <violet/IO/Error.h>
+#include <violet/IO/Experimental/OutputStream.h>
+
+namespace violet::io::experimental {
+
+/// An [`OutputStream`] that collects everything written to it in a list of fixed-size chunks.
+///
+/// Unlike [`ByteArrayOutputStream`], growing never reallocates or copies what was already
+/// written: once a chunk is full, a new one is started. That keeps the peak memory of building
+/// a large payload at roughly its final size instead of twice that.
+///
+/// The chunks can be handed to a vectored write as they are with [`ChunkedOutputStream::Chunks`],
+/// or copied into one contiguous buffer exactly once with [`ChunkedOutputStream::Flatten`].
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/IO/Experimental/Output/ChunkedOutputStream.h>
+///
+/// using namespace violet;
+/// using namespace violet::io::experimental;
+///
+/// ChunkedOutputStream stream;
+/// (void)stream.Write(header);
+/// (void)stream.Write(body);
+///
+/// auto chunks = stream.Chunks();
+/// auto written = socket.WriteVectored(chunks);
+/// ```
+struct VIOLET_API NOELDOC_SINCE("26.07.03") ChunkedOutputStream final: public OutputStream {
+    /// Creates an empty stream whose chunks are `chunkSize` bytes each.
+    /// @param chunkSize size of each chunk in bytes, defaults to `64 KiB`.
+    VIOLET_IMPLICIT ChunkedOutputStream(UInt chunkSize = 64 * 1024) noexcept;
+
+    VIOLET_API auto Write(Span<const UInt8> data) noexcept -> io::Result<UInt> override;
+    VIOLET_API auto WriteVectored(Span<const Span<const UInt8>> bufs) noexcept -> io::Result<UInt> override;
+
+    /// Returns the total number of bytes written.
+    [[nodiscard]] constexpr auto Size() const noexcept -> UInt
+    {
+        return this->n_size;
+    }
+
+    /// Returns **true** if nothing was written.
+    [[nodiscard]] constexpr auto Empty() const noexcept -> bool
+    {
+        return this->n_size == 0;
+    }
+
+    /// Returns a view of every chunk in order, suitable for a vectored write such as
+    /// [`FileDescriptor::WriteVectored`][violet::io::FileDescriptor::WriteVectored].
+    ///
+    /// The views are invalidated by the next write to this stream.
+    [[nodiscard]] VIOLET_API auto Chunks() const -> Vec<Span<const UInt8>>;
+
+    /// Copies every chunk into one contiguous buffer.
+    [[nodiscard]] VIOLET_API auto Flatten() const -> Vec<UInt8>;
+
+    /// Writes every chunk into `stream` through [`OutputStream::WriteVectored`], retrying
+    /// short writes until all of them were written.
+    VIOLET_API auto WriteTo(OutputStream& stream) const noexcept -> io::Result<void>;
+
+    /// Drops everything that was written.
+    VIOLET_API void Clear() noexcept;
+
+private:
+    struct chunk final {
+        UniquePtr<UInt8[]> Data; // NOLINT(modernize-avoid-c-arrays)
+        UInt Size = 0;
+    };
+
+    Vec<chunk> n_chunks;
+    UInt n_chunkSize;
+    UInt n_size = 0;
+};
+
+} // namespace violet::io::experimental
@@ -28,22 +28,50 @@
 
 namespace violet::io::experimental {
 
+/// Write-behind policy for a [`FileOutputStream`].
+///
+/// When enabled, the stream starts asynchronous writeback of every `Window` bytes it writes and
+/// waits for the previous window to reach the device before moving on. This keeps the amount of
+/// dirty page cache bounded to roughly two windows when streaming large files, without paying
+/// for a full `fsync(2)` per buffer.
+///
+/// ## Remarks
+/// This is a throughput/memory knob, **not** a durability guarantee. Call [`OutputStream::Sync`]
+/// or [`OutputStream::SyncData`] for that.
+struct VIOLET_API NOELDOC_SINCE("26.07.03") WriteBehind final {
+    /// Amount of bytes per writeback window. `0` disables write-behind.
+    UInt64 Window = 0;
+
+    /// File offset that the stream starts writing at. [`FileOutputStream::Open`] always starts
+    /// at the beginning of the file.
+    UInt64 Offset = 0;
+};
+
 struct VIOLET_API FileOutputStream final: public OutputStream {
     VIOLET_DISALLOW_CONSTRUCTOR(FileOutputStream);
-    VIOLET_IMPLICIT FileOutputStream(filesystem::File&& file) noexcept;
+    VIOLET_IMPLICIT FileOutputStream(filesystem::File&& file, WriteBehind policy = { }) noexcept;
 
     template<std::convertible_to<filesystem::PathRef> Path>
-    static auto Open(Path&& path) noexcept -> io::Result<FileOutputStream>
+    static auto Open(Path&& path, WriteBehind policy = { }) noexcept -> io::Result<FileOutputStream>
     {
         filesystem::File file = VIOLET_TRY(filesystem::OpenOptions{ }.Create().Write().Open(VIOLET_FWD(Path, path)));
-        return FileOutputStream(VIOLET_MOVE(file));
+        return FileOutputStream(VIOLET_MOVE(file), policy);
     }
 
     VIOLET_API auto Write(Span<const UInt8> data) noexcept -> io::Result<UInt> override;
+    VIOLET_API auto WriteVectored(Span<const Span<const UInt8>> bufs) noexcept -> io::Result<UInt> override;
     VIOLET_API auto Flush() noexcept -> io::Result<void> override;
+    VIOLET_API auto Sync() noexcept -> io::Result<void> override;
+    VIOLET_API auto SyncData() noexcept -> io::Result<void> override;
 
 private:
     filesystem::File n_file;
+    WriteBehind n_policy;
+    UInt64 n_offset;
+    UInt64 n_pending = 0;
+    UInt64 n_previous = 0;
+
+    auto writeBehind(UInt written) noexcept -> io::Result<void>;
 };
 
 } // namespace violet::io::experimental
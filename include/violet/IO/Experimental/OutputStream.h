@@ -30,10 +30,50 @@ struct VIOLET_API OutputStream {
     virtual ~OutputStream() = default;
 
     virtual auto Write(Span<const UInt8> data) noexcept -> io::Result<UInt> = 0;
+
+    /// Writes the buffers in `bufs`, in order, as if they were one contiguous buffer. Like
+    /// [`OutputStream::Write`], this may write fewer bytes than requested and returns how many
+    /// were written.
+    ///
+    /// Sinks that can take several buffers in one go (i.e, `writev(2)` for files) should override
+    /// this; the default writes them one at a time until one of them is only partially written.
+    NOELDOC_SINCE("26.07.03")
+    virtual auto WriteVectored(Span<const Span<const UInt8>> bufs) noexcept -> io::Result<UInt>
+    {
+        UInt written = 0;
+        for (const auto& buf: bufs) {
+            const UInt bytes = VIOLET_TRY(this->Write(buf));
+            written += bytes;
+
+            if (bytes < buf.size()) {
+                break;
+            }
+        }
+
+        return written;
+    }
+
+    /// Drains any userspace buffers into the underlying sink. This makes the data visible to
+    /// other readers of the sink, but it does **not** guarantee that it is durable.
     virtual auto Flush() noexcept -> io::Result<void>
     {
         return { };
     }
+
+    /// Flushes this stream and then asks the underlying sink to persist both data and metadata
+    /// (i.e, `fsync(2)` for files). Sinks without a notion of durability only flush.
+    NOELDOC_SINCE("26.07.03")
+    virtual auto Sync() noexcept -> io::Result<void>
+    {
+        return this->Flush();
+    }
+
+    /// Same as [`OutputStream::Sync`], but only the data has to be persisted (i.e, `fdatasync(2)` for files).
+    NOELDOC_SINCE("26.07.03")
+    virtual auto SyncData() noexcept -> io::Result<void>
+    {
+        return this->Sync();
+    }
 };
 
 } // namespace violet::io::experimental
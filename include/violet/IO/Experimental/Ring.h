@@ -0,0 +1,269 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//! # 🌺💜 `violet/IO/Experimental/Ring.h`
+
+#pragma once
+
+#include <violet/Experimental/Time/Duration.h>
+#include <violet/Filesystem/File.h>
+#include <violet/IO/Descriptor.h>
+#include <violet/IO/Error.h>
+
+namespace violet::io::experimental {
+
+/// A file that an operation queued on a [`Ring`] targets.
+///
+/// This is either a plain file descriptor (or anything that holds one, like a [`filesystem::File`]), or
+/// the index of a descriptor that was registered up front with [`Ring::RegisterFiles`]. Registered files
+/// skip the per-operation reference counting the kernel does for plain descriptors.
+struct NOELDOC_EXPERIMENTAL_SINCE("26.07.03") RingFile final {
+    /// Targets a plain file descriptor, which must outlive the operation.
+    VIOLET_IMPLICIT RingFile(FileDescriptor::value_type fd) noexcept
+        : n_fd(fd)
+    {
+    }
+
+    /// Targets the descriptor of `file`, which must outlive the operation.
+    VIOLET_IMPLICIT RingFile(const filesystem::File& file) noexcept
+        : n_fd(file.Descriptor())
+    {
+    }
+
+    /// Targets the file registered at `index` with [`Ring::RegisterFiles`].
+    static auto Fixed(UInt32 index) noexcept -> RingFile
+    {
+        RingFile file(static_cast<FileDescriptor::value_type>(index));
+        file.n_fixed = true;
+
+        return file;
+    }
+
+private:
+    friend struct Ring;
+
+    FileDescriptor::value_type n_fd;
+    bool n_fixed = false;
+};
+
+/// The outcome of an operation that was submitted to a [`Ring`].
+struct NOELDOC_EXPERIMENTAL_SINCE("26.07.03") Completion final {
+    /// The value the operation was queued with, used to tell completions apart.
+    UInt64 UserData = 0;
+
+    /// Returns the number of bytes that were transferred, or the error the operation failed with.
+    ///
+    /// Like `pread(2)` and `pwrite(2)`, a read or write can transfer less than it was asked to.
+    [[nodiscard]] auto Result() const -> io::Result<UInt>
+    {
+        if (this->n_result < 0) {
+            return Err(Error::FromOSError(-this->n_result));
+        }
+
+        return static_cast<UInt>(this->n_result);
+    }
+
+private:
+    friend struct Ring;
+
+    Int32 n_result = 0;
+};
+
+/// Options for creating a [`Ring`].
+struct NOELDOC_EXPERIMENTAL_SINCE("26.07.03") RingOptions final {
+    /// The number of operations that can be queued before they have to be submitted. The kernel rounds
+    /// this up to the next power of two.
+    UInt32 Entries = 256;
+
+    /// The number of completions the kernel can hold before they're reaped, or `0` to use twice
+    /// [`RingOptions::Entries`].
+    UInt32 CompletionEntries = 0;
+
+    /// Have a kernel thread poll for submissions (`IORING_SETUP_SQPOLL`), so that submitting doesn't need
+    /// a system call while the thread is awake.
+    bool SubmissionPolling = false;
+};
+
+/// An asynchronous I/O engine backed by Linux's `io_uring(7)`.
+///
+/// Positional reads and writes against any number of files are queued on the ring, submitted to the
+/// kernel in a single batch, and their [`Completion`]s reaped whenever the caller is ready for them.
+/// This lets a single thread keep hundreds of operations in flight instead of blocking on every call.
+///
+/// Buffers passed to an operation are borrowed, not copied: they have to stay alive and untouched
+/// until the operation's completion was reaped.
+///
+/// ## Remarks
+/// A `Ring` is not thread-safe, each thread that wants to drive I/O should own a ring of its own.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/IO/Experimental/Ring.h>
+///
+/// using namespace violet::io::experimental;
+///
+/// auto ring = VIOLET_TRY(Ring::New({ .Entries = 64 }));
+/// auto file = VIOLET_TRY(violet::filesystem::File::Open("shard.bin"));
+///
+/// Vec<Array<UInt8, 4096>> pages(16);
+/// for (UInt i = 0; i < pages.size(); i++) {
+///     VIOLET_TRY_VOID(ring.ReadAt(file, pages[i], i * 4096, /*userData=*/i));
+/// }
+///
+/// Array<Completion, 16> done;
+/// for (UInt remaining = pages.size(); remaining > 0;) {
+///     auto reaped = VIOLET_TRY(ring.Wait(done));
+///     remaining -= reaped;
+/// }
+/// ```
+///
+/// ## Platform-specific behaviour
+/// This is only implemented on Linux. [`Ring::New`] returns [`io::ErrorKind::Unsupported`] on every
+/// other platform.
+struct VIOLET_API NOELDOC_EXPERIMENTAL_SINCE("26.07.03") Ring final {
+    VIOLET_DISALLOW_CONSTRUCTOR(Ring);
+    VIOLET_DISALLOW_COPY(Ring);
+    ~Ring();
+
+    VIOLET_IMPLICIT Ring(Ring&& other) noexcept;
+    auto operator=(Ring&& other) noexcept -> Ring&;
+
+    /// Creates a new ring.
+    /// @param options the options to create the ring with.
+    static auto New(RingOptions options = { }) -> io::Result<Ring>;
+
+    /// Registers `buffers` with the kernel, which pins their memory so [`Ring::ReadFixed`] and
+    /// [`Ring::WriteFixed`] don't have to map them on every operation.
+    ///
+    /// Only one set of buffers can be registered at a time. They must outlive the registration.
+    ///
+    /// @param buffers the buffers to register; their position is the index the fixed operations refer to.
+    auto RegisterBuffers(Span<const Span<UInt8>> buffers) -> io::Result<void>;
+
+    /// Unregisters the buffers that were registered with [`Ring::RegisterBuffers`].
+    auto UnregisterBuffers() -> io::Result<void>;
+
+    /// Registers `fds` with the kernel, so that operations can refer to them through
+    /// [`RingFile::Fixed`].
+    ///
+    /// A slot can be left empty with `-1` and filled in later with [`Ring::UpdateFiles`].
+    ///
+    /// @param fds the descriptors to register; their position is the index [`RingFile::Fixed`] takes.
+    auto RegisterFiles(Span<const FileDescriptor::value_type> fds) -> io::Result<void>;
+
+    /// Replaces the registered files starting at `offset` with `fds`.
+    ///
+    /// @param offset the index of the first slot to replace.
+    /// @param fds the new descriptors, `-1` clears a slot.
+    auto UpdateFiles(UInt32 offset, Span<const FileDescriptor::value_type> fds) -> io::Result<void>;
+
+    /// Unregisters the files that were registered with [`Ring::RegisterFiles`].
+    auto UnregisterFiles() -> io::Result<void>;
+
+    /// Queues a read of up to `buf.size()` bytes from `file` at `offset`.
+    ///
+    /// When the submission queue is full, everything queued so far is submitted to make room.
+    ///
+    /// @param file the file to read from.
+    /// @param buf the buffer to read into, which must stay alive until the operation completes.
+    /// @param offset the offset in `file` to read from.
+    /// @param userData a value that is handed back in the operation's [`Completion`].
+    auto ReadAt(RingFile file, Span<UInt8> buf, UInt64 offset, UInt64 userData) -> io::Result<void>;
+
+    /// Queues a write of `buf` into `file` at `offset`.
+    ///
+    /// When the submission queue is full, everything queued so far is submitted to make room.
+    ///
+    /// @param file the file to write into.
+    /// @param buf the bytes to write, which must stay alive until the operation completes.
+    /// @param offset the offset in `file` to write at.
+    /// @param userData a value that is handed back in the operation's [`Completion`].
+    auto WriteAt(RingFile file, Span<const UInt8> buf, UInt64 offset, UInt64 userData) -> io::Result<void>;
+
+    /// Queues a read like [`Ring::ReadAt`] into memory within the registered buffer at `index`.
+    ///
+    /// @param file the file to read from.
+    /// @param buf the memory to read into, which must lie within the registered buffer.
+    /// @param offset the offset in `file` to read from.
+    /// @param index the index of the registered buffer `buf` lies in.
+    /// @param userData a value that is handed back in the operation's [`Completion`].
+    auto ReadFixed(RingFile file, Span<UInt8> buf, UInt64 offset, UInt16 index, UInt64 userData)
+        -> io::Result<void>;
+
+    /// Queues a write like [`Ring::WriteAt`] from memory within the registered buffer at `index`.
+    ///
+    /// @param file the file to write into.
+    /// @param buf the bytes to write, which must lie within the registered buffer.
+    /// @param offset the offset in `file` to write at.
+    /// @param index the index of the registered buffer `buf` lies in.
+    /// @param userData a value that is handed back in the operation's [`Completion`].
+    auto WriteFixed(RingFile file, Span<const UInt8> buf, UInt64 offset, UInt16 index, UInt64 userData)
+        -> io::Result<void>;
+
+    /// Queues a `fsync(2)` of `file`, or a `fdatasync(2)` if `dataOnly` is **true**.
+    ///
+    /// The kernel doesn't order this against other operations in flight; reap the writes it should
+    /// cover before queueing it.
+    ///
+    /// @param file the file to sync.
+    /// @param dataOnly only flush the file's data and the metadata needed to read it back.
+    /// @param userData a value that is handed back in the operation's [`Completion`].
+    auto Sync(RingFile file, bool dataOnly, UInt64 userData) -> io::Result<void>;
+
+    /// Submits every queued operation to the kernel without waiting for any of them.
+    /// @returns the number of operations that were submitted.
+    auto Submit() -> io::Result<UInt>;
+
+    /// Reaps completions that are already available into `out` without blocking.
+    ///
+    /// @param out where to write the completions into.
+    /// @returns the number of completions written into `out`.
+    auto Poll(Span<Completion> out) -> UInt;
+
+    /// Submits every queued operation, then blocks until at least `minimum` completions are available
+    /// and reaps as many as fit into `out`.
+    ///
+    /// @param out where to write the completions into.
+    /// @param minimum the number of completions to wait for; capped to `out.size()` and to the number
+    ///   of operations in flight, so this never waits for a completion that can't arrive.
+    /// @param timeout how long to wait at most, or [`violet::Nothing`] to wait indefinitely.
+    /// @returns the number of completions written into `out`, which is less than `minimum` if the
+    ///   timeout expired.
+    auto Wait(Span<Completion> out, UInt minimum = 1, Optional<violet::experimental::chrono::Duration> timeout = Nothing)
+        -> io::Result<UInt>;
+
+    /// Returns the number of operations that were queued but not submitted yet.
+    [[nodiscard]] auto Queued() const noexcept -> UInt;
+
+    /// Returns the number of operations that were submitted but whose completions weren't reaped yet.
+    [[nodiscard]] auto InFlight() const noexcept -> UInt;
+
+private:
+    /// the platform-specific ring itself.
+    struct Impl;
+
+    VIOLET_EXPLICIT Ring(Impl* impl) noexcept;
+
+    Impl* n_impl; ///< pointer to the implementation itself.
+};
+
+} // namespace violet::io::experimental
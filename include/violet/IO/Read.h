@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <violet/IO/ByteCursor.h>
 #include <violet/IO/Error.h>
 #include <violet/Violet.h>
 
@@ -30,7 +31,10 @@ namespace violet::io {
 
 /// Reads data from a buffer or data source into a given storage.
 ///
-/// ## Example
+/// ## Remarks
+/// The bytes that were read are removed from the front of `data`, which shifts everything
+/// after them down; draining a large vector in small chunks is quadratic. Wrap it in a
+/// [`ByteCursor`] instead, which only moves an offset forward.
 ///
 /// @param data storage for the read data
 /// @param buf buffer to read from
@@ -96,6 +100,15 @@ template<Readable R, typename Container = Vec<UInt8>>
 // clang-format on
 NOELDOC_SINCE("26.07") VIOLET_API auto ReadToBytes(R& reader) -> Result<Container>
 {
+    // Draining a vector through `io::Read` shifts it down on every chunk.
+    if constexpr (std::same_as<R, Vec<UInt8>>) {
+        Container out;
+        out.insert(out.end(), reader.begin(), reader.end());
+        reader.clear();
+
+        return out;
+    }
+
     Container out;
     Array<UInt8, 1024> chunk{ };
     while (true) {
@@ -128,6 +141,15 @@ template<Readable R, typename StringType = String>
 NOELDOC_SINCE("26.04.01")
 VIOLET_API auto ReadToString(R& reader) -> Result<StringType>
 {
+    // Draining a vector through `io::Read` shifts it down on every chunk.
+    if constexpr (std::same_as<R, Vec<UInt8>>) {
+        StringType out;
+        out.append(reinterpret_cast<const char*>(reader.data()), reader.size());
+        reader.clear();
+
+        return out;
+    }
+
     StringType out;
 
     Array<UInt8, 4096> buf;
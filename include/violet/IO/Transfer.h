@@ -0,0 +1,119 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+//! # 🌺💜 `violet/IO/Transfer.h`
+
+#pragma once
+
+#include <violet/IO/Descriptor.h>
+
+#include <concepts>
+#include <limits>
+
+namespace violet::io {
+
+/// Moves up to `count` bytes from `src` to `dst`, letting the kernel copy the data whenever
+/// it can instead of bouncing it through a userspace buffer.
+///
+/// Both descriptors are read and written at their current offsets, which are advanced
+/// by the number of bytes transferred. The transfer stops early once `src` reaches the end
+/// of its data, so the default `count` moves everything that is left.
+///
+/// ## Remarks
+/// If `src` is non-blocking, the transfer stops at the first read that would block and
+/// returns what was moved until then; if nothing was moved, it fails with
+/// [`ErrorKind::WouldBlock`].
+///
+/// ## Platform-specific behaviour
+/// - **Linux**: picks the cheapest primitive for the pair of descriptors: `copy_file_range(2)`
+///   between two regular files (reflinking them on filesystems that support it),
+///   `splice(2)` when either side is a pipe, and `sendfile(2)` from a regular file into
+///   anything else (e.g. a socket). If the kernel refuses the pair (different filesystems,
+///   `O_APPEND`, unsupported file types...), it falls back to a `read(2)`/`write(2)` loop.
+/// - **Other Unix platforms**: always a `read(2)`/`write(2)` loop.
+/// - **Windows**: fails with [`ErrorKind::Unsupported`].
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/IO/Transfer.h>
+/// #include <violet/Subprocess.h>
+///
+/// using namespace violet;
+///
+/// auto child = VIOLET_TRY(subprocess::Command("tar")
+///     .WithArgs({ "-c", "." })
+///     .WithStdout(subprocess::Stdio::Pipe())
+///     .Spawn());
+///
+/// auto file = VIOLET_TRY(filesystem::OpenOptions().Write().Create().Truncate().Open("./archive.tar"));
+/// auto bytes = VIOLET_TRY(io::Transfer(child.Stdout->Descriptor.Get(), file.Descriptor()));
+/// ```
+///
+/// @param src the descriptor to read from.
+/// @param dst the descriptor to write into.
+/// @param count the maximum amount of bytes to transfer.
+/// @returns the number of bytes transferred, which is less than `count` only if `src` ran
+/// out of data.
+VIOLET_API NOELDOC_SINCE("26.07.03") auto Transfer(FileDescriptor::value_type src, FileDescriptor::value_type dst,
+    UInt64 count = std::numeric_limits<UInt64>::max()) noexcept -> Result<UInt64>;
+
+/// Moves up to `count` bytes from `src` to `dst`.
+///
+/// ## Remarks
+/// This is a template so that a raw descriptor can't implicitly turn into an owning
+/// [`FileDescriptor`] (which would close it once the call returns).
+///
+/// @see violet::io::Transfer(FileDescriptor::value_type, FileDescriptor::value_type, UInt64)
+template<std::same_as<FileDescriptor> Descriptor>
+NOELDOC_SINCE("26.07.03") inline auto Transfer(const Descriptor& src, const Descriptor& dst,
+    UInt64 count = std::numeric_limits<UInt64>::max()) noexcept -> Result<UInt64>
+{
+    return Transfer(src.Get(), dst.Get(), count);
+}
+
+/// Duplicates up to `count` bytes that are queued in the pipe `src` into the pipe `dst`
+/// **without** consuming them, so that they can still be read from `src` afterwards.
+///
+/// This blocks until `src` has data to duplicate and returns `0` once its write end was
+/// closed and it ran dry.
+///
+/// ## Platform-specific behaviour
+/// - **Linux**: `tee(2)`.
+/// - **Other platforms**: fails with [`ErrorKind::Unsupported`].
+///
+/// @param src a pipe to duplicate the data from.
+/// @param dst a pipe to write the duplicated data into.
+/// @param count the maximum amount of bytes to duplicate.
+/// @returns the number of bytes duplicated.
+VIOLET_API NOELDOC_SINCE("26.07.03") auto Tee(FileDescriptor::value_type src, FileDescriptor::value_type dst,
+    UInt64 count = std::numeric_limits<UInt64>::max()) noexcept -> Result<UInt64>;
+
+/// Duplicates up to `count` bytes from the pipe `src` into the pipe `dst` without consuming them.
+/// @see violet::io::Tee(FileDescriptor::value_type, FileDescriptor::value_type, UInt64)
+template<std::same_as<FileDescriptor> Descriptor>
+NOELDOC_SINCE("26.07.03") inline auto Tee(const Descriptor& src, const Descriptor& dst,
+    UInt64 count = std::numeric_limits<UInt64>::max()) noexcept -> Result<UInt64>
+{
+    return Tee(src.Get(), dst.Get(), count);
+}
+
+} // namespace violet::io
@@ -24,10 +24,12 @@
 #include <violet/Container/Optional.h>
 #include <violet/Filesystem/Path.h>
 #include <violet/Subprocess/ExitStatus.h>
+#include <violet/Subprocess/Lines.h>
 #include <violet/Subprocess/PID.h>
 #include <violet/Subprocess/Stdio.h>
 
 #include <chrono>
+#include <limits>
 
 #if VIOLET_PLATFORM(UNIX)
 #include <csignal>
@@ -40,6 +42,7 @@
 namespace violet::subprocess {
 struct Command;
 struct Child;
+struct PreparedCommand;
 
 #if VIOLET_PLATFORM(UNIX)
 namespace ext {
@@ -55,6 +58,13 @@ namespace ext {
 namespace detail {
     auto SpawnAsForkExec(Command&) -> violet::io::Result<Child>;
 
+#if VIOLET_PLATFORM(LINUX)
+    struct SpawnPlan;
+
+    auto SpawnWithClone(Command&) -> violet::io::Result<Child>;
+    auto SpawnPlanned(const Command&, const SpawnPlan&) -> violet::io::Result<Child>;
+#endif
+
 #if VIOLET_PLATFORM(APPLE_MACOS)
     auto SpawnWithPosix(Command&) -> violet::io::Result<Child>;
 #endif
@@ -130,6 +140,53 @@ struct VIOLET_API NOELDOC_SINCE("26.07") Child final {
     /// for logging and debugging.
     [[nodiscard]] auto ToString() const -> String;
 
+    /// Streams what the child writes to its stdout into `dst` until it closes its end of the
+    /// pipe (usually by exiting) or `count` bytes were moved.
+    ///
+    /// The data is moved with [`io::Transfer`], so on Linux it goes from the pipe into `dst`
+    /// with `splice(2)` and never passes through a userspace buffer.
+    ///
+    /// ## Remarks
+    /// This blocks until the stream is done. If stderr was piped as well, it has to be drained
+    /// concurrently (or routed with [`Stdio::Null()`], [`Stdio::Inherit()`] or
+    /// [`Stdio::Pipe(Path&&)`] instead), otherwise the child stalls once that pipe fills up.
+    ///
+    /// @param dst the descriptor to stream stdout into.
+    /// @param count the maximum amount of bytes to stream.
+    /// @returns the number of bytes streamed, or an error with [`ErrorKind::InvalidInput`] if
+    /// stdout wasn't configured with [`Stdio::Pipe()`].
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") auto TransferStdout(
+        io::FileDescriptor::value_type dst, UInt64 count = std::numeric_limits<UInt64>::max()) const
+        -> io::Result<UInt64>;
+
+    /// Streams what the child writes to its stderr into `dst`.
+    /// @see violet::subprocess::Child::TransferStdout
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") auto TransferStderr(
+        io::FileDescriptor::value_type dst, UInt64 count = std::numeric_limits<UInt64>::max()) const
+        -> io::Result<UInt64>;
+
+    /// Returns an iterator over the lines the child writes to its stdout, which takes over
+    /// [`Child::Stdout`].
+    ///
+    /// ## Remarks
+    /// If stderr was piped as well, it has to be drained concurrently (or read with [`Child::Lines`]
+    /// instead), otherwise the child stalls once that pipe fills up. If stdout wasn't piped, the
+    /// iterator is empty.
+    ///
+    /// @param options extra options for how lines are buffered.
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") auto StdoutLines(LineOptions options = { }) -> ChildLines;
+
+    /// Returns an iterator over the lines the child writes to its stderr, which takes over
+    /// [`Child::Stderr`].
+    /// @see violet::subprocess::Child::StdoutLines
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") auto StderrLines(LineOptions options = { }) -> ChildLines;
+
+    /// Returns an iterator over the lines the child writes to both its stdout and its stderr, in
+    /// the order they arrive, which takes over both [`Child::Stdout`] and [`Child::Stderr`].
+    ///
+    /// @param options extra options for how lines are buffered, applied to each stream on its own.
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") auto Lines(LineOptions options = { }) -> ChildLines;
+
 #if VIOLET_PLATFORM(UNIX)
     /// Terminates the child process with a specific signal or `SIGKILL`.
     /// @param signal the signal to send to the child
@@ -369,6 +426,14 @@ struct VIOLET_API NOELDOC_SINCE("26.07") Command final {
     /// The child runs concurrently with the parent. Call [`Child::Wait()`] to
     /// block until the child exits and reap its exit status.
     ///
+    /// ## Platform-specific behaviour
+    /// On Linux, the program is looked up in `PATH` by the parent before the child is
+    /// created, like `execvp(3)` would: relative entries (and a program containing a `/`)
+    /// are taken relative to the configured working directory, if any. Whether a candidate
+    /// is executable is checked with `access(2)`, which uses the parent's real user and
+    /// group IDs rather than the ones set with [`ext::UID`] and [`ext::GID`]. A file
+    /// that the kernel refuses to execute with `ENOEXEC` is run through `/bin/sh`.
+    ///
     /// @returns a [`Child`] representing the running process, or an I/O error
     /// if the process could not be created (e.g., executable not found, permission
     /// denied, resource limits exceeded).
@@ -385,10 +450,18 @@ private:
 
     friend auto violet::subprocess::detail::SpawnAsForkExec(Command&) -> violet::io::Result<Child>;
 
+#if VIOLET_PLATFORM(LINUX)
+    friend auto violet::subprocess::detail::SpawnWithClone(Command&) -> violet::io::Result<Child>;
+    friend auto violet::subprocess::detail::SpawnPlanned(const Command&, const detail::SpawnPlan&)
+        -> violet::io::Result<Child>;
+#endif
+
 #if VIOLET_PLATFORM(APPLE_MACOS)
     friend auto violet::subprocess::detail::SpawnWithPosix(Command&) -> violet::io::Result<Child>;
 #endif
 
+    friend struct violet::subprocess::PreparedCommand;
+
     // TODO(@auguwu/Noel): switch to `Own<Impl>` once stablized
     Impl* n_impl = nullptr;
 };
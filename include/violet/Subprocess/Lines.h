@@ -0,0 +1,120 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/IO/Descriptor.h>
+#include <violet/IO/Error.h>
+#include <violet/Iterator.h>
+
+namespace violet::subprocess {
+
+struct Child;
+
+/// The standard stream of a child process that a [`ChildLine`] was read from.
+enum struct NOELDOC_SINCE("26.07.03") ChildStream : UInt8 {
+    Stdout, ///< the child's stdout
+    Stderr ///< the child's stderr
+};
+
+/// A single line that a child process wrote.
+struct NOELDOC_SINCE("26.07.03") ChildLine final {
+    /// The stream the line was read from.
+    ChildStream Stream;
+
+    /// The line itself, without its `\n` (or `\r\n`).
+    ///
+    /// It borrows the buffer of the [`ChildLines`] that yielded it and is only valid until the next
+    /// call to [`ChildLines::Next`].
+    Str Data;
+};
+
+/// Extra options for [`Child::StdoutLines`], [`Child::StderrLines`] and [`Child::Lines`].
+struct NOELDOC_SINCE("26.07.03") LineOptions final {
+    /// The most bytes a single line is buffered up to. A longer line is yielded in pieces of this
+    /// many bytes, so memory stays bounded no matter what the child writes.
+    UInt MaxLineLength = 64 * 1024;
+
+    /// Only yields the lines that were within the last `Tail` bytes of each stream, once that stream
+    /// was closed. Everything before that is read and thrown away as it arrives, so a stream of any
+    /// length is tailed in `O(Tail)` memory.
+    ///
+    /// A line that was cut off by the start of that window is left out, unless the window holds no
+    /// complete line at all.
+    Optional<UInt> Tail;
+};
+
+/// A [`Iterator`] over the lines a child process writes to its piped stdout, stderr, or both.
+///
+/// Lines are read through one buffer per stream that is reused for the whole iteration; every
+/// yielded [`ChildLine`] borrows from it rather than being copied out. When both streams are
+/// read, whichever has data is read as soon as it arrives, and lines are yielded from both in turn
+/// whenever both have one ready, so a chatty stream can neither starve the other nor stall the
+/// child on a full pipe.
+///
+/// A read error is yielded in place of a line; the stream it happened on isn't read any further.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Subprocess.h>
+///
+/// using namespace violet::subprocess;
+///
+/// auto child = VIOLET_TRY(Command("make").WithStdout(Stdio::Pipe()).WithStderr(Stdio::Pipe()).Spawn());
+/// for (auto line: child.Lines()) {
+///     if (line.Ok() && line->Stream == ChildStream::Stderr) {
+///         std::println(stderr, "{}", line->Data);
+///     }
+/// }
+///
+/// auto status = VIOLET_TRY(child.Wait());
+/// ```
+///
+/// ## Platform-specific behaviour
+/// This is only implemented on Unix. On every other platform, the first item is an error with
+/// [`io::ErrorKind::Unsupported`].
+struct VIOLET_API NOELDOC_SINCE("26.07.03") ChildLines final: public Iterator<ChildLines> {
+    VIOLET_DISALLOW_CONSTRUCTOR(ChildLines);
+    VIOLET_DISALLOW_COPY(ChildLines);
+    ~ChildLines();
+
+    VIOLET_IMPLICIT ChildLines(ChildLines&& other) noexcept;
+    auto operator=(ChildLines&& other) noexcept -> ChildLines&;
+
+    /// The item that is returned from the iterator.
+    using Item = io::Result<ChildLine>;
+
+    /// Returns the next line, blocking until one was written or every stream was closed.
+    VIOLET_API auto Next() noexcept -> Optional<Item>;
+
+private:
+    friend struct Child;
+
+    /// the buffers and descriptors of the streams being read.
+    struct Impl;
+
+    VIOLET_EXPLICIT ChildLines(io::FileDescriptor stdoutFd, io::FileDescriptor stderrFd, LineOptions options);
+
+    Impl* n_impl; ///< pointer to the implementation itself.
+};
+
+} // namespace violet::subprocess
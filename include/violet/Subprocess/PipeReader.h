@@ -33,13 +33,21 @@ namespace violet::subprocess {
 /// as [`Stdio::Pipe()`](violet::subprocess::Stdio::Pipe). Implementations are responsible for
 /// consuming data from the underlying file descriptor and buffering it for later retrival.
 ///
+/// A single reader can drain several pipes at once: every descriptor registered with
+/// [`PipeReader::Register(fd, sink)`] is multiplexed on the same event loop by
+/// [`PipeReader::Drain`], and its bytes are appended to its own sink as they arrive.
+///
 /// ## Example
 /// ```cpp
 /// #include <violet/Subprocess/PipeReader.h>
 ///
 /// struct AReader: public violet::subprocess::PipeReader {
-///     void Register(violet::io::FileDescriptor::value_type fd) noexcept override { /* ... */ }
-///     auto CaptureAll() const noexcept -> violet::io::Result<violet::Vec<violet::UInt8>> override { /*...*/ }
+///     auto Register(violet::io::FileDescriptor::value_type fd) -> violet::io::Result<void> override { /* ... */ }
+///     auto Register(violet::io::FileDescriptor::value_type fd, violet::Vec<violet::UInt8>& sink)
+///         -> violet::io::Result<void> override { /* ... */ }
+///
+///     auto Drain() -> violet::io::Result<void> override { /* ... */ }
+///     auto CaptureAll() const -> violet::io::Result<violet::Vec<violet::UInt8>> override { /*...*/ }
 /// };
 /// ```
 struct VIOLET_API NOELDOC_SINCE("26.07") PipeReader {
@@ -50,9 +58,38 @@ struct VIOLET_API NOELDOC_SINCE("26.07") PipeReader {
     /// Usually called once after the child process is spawned. Implementations should
     /// store `fd` and prepare to drain it (e.g. by spawning a reader thread or asynchronous I/O).
     ///
+    /// ## Remarks
+    /// Everything is captured into one buffer, so readers that keep reads in flight on
+    /// several pipes at once (`io_uring`) reject a second call; use
+    /// [`PipeReader::Register(fd, sink)`] to drain more than one pipe.
+    ///
     /// @param fd read end of the pipe connected to the child's standard output or error.
     [[nodiscard]] virtual auto Register(io::FileDescriptor::value_type fd) -> violet::io::Result<void> = 0;
 
+    /// Associate this reader with a pipe file descriptor whose bytes are appended to `sink`.
+    ///
+    /// Can be called several times with different descriptors; all of them are drained
+    /// together by a single [`PipeReader::Drain`] call. Each descriptor must be given its
+    /// own `sink`, and every `sink` must outlive the call to [`PipeReader::Drain`].
+    ///
+    /// @param fd read end of the pipe connected to the child's standard output or error.
+    /// @param sink buffer that receives everything read from `fd`.
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") virtual auto Register(
+        io::FileDescriptor::value_type fd, Vec<UInt8>& sink) -> violet::io::Result<void>
+        = 0;
+
+    /// Reads every registered descriptor until all of them reach end-of-file.
+    ///
+    /// Blocks the calling thread. Descriptors are waited on together, so a child that
+    /// fills one pipe while the other is not being read can never deadlock.
+    ///
+    /// ## Remarks
+    /// The event loop (`epoll`, `kqueue` or `io_uring`) is created once per thread and
+    /// reused by every reader drained on that thread, so short-lived readers don't pay its
+    /// setup cost. Reads are sized from the number of bytes the kernel reports as queued
+    /// (or the pipe's capacity), and land directly in the sink without a bounce buffer.
+    [[nodiscard]] NOELDOC_SINCE("26.07.03") virtual auto Drain() -> io::Result<void> = 0;
+
     /// Returns all bytes captured from the pipe so far.
     ///
     /// This method blocks until the pipe is drained (i.e. the write end is closed
@@ -0,0 +1,109 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Subprocess.h>
+
+namespace violet::subprocess {
+
+/// A [`Command`] that was compiled once so that it can be spawned over and over again cheaply.
+///
+/// Every [`Command::Spawn`] looks the program up in `PATH`, merges the command's environment
+/// with the parent's and flattens both into the blocks `execve(2)` takes. A `PreparedCommand`
+/// does all of that once: it keeps the program open so children can `execveat(2)` it without
+/// walking the path again, keeps `argv` and `envp` ready to be handed over as-is, and opens
+/// `/dev/null` once for every stream that asks for [`Stdio::Null`]. Between spawns, only the
+/// arguments that were replaced with [`PreparedCommand::WithArg`] change.
+///
+/// ## Remarks
+/// Unless the command has a [`ext::PreExec`] hook, the environment is captured when the command
+/// is prepared: changes made to the parent's environment afterwards aren't seen by its children. Streams that are piped into a file are
+/// still opened, and truncated, on every spawn.
+///
+/// Commands with a [`ext::PreExec`] hook are spawned with `fork(2)` exactly like
+/// [`Command::Spawn`] would, so preparing them saves nothing: the child still looks the
+/// program up in `PATH` and sees the parent's environment as it is at the time of the spawn.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Subprocess/PreparedCommand.h>
+///
+/// using namespace violet::subprocess;
+///
+/// auto command = Command("convert").WithArgs({ "<input>", "-resize", "50%", "<output>" });
+/// auto convert = VIOLET_TRY(PreparedCommand::New(command));
+///
+/// for (const auto& [input, output]: images) {
+///     auto status = VIOLET_TRY(convert.WithArg(0, input).WithArg(3, output).Status());
+///     // ...
+/// }
+/// ```
+///
+/// ## Platform-specific behaviour
+/// This is only implemented on Linux. [`PreparedCommand::New`] returns
+/// [`io::ErrorKind::Unsupported`] on every other platform.
+struct VIOLET_API NOELDOC_SINCE("26.07.03") PreparedCommand final {
+    VIOLET_DISALLOW_CONSTRUCTOR(PreparedCommand);
+    VIOLET_DISALLOW_COPY(PreparedCommand);
+    ~PreparedCommand();
+
+    VIOLET_IMPLICIT PreparedCommand(PreparedCommand&& other) noexcept;
+    auto operator=(PreparedCommand&& other) noexcept -> PreparedCommand&;
+
+    /// Compiles `command`, which is copied and can be changed or dropped afterwards.
+    ///
+    /// Fails like [`Command::Spawn`] would when the program can't be found.
+    static auto New(const Command& command) -> io::Result<PreparedCommand>;
+
+    /// Replaces an argument for every spawn that follows.
+    ///
+    /// @param index the position of the argument, where `0` is the first argument after the program.
+    ///              It has to be within the arguments the command was prepared with.
+    /// @param value the argument to pass instead.
+    auto WithArg(UInt index, Str value) -> PreparedCommand&;
+
+    /// Returns the argument at `index`, as it'll be passed to the next spawn.
+    [[nodiscard]] auto Arg(UInt index) const -> Str;
+
+    /// Returns the number of arguments, not counting the program.
+    [[nodiscard]] auto Args() const noexcept -> UInt;
+
+    /// Spawns the child process and collects its output, like [`Command::Output`].
+    [[nodiscard]] auto Output() -> io::Result<Output>;
+
+    /// Spawns the child process and waits for it to finish, like [`Command::Status`].
+    [[nodiscard]] auto Status() -> io::Result<ExitStatus>;
+
+    /// Spawns the child process and returns a [`Child`] handle immediately, like
+    /// [`Command::Spawn`].
+    [[nodiscard]] auto Spawn() -> io::Result<Child>;
+
+private:
+    /// the command together with its compiled spawn plan.
+    struct Impl;
+
+    VIOLET_EXPLICIT PreparedCommand(Impl* impl) noexcept;
+
+    Impl* n_impl; ///< pointer to the implementation itself.
+};
+
+} // namespace violet::subprocess
@@ -0,0 +1,122 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <violet/Container/Optional.h>
+#include <violet/Subprocess.h>
+
+#include <chrono>
+#include <functional>
+
+namespace violet::subprocess {
+
+/// A callback that is handed the result of a child watched by a [`Reactor`], once it has exited
+/// and everything it wrote into its piped streams was read.
+using ReactorCallback NOELDOC_SINCE("26.07.03") = std::function<void(io::Result<Output>)>;
+
+/// Waits on many children from a single thread.
+///
+/// Rather than blocking in [`Child::Wait`] and draining each child's pipes with its own reader,
+/// every child handed to a reactor is tracked on one event loop: its exit is observed through a
+/// process file descriptor (`pidfd_open(2)`), and its piped stdout and stderr are read as data
+/// arrives. Once a child has exited and both streams reached end-of-file, its callback is called
+/// with the same [`Output`] that [`Command::Output`] would have produced.
+///
+/// ## Remarks
+/// A `Reactor` is not thread-safe: children have to be handed to it, and it has to be polled, from
+/// the same thread. Callbacks run on that thread from within [`Reactor::Poll`] and may hand new
+/// children to the reactor.
+///
+/// A piped stdin is closed as soon as a child is watched, and [`Child::DeathTimeout`] is not
+/// enforced. Children that are still running when the reactor is destroyed are left running
+/// and are never waited on.
+///
+/// ## Example
+/// ```cpp
+/// #include <violet/Subprocess/Reactor.h>
+///
+/// using namespace violet::subprocess;
+///
+/// auto reactor = VIOLET_TRY(Reactor::New());
+/// for (const auto& unit: units) {
+///     auto command = Command("cc").WithArgs({ "-c", unit }).WithStderr(Stdio::Pipe());
+///     VIOLET_TRY(reactor.Spawn(command, [&](violet::io::Result<Output> output) -> void {
+///         // ...
+///     }));
+/// }
+///
+/// VIOLET_TRY_VOID(reactor.Run());
+/// ```
+///
+/// ## Platform-specific behaviour
+/// This is only implemented on Linux 5.3 or newer. [`Reactor::New`] returns
+/// [`io::ErrorKind::Unsupported`] on every other platform.
+struct VIOLET_API NOELDOC_SINCE("26.07.03") Reactor final {
+    VIOLET_DISALLOW_CONSTRUCTOR(Reactor);
+    VIOLET_DISALLOW_COPY(Reactor);
+    ~Reactor();
+
+    VIOLET_IMPLICIT Reactor(Reactor&& other) noexcept;
+    auto operator=(Reactor&& other) noexcept -> Reactor&;
+
+    /// Creates a new reactor that isn't watching any children yet.
+    static auto New() -> io::Result<Reactor>;
+
+    /// Spawns `command` and watches the child it started.
+    ///
+    /// @param command the command to spawn.
+    /// @param done called once the child has exited and its output was drained.
+    /// @returns the process identifier of the child that was spawned.
+    auto Spawn(Command& command, ReactorCallback done) -> io::Result<PID>;
+
+    /// Watches a child that was already spawned.
+    ///
+    /// @param child the child to watch; the reactor takes over its piped streams.
+    /// @param done called once the child has exited and its output was drained.
+    auto Watch(Child child, ReactorCallback done) -> io::Result<void>;
+
+    /// Waits for any of the watched children to make progress and calls the callbacks of those
+    /// that finished.
+    ///
+    /// Returns immediately when no children are being watched.
+    ///
+    /// @param timeout how long to wait at most, or [`violet::Nothing`] to wait indefinitely.
+    /// @returns the number of children that finished.
+    auto Poll(Optional<std::chrono::milliseconds> timeout = Nothing) -> io::Result<UInt>;
+
+    /// Calls [`Reactor::Poll`] until every watched child has finished, including children that
+    /// were handed to the reactor by callbacks along the way.
+    auto Run() -> io::Result<void>;
+
+    /// Returns the number of children that are being watched.
+    [[nodiscard]] auto Pending() const noexcept -> UInt;
+
+private:
+    /// the platform-specific event loop itself.
+    struct Impl;
+
+    VIOLET_EXPLICIT Reactor(Impl* impl) noexcept;
+
+    Impl* n_impl; ///< pointer to the implementation itself.
+};
+
+} // namespace violet::subprocess
@@ -95,6 +95,11 @@ struct VIOLET_API NOELDOC_SINCE("26.07") Stdio final {
     /// writes to the stream normally, but the data is captured into `path`
     /// rather than being surfaced as a handle to the parent.
     ///
+    /// The file is connected to the child's stream directly, so the output goes to disk without
+    /// ever passing through the parent. If the file can't be opened, [`Command::Spawn()`] fails
+    /// with the reason. To decide where the output goes only after spawning, use [`Pipe()`]
+    /// together with [`Child::TransferStdout`] or [`Child::TransferStderr`] instead.
+    ///
     /// @param path filesystem path of the file to receive the piped output. The file is created if it does
     /// not exist and truncated if it does.
     template<std::convertible_to<filesystem::PathRef> Path>
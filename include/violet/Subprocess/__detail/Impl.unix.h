@@ -30,6 +30,41 @@ namespace detail {
         violet::io::FileDescriptor::value_type stderrFd, Output& output);
 
     NOELDOC_HIDE VIOLET_LOCAL auto MakePipes(Int32 fds[2]) -> bool;
+
+    /// Drains `child`'s piped stdout and stderr on one reader and waits for it to exit.
+    NOELDOC_HIDE VIOLET_LOCAL auto CollectOutput(Child& child) -> violet::io::Result<Output>;
+
+    /// Closes every piped stream of `child` and waits for it to exit.
+    NOELDOC_HIDE VIOLET_LOCAL auto CollectStatus(Child& child) -> violet::io::Result<ExitStatus>;
+
+    /// Everything the child needs between being created and calling `execve(2)`, built up front
+    /// by the parent so that the child never has to allocate, take a lock, or look at `environ`.
+    ///
+    /// `Argv` and `Envp` point into `Arguments` and `Environment`; moving a plan keeps them valid,
+    /// copying it wouldn't.
+    struct VIOLET_LOCAL NOELDOC_HIDE SpawnPlan final {
+        VIOLET_IMPLICIT SpawnPlan() = default;
+        ~SpawnPlan() = default;
+
+        VIOLET_DISALLOW_COPY(SpawnPlan);
+        VIOLET_IMPLICIT_MOVE(SpawnPlan);
+
+        String Executable; ///< the program, already resolved against `PATH`
+        Vec<String> Arguments; ///< `argv[0]` and the arguments
+        Vec<String> Environment; ///< the parent's environment with the command's overrides, as `KEY=value`
+        Vec<CStr> Argv; ///< null-terminated pointers into `Arguments`
+        Vec<CStr> Envp; ///< null-terminated pointers into `Environment`
+        Optional<String> WorkingDirectory;
+        Array<Optional<String>, 3> Files; ///< the paths stdin, stdout and stderr are piped into, if any
+
+        /// `Executable` opened with `O_PATH`, for the child to `execveat(2)`. Only kept by plans
+        /// that are spawned more than once.
+        violet::io::FileDescriptor Program;
+
+        /// `/dev/null`, opened once for every stream that asks for [`Stdio::Null`]. Only kept by
+        /// plans that are spawned more than once.
+        violet::io::FileDescriptor Null;
+    };
 } // namespace detail
 
 struct VIOLET_LOCAL NOELDOC_HIDE Command::Impl final {
@@ -37,6 +72,9 @@ struct VIOLET_LOCAL NOELDOC_HIDE Command::Impl final {
     VIOLET_IMPLICIT_COPY_AND_MOVE(Impl);
     ~Impl() = default;
 
+    /// Builds the [`detail::SpawnPlan`] for this command.
+    [[nodiscard]] auto Prepare() const -> violet::io::Result<detail::SpawnPlan>;
+
 private:
     friend struct violet::subprocess::Command;
     friend void violet::subprocess::ext::UID(violet::subprocess::Command&, uid_t);
@@ -46,6 +84,14 @@ private:
     friend void violet::subprocess::ext::PreExec(Command& command, ext::PreExecFun exec);
     friend auto violet::subprocess::detail::SpawnAsForkExec(Command&) -> violet::io::Result<Child>;
 
+#if VIOLET_PLATFORM(LINUX)
+    friend auto violet::subprocess::detail::SpawnWithClone(Command&) -> violet::io::Result<Child>;
+    friend auto violet::subprocess::detail::SpawnPlanned(const Command&, const detail::SpawnPlan&)
+        -> violet::io::Result<Child>;
+#endif
+
+    friend struct violet::subprocess::PreparedCommand;
+
 #if VIOLET_PLATFORM(APPLE_MACOS)
     friend auto violet::subprocess::detail::SpawnWithPosix(Command&) -> violet::io::Result<Child>;
 #endif
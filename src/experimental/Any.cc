@@ -33,14 +33,19 @@ Any::~Any()
 
 Any::Any(const Any& other) noexcept
     : n_vtable(other.n_vtable)
-    , n_size(other.n_size)
     , n_type(other.n_type)
 {
+    if (other.n_self == nullptr) {
+        return;
+    }
+
     // TODO(@auguwu/Noel): is there a way to do this at compile-time?
-    VIOLET_DEBUG_ASSERT(this->n_vtable.Clone != nullptr, "`Any` cannot be copyable if `T` was not non-copyable");
+    VIOLET_DEBUG_ASSERT(this->n_vtable->Clone != nullptr, "`Any` cannot be copyable if `T` was not non-copyable");
+
+    void* self = other.IsInline() ? static_cast<void*>(this->n_buffer)
+                                  : allocateOnHeap(this->n_vtable->Size, this->n_vtable->Align);
 
-    void* self = ::operator new(this->n_size);
-    this->n_self = this->n_vtable.Clone(other.n_self, self);
+    this->n_self = this->n_vtable->Clone(other.n_self, self);
 }
 
 auto Any::operator=(const Any& other) noexcept -> Any&
@@ -54,11 +59,16 @@ auto Any::operator=(const Any& other) noexcept -> Any&
 }
 
 Any::Any(Any&& other) noexcept
-    : n_self(std::exchange(other.n_self, nullptr))
-    , n_vtable(other.n_vtable)
-    , n_size(other.n_size)
+    : n_vtable(other.n_vtable)
     , n_type(other.n_type)
 {
+    if (other.IsInline()) {
+        this->n_vtable->Relocate(other.n_self, this->n_buffer);
+        this->n_self = this->n_buffer;
+        other.n_self = nullptr;
+    } else {
+        this->n_self = std::exchange(other.n_self, nullptr);
+    }
 }
 
 auto Any::operator=(Any&& other) noexcept -> Any&
@@ -66,10 +76,16 @@ auto Any::operator=(Any&& other) noexcept -> Any&
     if (this != &other) {
         this->destructObject();
 
-        this->n_self = std::exchange(other.n_self, nullptr);
         this->n_vtable = other.n_vtable;
-        this->n_size = other.n_size;
         this->n_type = other.n_type;
+
+        if (other.IsInline()) {
+            this->n_vtable->Relocate(other.n_self, this->n_buffer);
+            this->n_self = this->n_buffer;
+            other.n_self = nullptr;
+        } else {
+            this->n_self = std::exchange(other.n_self, nullptr);
+        }
     }
 
     return *this;
@@ -84,8 +100,8 @@ auto Any::TypeName() const noexcept -> String
 
 auto Any::ToString() const noexcept -> String
 {
-    if (this->n_vtable.ToString != nullptr) {
-        return this->n_vtable.ToString(this->n_self);
+    if (this->n_self != nullptr && this->n_vtable->ToString != nullptr) {
+        return this->n_vtable->ToString(this->n_self);
     }
 
 #if VIOLET_FEATURE(RTTI)
@@ -95,11 +111,35 @@ auto Any::ToString() const noexcept -> String
 #endif
 }
 
+auto Any::allocateOnHeap(UInt size, UInt align) -> void*
+{
+    if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return ::operator new(size, std::align_val_t{ align });
+    }
+
+    return ::operator new(size);
+}
+
+void Any::deallocateOnHeap(void* ptr, UInt size, UInt align) noexcept
+{
+    if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(ptr, size, std::align_val_t{ align });
+        return;
+    }
+
+    ::operator delete(ptr, size);
+}
+
 void Any::destructObject()
 {
     if (this->n_self != nullptr) {
-        if (this->n_vtable.Destruct != nullptr) {
-            this->n_vtable.Destruct(this->n_self);
+        bool isInline = this->IsInline();
+        if (this->n_vtable->Destruct != nullptr) {
+            this->n_vtable->Destruct(this->n_self);
+        }
+
+        if (!isInline) {
+            deallocateOnHeap(this->n_self, this->n_vtable->Size, this->n_vtable->Align);
         }
 
         this->n_self = nullptr;
@@ -26,7 +26,6 @@
 #include <violet/Filesystem.h>
 #include <violet/Filesystem/Experimental/Dir.h>
 
-#include <dirent.h>
 #include <fcntl.h>
 #include <unistd.h>
 
@@ -73,20 +72,13 @@ auto Dir::Metadata() const -> io::Result<struct Metadata>
 
 auto Dir::Iter(Path display) const -> io::Result<Dirs>
 {
-    io::FileDescriptor copy = ::fcntl(this->n_fd.Get(), F_DUPFD_CLOEXEC, 0);
-    if (!copy.Valid()) {
+    // the iterator takes ownership of the duplicated descriptor
+    const Int32 copy = ::fcntl(this->n_fd.Get(), F_DUPFD_CLOEXEC, 0);
+    if (copy < 0) {
         return Err(io::Error::OSError());
     }
 
-    DIR* dir = ::fdopendir(copy.Get());
-    if (dir == nullptr) {
-        auto saved = errno;
-        copy.Close();
-
-        return Err(io::Error::FromOSError(saved));
-    }
-
-    return Dirs(display, VIOLET_MOVE(copy), dir);
+    return Dirs::fromDescriptor(copy, VIOLET_MOVE(display));
 }
 
 auto Dir::Walk(Path display) const -> io::Result<WalkDirs>
@@ -96,15 +88,7 @@ auto Dir::Walk(Path display) const -> io::Result<WalkDirs>
         return Err(io::Error::OSError());
     }
 
-    DIR* stream = ::fdopendir(fd);
-    if (stream == nullptr) {
-        auto saved = errno;
-        ::close(fd);
-
-        return Err(io::Error::FromOSError(saved));
-    }
-
-    return WalkDirs::fromRootStream(stream, VIOLET_MOVE(display));
+    return WalkDirs::fromDescriptor(fd, VIOLET_MOVE(display));
 }
 
 auto Dir::Alive() const -> bool
@@ -0,0 +1,877 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/Violet.h>
+
+#if VIOLET_PLATFORM(UNIX)
+
+#include <violet/Filesystem/Experimental/Tree.h>
+#include <violet/Filesystem/Extensions/XAttr.h>
+#include <violet/Filesystem/File.h>
+#include <violet/Filesystem/__detail/Copy.unix.h>
+#include <violet/Filesystem/__detail/DirStream.unix.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <deque>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+using violet::Array;
+using violet::Condvar;
+using violet::CStr;
+using violet::Err;
+using violet::Int32;
+using violet::Mutex;
+using violet::Nothing;
+using violet::Optional;
+using violet::SharedPtr;
+using violet::Str;
+using violet::String;
+using violet::UInt;
+using violet::UInt64;
+using violet::Vec;
+using violet::filesystem::DirEntry;
+using violet::filesystem::File;
+using violet::filesystem::FileType;
+using violet::filesystem::PathRef;
+using violet::filesystem::experimental::CopyTreeOptions;
+using violet::filesystem::experimental::RemoveAllDirsOptions;
+using violet::filesystem::experimental::TreeProgress;
+using violet::filesystem::experimental::TreeProgressFn;
+
+struct violet::filesystem::experimental::tree final {
+    using stream = DirEntry::stream;
+};
+
+namespace {
+
+using stream = violet::filesystem::experimental::tree::stream;
+using violet::experimental::threading::CancellationToken;
+
+/// The number of non-directory entries a worker collects before it hands them to the others.
+constexpr UInt kBatchSize = 256;
+
+auto cancelled(const Optional<CancellationToken>& cancellation) -> bool
+{
+    return cancellation.HasValue() && cancellation.Value().RequestsCancellation();
+}
+
+/// A non-directory entry that is copied or removed as part of a batch.
+struct entry final {
+    String Name;
+    FileType Type;
+};
+
+/// Either reading the directory `Dir` when `Entries` is empty, or a batch of its non-directory entries.
+template<typename Node>
+struct task final {
+    SharedPtr<Node> Dir;
+    Vec<entry> Entries{ };
+};
+
+/// The queue that every worker pops its tasks off, along with the first error that stopped them and the
+/// counters that make up the [`TreeProgress`].
+template<typename Node>
+struct pool final {
+    std::atomic<UInt64> Files = 0;
+    std::atomic<UInt64> Directories = 0;
+    std::atomic<UInt64> Bytes = 0;
+
+    VIOLET_DISALLOW_COPY_AND_MOVE(pool);
+
+    pool() = default;
+    ~pool() = default;
+
+    [[nodiscard]] auto Stopped() const noexcept -> bool
+    {
+        return this->n_stopped.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] auto Snapshot() const noexcept -> TreeProgress
+    {
+        return { .Files = this->Files.load(std::memory_order_relaxed),
+            .Directories = this->Directories.load(std::memory_order_relaxed),
+            .Bytes = this->Bytes.load(std::memory_order_relaxed) };
+    }
+
+    /// Stops every worker. Only the first error is kept.
+    void Fail(violet::io::Error error)
+    {
+        {
+            std::lock_guard lock(this->n_mux);
+            if (!this->n_error.HasValue()) {
+                this->n_error = VIOLET_MOVE(error);
+            }
+
+            this->n_stopped.store(true, std::memory_order_release);
+        }
+
+        this->n_wakeup.notify_all();
+        this->n_done.notify_all();
+    }
+
+    void Push(Vec<task<Node>>& tasks)
+    {
+        if (tasks.empty()) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(this->n_mux);
+            this->n_outstanding += tasks.size();
+
+            // pushed in reverse, so that the first subdirectory is popped first
+            for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+                this->n_tasks.push_back(VIOLET_MOVE(*it));
+            }
+        }
+
+        if (tasks.size() == 1) {
+            this->n_wakeup.notify_one();
+        } else {
+            this->n_wakeup.notify_all();
+        }
+
+        tasks.clear();
+    }
+
+    /// Runs `process` on `threads` workers, starting with `root`, until every task is done or the first error.
+    /// Meanwhile, the calling thread reports the progress and watches the cancellation token.
+    template<typename Fn>
+    auto Run(task<Node> root, UInt threads, Fn& process, const Optional<CancellationToken>& cancellation,
+        const TreeProgressFn& progress, std::chrono::milliseconds interval) -> violet::io::Result<void>
+    {
+        if (cancelled(cancellation)) {
+            return Err(VIOLET_IO_ERROR(Interrupted, String, "operation was cancelled"));
+        }
+
+        {
+            std::lock_guard lock(this->n_mux);
+            this->n_outstanding = 1;
+            this->n_tasks.push_back(VIOLET_MOVE(root));
+        }
+
+        Vec<std::thread> workers;
+        for (UInt i = 0; i < threads; i++) {
+            workers.emplace_back([this, &process] -> void { this->work(process); });
+        }
+
+        interval = std::max(interval, std::chrono::milliseconds(1));
+        auto polling = cancellation.HasValue() || progress != nullptr;
+        {
+            std::unique_lock lock(this->n_mux);
+            while (this->n_outstanding > 0 && !this->Stopped()) {
+                if (!polling) {
+                    this->n_done.wait(lock);
+                    continue;
+                }
+
+                this->n_done.wait_for(lock, interval);
+                if (cancelled(cancellation)) {
+                    if (!this->n_error.HasValue()) {
+                        this->n_error = VIOLET_IO_ERROR(Interrupted, String, "operation was cancelled");
+                    }
+
+                    break;
+                }
+
+                if (progress != nullptr && this->n_outstanding > 0) {
+                    lock.unlock();
+                    progress(this->Snapshot());
+                    lock.lock();
+                }
+            }
+
+            // also what lets the idle workers go once everything was done
+            this->n_stopped.store(true, std::memory_order_release);
+        }
+
+        this->n_wakeup.notify_all();
+        for (auto& worker: workers) {
+            worker.join();
+        }
+
+        if (this->n_error.HasValue()) {
+            return Err(VIOLET_MOVE(this->n_error).Value());
+        }
+
+        return { };
+    }
+
+    /// Reports the final progress and returns it.
+    auto Finish(const TreeProgressFn& progress) const -> TreeProgress
+    {
+        auto done = this->Snapshot();
+        if (progress != nullptr) {
+            progress(done);
+        }
+
+        return done;
+    }
+
+private:
+    Mutex n_mux; ///< guards everything below.
+    Condvar n_wakeup; ///< signalled when there's a task to pop or once we stopped.
+    Condvar n_done; ///< signalled when the last task is done or on the first error.
+    std::deque<task<Node>> n_tasks;
+    UInt n_outstanding = 0; ///< tasks that were queued but not finished yet.
+    std::atomic<bool> n_stopped = false;
+    Optional<violet::io::Error> n_error;
+
+    auto pop() -> Optional<task<Node>>
+    {
+        std::unique_lock lock(this->n_mux);
+        this->n_wakeup.wait(lock, [this] -> bool { return this->Stopped() || !this->n_tasks.empty(); });
+        if (this->Stopped()) {
+            return Nothing;
+        }
+
+        task<Node> next = VIOLET_MOVE(this->n_tasks.back());
+        this->n_tasks.pop_back();
+
+        return next;
+    }
+
+    template<typename Fn>
+    void work(Fn& process)
+    {
+        while (true) {
+            {
+                auto job = this->pop();
+                if (!job.HasValue()) {
+                    return;
+                }
+
+                process(job.Value());
+            }
+
+            bool last = false;
+            {
+                std::lock_guard lock(this->n_mux);
+                last = --this->n_outstanding == 0;
+            }
+
+            if (last) {
+                this->n_done.notify_all();
+            }
+        }
+    }
+};
+
+auto workerCount(UInt requested) -> UInt
+{
+    return requested != 0 ? requested : std::max<UInt>(std::thread::hardware_concurrency(), 1);
+}
+
+auto timesOf(const struct stat& st) -> Array<struct timespec, 2>
+{
+#if VIOLET_PLATFORM(APPLE_MACOS)
+    return { st.st_atimespec, st.st_mtimespec };
+#else
+    return { st.st_atim, st.st_mtim };
+#endif
+}
+
+/// Whether `error` is the destination refusing an extended attribute rather than an actual failure.
+auto refused(const violet::io::Error& error) -> bool
+{
+    if (error.Kind() == violet::io::ErrorKind::Unsupported) {
+        return true;
+    }
+
+    auto raw = error.RawOSError();
+    return raw.HasValue() && (raw.Value() == EPERM || raw.Value() == ENOTSUP || raw.Value() == EOPNOTSUPP);
+}
+
+auto copyXAttrs(Int32 in, Int32 out) -> violet::io::Result<void>
+{
+    auto attributes = violet::filesystem::xattr::List(in);
+    if (attributes.Err()) {
+        if (refused(attributes.Error())) {
+            return { };
+        }
+
+        return Err(VIOLET_MOVE(attributes.Error()));
+    }
+
+    while (auto next = attributes->Next()) {
+        if (next->Err()) {
+            return Err(VIOLET_MOVE(next->Error()));
+        }
+
+        const auto& [key, value] = next->Value();
+        if (auto res = violet::filesystem::xattr::Set(out, key, value); res.Err() && !refused(res.Error())) {
+            return res;
+        }
+    }
+
+    return { };
+}
+
+/// Copies the ownership of an entry; not being allowed to is only an error for the superuser.
+auto chownAt(Int32 dir, CStr name, const struct stat& st) -> violet::io::Result<void>
+{
+    if (::fchownat(dir, name, st.st_uid, st.st_gid, AT_SYMLINK_NOFOLLOW) < 0 && errno != EPERM) {
+        return Err(violet::io::Error::OSError());
+    }
+
+    return { };
+}
+
+/// A directory that is being copied.
+struct copy_dir final {
+    /// the directory that `Name` is opened relative to, dropped once it was.
+    SharedPtr<copy_dir> Parent;
+    String Name;
+
+    /// the path relative to both roots, for the directories whose metadata is applied at the end.
+    String Relative;
+
+    SharedPtr<stream> Source;
+    violet::io::FileDescriptor Destination;
+};
+
+/// A directory whose permissions, and maybe ownership and times, are applied once everything in it was copied.
+struct deferred_dir final {
+    String Relative;
+    struct stat Stat;
+};
+
+struct copier final {
+    pool<copy_dir>& Pool;
+    const CopyTreeOptions& Options;
+
+    /// the destination root, which is skipped if it's inside of the source.
+    dev_t RootDevice;
+    ino_t RootInode;
+
+    Mutex Mux{ }; ///< guards `Deferred`.
+    Vec<deferred_dir> Deferred{ };
+
+    void operator()(task<copy_dir>& job)
+    {
+        if (job.Entries.empty()) {
+            this->list(job.Dir);
+            return;
+        }
+
+        this->copyEntries(*job.Dir, job.Entries);
+    }
+
+    void Defer(String relative, const struct stat& st)
+    {
+        // a directory we can't write into can only be made that way once it was filled in
+        if (!this->Options.PreserveMetadata && (st.st_mode & S_IRWXU) == S_IRWXU) {
+            return;
+        }
+
+        std::lock_guard lock(this->Mux);
+        this->Deferred.push_back({ .Relative = VIOLET_MOVE(relative), .Stat = st });
+    }
+
+    /// Applies the metadata of every deferred directory, the deepest first, so that a directory only becomes
+    /// read-only or gets its times back after everything below it was done.
+    auto Finish(Int32 root) -> violet::io::Result<void>
+    {
+        std::ranges::sort(this->Deferred, std::greater{ }, [](const deferred_dir& dir) -> UInt {
+            return static_cast<UInt>(std::ranges::count(dir.Relative, '/'))
+                + static_cast<UInt>(dir.Relative != ".");
+        });
+
+        for (const auto& dir: this->Deferred) {
+            CStr path = dir.Relative.c_str();
+            auto mode = dir.Stat.st_mode & 07777;
+
+            if (this->Options.PreserveMetadata) {
+                VIOLET_TRY_VOID(chownAt(root, path, dir.Stat));
+            } else {
+                // keep whatever the umask did to the group and others, only the owner's bits were forced
+                struct stat created{ };
+                if (::fstatat(root, path, &created, AT_SYMLINK_NOFOLLOW) < 0) {
+                    return Err(violet::io::Error::OSError());
+                }
+
+                mode = (created.st_mode & 07777 & ~S_IRWXU) | (dir.Stat.st_mode & S_IRWXU);
+            }
+
+            if (::fchmodat(root, path, mode, 0) < 0) {
+                return Err(violet::io::Error::OSError());
+            }
+
+            if (this->Options.PreserveMetadata) {
+                auto times = timesOf(dir.Stat);
+                if (::utimensat(root, path, times.data(), AT_SYMLINK_NOFOLLOW) < 0) {
+                    return Err(violet::io::Error::OSError());
+                }
+            }
+        }
+
+        return { };
+    }
+
+private:
+    void list(const SharedPtr<copy_dir>& dir)
+    {
+        thread_local stream::buffer_type spare{ };
+
+        auto& node = *dir;
+        if (node.Source == nullptr) {
+            if (auto res = this->open(node, spare); res.Err()) {
+                this->Pool.Fail(VIOLET_MOVE(res.Error()));
+                return;
+            }
+        }
+
+        Vec<task<copy_dir>> tasks;
+        Vec<entry> files;
+        while (!this->Pool.Stopped()) {
+            auto next = node.Source->Next();
+            if (next.Err()) {
+                this->Pool.Fail(VIOLET_MOVE(next.Error()));
+                return;
+            }
+
+            if (!next->HasValue()) {
+                spare = node.Source->TakeBuffer();
+                break;
+            }
+
+            const auto& raw = next->Value();
+            if (raw.Type.Dir()) {
+                auto child = this->mkdir(dir, raw.Name);
+                if (child.Err()) {
+                    this->Pool.Fail(VIOLET_MOVE(child.Error()));
+                    return;
+                }
+
+                if (*child != nullptr) {
+                    tasks.push_back({ .Dir = VIOLET_MOVE(*child) });
+                }
+
+                continue;
+            }
+
+            files.push_back({ .Name = String(raw.Name), .Type = raw.Type });
+            if (files.size() == kBatchSize) {
+                tasks.push_back({ .Dir = dir, .Entries = VIOLET_MOVE(files) });
+                files.clear();
+            }
+        }
+
+        this->Pool.Push(tasks);
+        this->copyEntries(node, files);
+    }
+
+    auto open(copy_dir& node, stream::buffer_type& spare) -> violet::io::Result<void>
+    {
+        constexpr Int32 flags = O_DIRECTORY | O_NOFOLLOW | O_RDONLY | O_CLOEXEC;
+
+        const Int32 in = ::openat(node.Parent->Source->Descriptor(), node.Name.c_str(), flags);
+        if (in < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        const Int32 out = ::openat(node.Parent->Destination.Get(), node.Name.c_str(), flags);
+        if (out < 0) {
+            auto saved = errno;
+            ::close(in);
+
+            return Err(violet::io::Error::FromOSError(saved));
+        }
+
+        node.Parent.reset();
+        node.Destination = violet::io::FileDescriptor(out);
+        node.Source = VIOLET_TRY(stream::Open(in, VIOLET_MOVE(spare)));
+
+        if (this->Options.PreserveXAttrs) {
+            return copyXAttrs(in, out);
+        }
+
+        return { };
+    }
+
+    auto mkdir(const SharedPtr<copy_dir>& parent, Str name) -> violet::io::Result<SharedPtr<copy_dir>>
+    {
+        auto child = std::make_shared<copy_dir>();
+        child->Parent = parent;
+        child->Name = String(name);
+        child->Relative = parent->Relative == "." ? child->Name : parent->Relative + "/" + child->Name;
+
+        struct stat st{ };
+        if (::fstatat(parent->Source->Descriptor(), child->Name.c_str(), &st, AT_SYMLINK_NOFOLLOW) < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        // don't copy the copy over and over again when `dst` is inside of `src`
+        if (st.st_dev == this->RootDevice && st.st_ino == this->RootInode) {
+            return SharedPtr<copy_dir>(nullptr);
+        }
+
+        if (::mkdirat(parent->Destination.Get(), child->Name.c_str(), (st.st_mode & 07777) | S_IRWXU) < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        this->Pool.Directories.fetch_add(1, std::memory_order_relaxed);
+        this->Defer(child->Relative, st);
+
+        return child;
+    }
+
+    void copyEntries(const copy_dir& node, const Vec<entry>& entries)
+    {
+        for (const auto& entry: entries) {
+            if (this->Pool.Stopped()) {
+                return;
+            }
+
+            if (auto res = this->copyEntry(node, entry); res.Err()) {
+                this->Pool.Fail(VIOLET_MOVE(res.Error()));
+                return;
+            }
+        }
+    }
+
+    auto copyEntry(const copy_dir& node, const entry& entry) -> violet::io::Result<void>
+    {
+        const Int32 src = node.Source->Descriptor();
+        const Int32 dst = node.Destination.Get();
+        CStr name = entry.Name.c_str();
+
+        if (entry.Type.File()) {
+            return this->copyFile(src, dst, name);
+        }
+
+        struct stat st{ };
+        if (::fstatat(src, name, &st, AT_SYMLINK_NOFOLLOW) < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        if (S_ISLNK(st.st_mode)) {
+            Array<char, PATH_MAX> target{ };
+            auto len = ::readlinkat(src, name, target.data(), target.size());
+            if (len < 0) {
+                return Err(violet::io::Error::OSError());
+            }
+
+            if (static_cast<UInt>(len) == target.size()) {
+                return Err(violet::io::Error::FromOSError(ENAMETOOLONG));
+            }
+
+            target[len] = '\0';
+            if (::symlinkat(target.data(), dst, name) < 0) {
+                return Err(violet::io::Error::OSError());
+            }
+        } else if (S_ISFIFO(st.st_mode) || S_ISCHR(st.st_mode) || S_ISBLK(st.st_mode)) {
+            if (::mknodat(dst, name, st.st_mode, st.st_rdev) < 0) {
+                return Err(violet::io::Error::OSError());
+            }
+        } else {
+            // sockets only exist as long as whoever bound them does, so there's nothing to copy
+            return { };
+        }
+
+        this->Pool.Files.fetch_add(1, std::memory_order_relaxed);
+        if (!this->Options.PreserveMetadata) {
+            return { };
+        }
+
+        VIOLET_TRY_VOID(chownAt(dst, name, st));
+        if (!S_ISLNK(st.st_mode) && ::fchmodat(dst, name, st.st_mode & 07777, 0) < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        auto times = timesOf(st);
+        if (::utimensat(dst, name, times.data(), AT_SYMLINK_NOFOLLOW) < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        return { };
+    }
+
+    auto copyFile(Int32 src, Int32 dst, CStr name) -> violet::io::Result<void>
+    {
+        const Int32 in = ::openat(src, name, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+        if (in < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        File input(violet::io::FileDescriptor{ in });
+
+        struct stat st{ };
+        if (::fstat(in, &st) < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        const Int32 out = ::openat(dst, name, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, st.st_mode & 07777);
+        if (out < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        File output(violet::io::FileDescriptor{ out });
+
+        auto copied = VIOLET_TRY(violet::filesystem::detail::CopyContents(input, output, st.st_size));
+        this->Pool.Bytes.fetch_add(copied, std::memory_order_relaxed);
+        this->Pool.Files.fetch_add(1, std::memory_order_relaxed);
+
+        // the attributes go first, as setting them needs write permission on the file itself
+        if (this->Options.PreserveXAttrs) {
+            VIOLET_TRY_VOID(copyXAttrs(in, out));
+        }
+
+        if (!this->Options.PreserveMetadata) {
+            return { };
+        }
+
+        if (::fchown(out, st.st_uid, st.st_gid) < 0 && errno != EPERM) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        if (::fchmod(out, st.st_mode & 07777) < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        auto times = timesOf(st);
+        if (::futimens(out, times.data()) < 0) {
+            return Err(violet::io::Error::OSError());
+        }
+
+        return { };
+    }
+};
+
+/// A directory that is being removed.
+struct remove_dir final {
+    /// the directory this one is removed from, once it's empty.
+    SharedPtr<remove_dir> Parent;
+    String Name;
+    SharedPtr<stream> Source;
+
+    /// the listing of this directory and every subdirectory or batch of it that isn't done yet. whoever drops
+    /// this to zero removes the directory.
+    std::atomic<UInt> Pending = 1;
+};
+
+struct remover final {
+    pool<remove_dir>& Pool;
+
+    void operator()(task<remove_dir>& job)
+    {
+        if (job.Entries.empty()) {
+            this->list(job.Dir);
+        } else {
+            this->unlinkEntries(*job.Dir, job.Entries);
+        }
+
+        this->release(VIOLET_MOVE(job.Dir));
+    }
+
+private:
+    void list(const SharedPtr<remove_dir>& dir)
+    {
+        thread_local stream::buffer_type spare{ };
+
+        auto& node = *dir;
+        if (node.Source == nullptr) {
+            const Int32 fd = ::openat(node.Parent->Source->Descriptor(), node.Name.c_str(),
+                O_DIRECTORY | O_NOFOLLOW | O_RDONLY | O_CLOEXEC);
+
+            if (fd < 0) {
+                this->Pool.Fail(violet::io::Error::OSError());
+                return;
+            }
+
+            auto opened = stream::Open(fd, VIOLET_MOVE(spare));
+            if (opened.Err()) {
+                this->Pool.Fail(VIOLET_MOVE(opened.Error()));
+                return;
+            }
+
+            node.Source = VIOLET_MOVE(*opened);
+        }
+
+        Vec<task<remove_dir>> tasks;
+        Vec<entry> files;
+        while (!this->Pool.Stopped()) {
+            auto next = node.Source->Next();
+            if (next.Err()) {
+                this->Pool.Fail(VIOLET_MOVE(next.Error()));
+                return;
+            }
+
+            if (!next->HasValue()) {
+                spare = node.Source->TakeBuffer();
+                break;
+            }
+
+            const auto& raw = next->Value();
+            if (raw.Type.Dir()) {
+                auto child = std::make_shared<remove_dir>();
+                child->Parent = dir;
+                child->Name = String(raw.Name);
+
+                node.Pending.fetch_add(1, std::memory_order_relaxed);
+                tasks.push_back({ .Dir = VIOLET_MOVE(child) });
+
+                continue;
+            }
+
+            files.push_back({ .Name = String(raw.Name), .Type = raw.Type });
+            if (files.size() == kBatchSize) {
+                node.Pending.fetch_add(1, std::memory_order_relaxed);
+                tasks.push_back({ .Dir = dir, .Entries = VIOLET_MOVE(files) });
+                files.clear();
+            }
+        }
+
+        this->Pool.Push(tasks);
+        this->unlinkEntries(node, files);
+    }
+
+    void unlinkEntries(const remove_dir& node, const Vec<entry>& entries)
+    {
+        for (const auto& entry: entries) {
+            if (this->Pool.Stopped()) {
+                return;
+            }
+
+            if (::unlinkat(node.Source->Descriptor(), entry.Name.c_str(), 0) < 0 && errno != ENOENT) {
+                this->Pool.Fail(violet::io::Error::OSError());
+                return;
+            }
+
+            this->Pool.Files.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// Drops one of `dir`'s pending tasks, and removes it (and maybe its parents after it) once it was the last.
+    void release(SharedPtr<remove_dir> dir)
+    {
+        while (dir != nullptr && dir->Pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            if (this->Pool.Stopped()) {
+                return;
+            }
+
+            dir->Source.reset();
+
+            // the root is removed by the caller, by its path
+            auto parent = VIOLET_MOVE(dir->Parent);
+            if (parent == nullptr) {
+                return;
+            }
+
+            if (::unlinkat(parent->Source->Descriptor(), dir->Name.c_str(), AT_REMOVEDIR) < 0 && errno != ENOENT) {
+                this->Pool.Fail(violet::io::Error::OSError());
+                return;
+            }
+
+            this->Pool.Directories.fetch_add(1, std::memory_order_relaxed);
+            dir = VIOLET_MOVE(parent);
+        }
+    }
+};
+
+auto openDir(PathRef path, Int32 flags) -> violet::io::Result<Int32>
+{
+    Int32 fd = -1;
+    if (path.WithCStr([&](CStr path) -> bool {
+            fd = ::open(path, flags);
+            return fd < 0;
+        })) {
+        return Err(violet::io::Error::OSError());
+    }
+
+    return fd;
+}
+
+} // namespace
+
+auto violet::filesystem::experimental::CopyTree(PathRef src, PathRef dst, CopyTreeOptions options)
+    -> io::Result<TreeProgress>
+{
+    auto in = VIOLET_TRY(openDir(src, O_DIRECTORY | O_RDONLY | O_CLOEXEC));
+
+    auto root = std::make_shared<copy_dir>();
+    root->Relative = ".";
+    root->Source = VIOLET_TRY(stream::Open(in));
+
+    struct stat st{ };
+    if (::fstat(in, &st) < 0) {
+        return Err(io::Error::OSError());
+    }
+
+    if (dst.WithCStr([&](CStr path) -> bool { return ::mkdir(path, (st.st_mode & 07777) | S_IRWXU) < 0; })) {
+        return Err(io::Error::OSError());
+    }
+
+    auto out = VIOLET_TRY(openDir(dst, O_DIRECTORY | O_NOFOLLOW | O_RDONLY | O_CLOEXEC));
+    root->Destination = io::FileDescriptor(out);
+
+    struct stat created{ };
+    if (::fstat(out, &created) < 0) {
+        return Err(io::Error::OSError());
+    }
+
+    if (options.PreserveXAttrs) {
+        VIOLET_TRY_VOID(copyXAttrs(in, out));
+    }
+
+    pool<copy_dir> workers;
+    workers.Directories.store(1, std::memory_order_relaxed);
+
+    copier copy{ .Pool = workers, .Options = options, .RootDevice = created.st_dev, .RootInode = created.st_ino };
+    copy.Defer(".", st);
+
+    VIOLET_TRY_VOID(workers.Run({ .Dir = root }, workerCount(options.Threads), copy, options.Cancellation,
+        options.Progress, options.ProgressInterval));
+
+    VIOLET_TRY_VOID(copy.Finish(out));
+    return workers.Finish(options.Progress);
+}
+
+auto violet::filesystem::experimental::RemoveAllDirs(PathRef path, RemoveAllDirsOptions options)
+    -> io::Result<TreeProgress>
+{
+    auto fd = VIOLET_TRY(openDir(path, O_DIRECTORY | O_NOFOLLOW | O_RDONLY | O_CLOEXEC));
+
+    auto root = std::make_shared<remove_dir>();
+    root->Source = VIOLET_TRY(stream::Open(fd));
+
+    pool<remove_dir> workers;
+    remover remove{ .Pool = workers };
+
+    VIOLET_TRY_VOID(workers.Run({ .Dir = VIOLET_MOVE(root) }, workerCount(options.Threads), remove,
+        options.Cancellation, options.Progress, options.ProgressInterval));
+
+    if (path.WithCStr([](CStr path) -> bool { return ::rmdir(path) < 0; })) {
+        return Err(io::Error::OSError());
+    }
+
+    workers.Directories.fetch_add(1, std::memory_order_relaxed);
+    return workers.Finish(options.Progress);
+}
+
+#endif
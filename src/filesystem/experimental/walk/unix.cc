@@ -0,0 +1,516 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/Violet.h>
+
+#if VIOLET_PLATFORM(UNIX)
+
+#include <violet/Filesystem/Experimental/ParallelWalkDir.h>
+#include <violet/Filesystem/__detail/DirStream.unix.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <fcntl.h>
+#include <thread>
+
+using violet::filesystem::DirEntry;
+using violet::filesystem::PathRef;
+using violet::filesystem::experimental::ParallelWalkDirs;
+using violet::filesystem::experimental::ParallelWalkOptions;
+using violet::filesystem::experimental::WalkOrder;
+
+struct ParallelWalkDirs::Impl final {
+    /// The listing of a single directory, filled in by whichever worker read it.
+    struct batch final {
+        SharedPtr<const struct filesystem::Path> Path;
+        Vec<DirEntry> Entries;
+
+        /// aligned with `Entries`, the listing of every entry that is a directory. only kept
+        /// for ordered walks, where the consumer descends through them.
+        Vec<SharedPtr<batch>> Children;
+
+        /// the error that stopped this directory from being read, yielded after its entries.
+        Optional<io::Error> Error;
+
+        /// set once a worker is done with this batch, guarded by `n_resultsMux`.
+        bool Done = false;
+    };
+
+    /// A directory that still needs to be read.
+    struct task final {
+        SharedPtr<batch> Batch;
+
+        /// the directory stream `Name` is opened relative to, or the already opened stream for the root.
+        SharedPtr<DirEntry::stream> Stream;
+        String Name{ };
+    };
+
+    /// The queue each worker pushes the directories it discovers onto and pops from.
+    struct worker final {
+        Mutex Mux;
+        std::deque<task> Tasks;
+
+        /// the read buffer handed from one directory to the next on this thread.
+        DirEntry::stream::buffer_type Spare{ };
+    };
+
+    VIOLET_DISALLOW_COPY_AND_MOVE(Impl);
+
+    VIOLET_EXPLICIT Impl(SharedPtr<DirEntry::stream> root, Path base, UInt threads, ParallelWalkOptions options)
+        : n_order(options.Order)
+        , n_cancellation(VIOLET_MOVE(options.Cancellation))
+        , n_maxReady(threads * kReadyPerThread)
+    {
+        for (UInt i = 0; i < threads; i++) {
+            this->n_workers.push_back(std::make_unique<worker>());
+        }
+
+        auto listing = std::make_shared<batch>();
+        listing->Path = std::make_shared<const struct filesystem::Path>(VIOLET_MOVE(base));
+
+        // unordered walks pick up the root's listing from the ready queue like every other directory
+        if (this->n_order == WalkOrder::Ordered) {
+            this->n_stack.push_back({ .Batch = listing, .Index = 0 });
+        }
+
+        this->n_outstanding.store(1, std::memory_order_relaxed);
+        this->n_queued.store(1, std::memory_order_relaxed);
+        this->n_workers.front()->Tasks.push_back({ .Batch = VIOLET_MOVE(listing), .Stream = VIOLET_MOVE(root) });
+
+        for (UInt i = 0; i < threads; i++) {
+            this->n_threads.emplace_back([this, i] -> void { this->run(i); });
+        }
+    }
+
+    ~Impl()
+    {
+        this->stop();
+        for (auto& thread: this->n_threads) {
+            thread.join();
+        }
+    }
+
+    auto Next() -> Optional<ParallelWalkDirs::Item>
+    {
+        if (this->cancelled()) {
+            this->stop();
+        }
+
+        if (this->n_stopped.load(std::memory_order_acquire)) {
+            return Nothing;
+        }
+
+        return this->n_order == WalkOrder::Ordered ? this->nextOrdered() : this->nextUnordered();
+    }
+
+    void stop()
+    {
+        this->n_stopped.store(true, std::memory_order_release);
+
+        {
+            std::lock_guard lock(this->n_mux);
+        }
+
+        this->n_wakeup.notify_all();
+
+        {
+            std::lock_guard lock(this->n_resultsMux);
+        }
+
+        this->n_readyCV.notify_all();
+        this->n_spaceCV.notify_all();
+    }
+
+private:
+    static constexpr UInt kReadyPerThread = 64;
+    static constexpr UInt kCancellationCheckInterval = 1024;
+    static constexpr auto kCancellationPollInterval = std::chrono::milliseconds(10);
+
+    struct frame final {
+        SharedPtr<batch> Batch;
+        UInt Index;
+    };
+
+    WalkOrder n_order;
+    Optional<violet::experimental::threading::CancellationToken> n_cancellation;
+    Vec<UniquePtr<worker>> n_workers;
+    Vec<std::thread> n_threads;
+
+    Mutex n_mux; ///< guards sleeping and waking up idle workers.
+    Condvar n_wakeup;
+    std::atomic<UInt> n_queued = 0; ///< tasks sitting in any worker's queue.
+    std::atomic<UInt> n_sleeping = 0; ///< workers waiting on `n_wakeup`.
+    std::atomic<UInt> n_outstanding = 0; ///< tasks that were queued but not finished yet.
+    std::atomic<bool> n_stopped = false;
+
+    Mutex n_resultsMux; ///< guards `n_ready` and every batch's `Done` flag.
+    Condvar n_readyCV;
+    Condvar n_spaceCV;
+    std::deque<SharedPtr<batch>> n_ready;
+    UInt n_maxReady;
+
+    // consumer-side state, only touched by the thread calling `Next`
+    SharedPtr<batch> n_current; ///< unordered: the batch entries are yielded from.
+    UInt n_index = 0;
+    Vec<frame> n_stack; ///< ordered: the batches we're descending through.
+
+    [[nodiscard]] auto cancelled() const noexcept -> bool
+    {
+        return this->n_cancellation.HasValue() && this->n_cancellation.Value().RequestsCancellation();
+    }
+
+    /// Waits on `cv` until `ready` returns true. When there's a cancellation token to watch, this
+    /// wakes up periodically to check on it, as nothing would notify us otherwise.
+    template<typename Pred>
+    auto waitOn(Condvar& cv, std::unique_lock<Mutex>& lock, Pred ready) -> bool
+    {
+        while (!ready()) {
+            if (this->n_stopped.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            if (!this->n_cancellation.HasValue()) {
+                cv.wait(lock);
+                continue;
+            }
+
+            if (this->cancelled()) {
+                lock.unlock();
+                this->stop();
+                lock.lock();
+
+                return false;
+            }
+
+            cv.wait_for(lock, kCancellationPollInterval);
+        }
+
+        return true;
+    }
+
+    auto nextUnordered() -> Optional<ParallelWalkDirs::Item>
+    {
+        while (true) {
+            if (this->n_current != nullptr) {
+                auto& entries = this->n_current->Entries;
+                if (this->n_index < entries.size()) {
+                    return VIOLET_MOVE(entries[this->n_index++]);
+                }
+
+                auto error = VIOLET_MOVE(this->n_current->Error);
+                this->n_current.reset();
+                this->n_index = 0;
+
+                if (error.HasValue()) {
+                    return Err(VIOLET_MOVE(error).Value());
+                }
+            }
+
+            std::unique_lock lock(this->n_resultsMux);
+            auto ready = this->waitOn(this->n_readyCV, lock, [this] -> bool {
+                return !this->n_ready.empty() || this->n_outstanding.load(std::memory_order_acquire) == 0;
+            });
+
+            if (!ready || this->n_ready.empty()) {
+                return Nothing;
+            }
+
+            this->n_current = VIOLET_MOVE(this->n_ready.front());
+            this->n_ready.pop_front();
+
+            lock.unlock();
+            this->n_spaceCV.notify_one();
+        }
+    }
+
+    auto nextOrdered() -> Optional<ParallelWalkDirs::Item>
+    {
+        while (!this->n_stack.empty()) {
+            auto listing = this->n_stack.back().Batch;
+            {
+                std::unique_lock lock(this->n_resultsMux);
+                if (!this->waitOn(this->n_readyCV, lock, [&] -> bool { return listing->Done; })) {
+                    return Nothing;
+                }
+            }
+
+            auto index = this->n_stack.back().Index;
+            if (index < listing->Entries.size()) {
+                this->n_stack.back().Index++;
+                if (auto child = VIOLET_MOVE(listing->Children[index]); child != nullptr) {
+                    this->n_stack.push_back({ .Batch = VIOLET_MOVE(child), .Index = 0 });
+                }
+
+                return VIOLET_MOVE(listing->Entries[index]);
+            }
+
+            this->n_stack.pop_back();
+            if (listing->Error.HasValue()) {
+                return Err(VIOLET_MOVE(listing->Error).Value());
+            }
+        }
+
+        return Nothing;
+    }
+
+    void run(UInt self)
+    {
+        while (true) {
+            auto task = this->pop(self);
+            if (task.HasValue()) {
+                this->process(self, VIOLET_MOVE(task).Value());
+                continue;
+            }
+
+            std::unique_lock lock(this->n_mux);
+            this->n_sleeping.fetch_add(1);
+            this->n_wakeup.wait(lock, [this] -> bool {
+                return this->n_stopped.load(std::memory_order_acquire) || this->n_queued.load() > 0
+                    || this->n_outstanding.load() == 0;
+            });
+
+            this->n_sleeping.fetch_sub(1);
+            if (this->n_stopped.load(std::memory_order_acquire) || this->n_outstanding.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    /// Pops the newest task off our own queue, or steals the oldest one from another worker.
+    auto pop(UInt self) -> Optional<task>
+    {
+        if (this->n_stopped.load(std::memory_order_acquire)) {
+            return Nothing;
+        }
+
+        {
+            auto& own = *this->n_workers[self];
+            std::lock_guard lock(own.Mux);
+            if (!own.Tasks.empty()) {
+                task next = VIOLET_MOVE(own.Tasks.back());
+                own.Tasks.pop_back();
+                this->n_queued.fetch_sub(1);
+
+                return next;
+            }
+        }
+
+        for (UInt i = 1; i < this->n_workers.size(); i++) {
+            auto& victim = *this->n_workers[(self + i) % this->n_workers.size()];
+            std::lock_guard lock(victim.Mux);
+            if (!victim.Tasks.empty()) {
+                task next = VIOLET_MOVE(victim.Tasks.front());
+                victim.Tasks.pop_front();
+                this->n_queued.fetch_sub(1);
+
+                return next;
+            }
+        }
+
+        return Nothing;
+    }
+
+    void push(UInt self, Vec<task>& tasks)
+    {
+        if (tasks.empty()) {
+            return;
+        }
+
+        this->n_outstanding.fetch_add(tasks.size());
+        {
+            auto& own = *this->n_workers[self];
+            std::lock_guard lock(own.Mux);
+
+            // pushed in reverse, so that we pop the first subdirectory first and roughly walk the tree in the
+            // order an ordered walk consumes it
+            for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+                own.Tasks.push_back(VIOLET_MOVE(*it));
+            }
+        }
+
+        this->n_queued.fetch_add(tasks.size());
+        if (this->n_sleeping.load() > 0) {
+            {
+                std::lock_guard lock(this->n_mux);
+            }
+
+            this->n_wakeup.notify_all();
+        }
+
+        tasks.clear();
+    }
+
+    void process(UInt self, task job)
+    {
+        auto& state = *this->n_workers[self];
+        auto& listing = *job.Batch;
+
+        Vec<task> subdirs;
+        if (this->cancelled()) {
+            this->stop();
+        } else if (auto stream = this->open(state, job); stream.Err()) {
+            listing.Error = VIOLET_MOVE(stream.Error());
+        } else {
+            UInt read = 0;
+            while (true) {
+                if (++read % kCancellationCheckInterval == 0 && this->cancelled()) {
+                    this->stop();
+                    break;
+                }
+
+                auto next = (*stream)->Next();
+                if (next.Err()) {
+                    listing.Error = VIOLET_MOVE(next.Error());
+                    break;
+                }
+
+                if (!next->HasValue()) {
+                    state.Spare = (*stream)->TakeBuffer();
+                    break;
+                }
+
+                const auto& raw = next->Value();
+                listing.Entries.push_back(DirEntry(listing.Path, raw.Name, raw.Type, *stream));
+
+                // symbolic links are reported as-is, so a link to a directory is never descended into
+                SharedPtr<batch> child;
+                if (raw.Type.Dir()) {
+                    child = std::make_shared<batch>();
+                    child->Path = std::make_shared<const struct filesystem::Path>(listing.Path->Join(raw.Name));
+
+                    subdirs.push_back({ .Batch = child, .Stream = *stream, .Name = String(raw.Name) });
+                }
+
+                if (this->n_order == WalkOrder::Ordered) {
+                    listing.Children.push_back(VIOLET_MOVE(child));
+                }
+            }
+        }
+
+        this->push(self, subdirs);
+        this->finish(VIOLET_MOVE(job.Batch));
+    }
+
+    auto open(worker& state, task& job) -> io::Result<SharedPtr<DirEntry::stream>>
+    {
+        if (job.Name.empty()) {
+            return VIOLET_MOVE(job.Stream);
+        }
+
+        const Int32 fd
+            = ::openat(job.Stream->Descriptor(), job.Name.c_str(), O_DIRECTORY | O_NOFOLLOW | O_RDONLY | O_CLOEXEC);
+
+        // the parent's descriptor can be closed as soon as all of its subdirectories were opened
+        job.Stream.reset();
+        if (fd < 0) {
+            return Err(io::Error::OSError());
+        }
+
+        return DirEntry::stream::Open(fd, VIOLET_MOVE(state.Spare));
+    }
+
+    void finish(SharedPtr<batch> listing)
+    {
+        std::unique_lock lock(this->n_resultsMux);
+        if (this->n_order == WalkOrder::Unordered) {
+            this->waitOn(this->n_spaceCV, lock, [this] -> bool { return this->n_ready.size() < this->n_maxReady; });
+            if (!listing->Entries.empty() || listing->Error.HasValue()) {
+                this->n_ready.push_back(VIOLET_MOVE(listing));
+            }
+        } else {
+            listing->Done = true;
+        }
+
+        auto last = this->n_outstanding.fetch_sub(1) == 1;
+        lock.unlock();
+
+        this->n_readyCV.notify_one();
+        if (last) {
+            {
+                std::lock_guard guard(this->n_mux);
+            }
+
+            this->n_wakeup.notify_all();
+        }
+    }
+};
+
+template<typename... Args>
+ParallelWalkDirs::ParallelWalkDirs(Args&&... args)
+    : n_impl(new Impl(VIOLET_FWD(Args, args)...))
+{
+}
+
+ParallelWalkDirs::ParallelWalkDirs(ParallelWalkDirs&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+ParallelWalkDirs::~ParallelWalkDirs()
+{
+    if (this->n_impl != nullptr) {
+        delete this->n_impl;
+        this->n_impl = nullptr;
+    }
+}
+
+auto ParallelWalkDirs::Next() noexcept -> Optional<ParallelWalkDirs::Item>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    return this->n_impl->Next();
+}
+
+void ParallelWalkDirs::StopTraversing()
+{
+    if (this->n_impl != nullptr) {
+        this->n_impl->stop();
+    }
+}
+
+auto ParallelWalkDirs::fromDescriptor(Int32 fd, Path base, UInt threads, ParallelWalkOptions options)
+    -> io::Result<ParallelWalkDirs>
+{
+    auto root = VIOLET_TRY(DirEntry::stream::Open(fd));
+    return ParallelWalkDirs(VIOLET_MOVE(root), VIOLET_MOVE(base), threads, VIOLET_MOVE(options));
+}
+
+auto violet::filesystem::experimental::ParallelWalkDir(PathRef path, UInt threads, ParallelWalkOptions options)
+    -> io::Result<ParallelWalkDirs>
+{
+    Int32 fd = -1;
+    if (path.WithCStr([&](CStr path) -> bool {
+            fd = ::open(path, O_DIRECTORY | O_RDONLY | O_CLOEXEC);
+            return fd < 0;
+        })) {
+        return Err(io::Error::OSError());
+    }
+
+    if (threads == 0) {
+        threads = std::max<UInt>(std::thread::hardware_concurrency(), 1);
+    }
+
+    return ParallelWalkDirs::fromDescriptor(fd, path, threads, VIOLET_MOVE(options));
+}
+
+#endif
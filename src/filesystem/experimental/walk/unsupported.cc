@@ -0,0 +1,51 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/Filesystem/Experimental/ParallelWalkDir.h>
+
+using violet::filesystem::PathRef;
+using violet::filesystem::experimental::ParallelWalkDirs;
+using violet::filesystem::experimental::ParallelWalkOptions;
+
+struct ParallelWalkDirs::Impl final {
+    Impl() = delete;
+};
+
+ParallelWalkDirs::ParallelWalkDirs(ParallelWalkDirs&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+ParallelWalkDirs::~ParallelWalkDirs() = default;
+
+auto ParallelWalkDirs::Next() noexcept -> Optional<ParallelWalkDirs::Item>
+{
+    return Nothing;
+}
+
+void ParallelWalkDirs::StopTraversing() { }
+
+auto violet::filesystem::experimental::ParallelWalkDir(PathRef, UInt, ParallelWalkOptions)
+    -> io::Result<ParallelWalkDirs>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
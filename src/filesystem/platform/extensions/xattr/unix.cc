@@ -125,10 +125,14 @@ auto Iter::Next() noexcept -> Optional<Item>
 auto violet::filesystem::xattr::List(value_type fd) noexcept -> io::Result<Iter>
 {
     Int64 size = ::flistxattr(fd, nullptr, 0);
-    if (size <= 0) {
+    if (size < 0) {
         return Err(io::Error::OSError());
     }
 
+    if (size == 0) {
+        return Iter(new Iter::Impl(fd, { }));
+    }
+
     Vec<char> names(size);
     size = ::flistxattr(fd, names.data(), names.size());
 
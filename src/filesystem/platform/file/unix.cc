@@ -161,11 +161,59 @@ auto File::Write(Span<const UInt8> buf) const noexcept -> io::Result<UInt>
     return this->n_fd.Write(buf);
 }
 
+auto File::ReadAt(Span<UInt8> buf, UInt64 offset, Bitflags<io::IOFlag> flags) const noexcept -> io::Result<UInt>
+{
+    return this->n_fd.ReadAt(buf, offset, flags);
+}
+
+auto File::WriteAt(Span<const UInt8> buf, UInt64 offset, Bitflags<io::IOFlag> flags) const noexcept
+    -> io::Result<UInt>
+{
+    return this->n_fd.WriteAt(buf, offset, flags);
+}
+
+auto File::ReadVectored(Span<const Span<UInt8>> bufs) const noexcept -> io::Result<UInt>
+{
+    return this->n_fd.ReadVectored(bufs);
+}
+
+auto File::ReadVectoredAt(Span<const Span<UInt8>> bufs, UInt64 offset, Bitflags<io::IOFlag> flags) const noexcept
+    -> io::Result<UInt>
+{
+    return this->n_fd.ReadVectoredAt(bufs, offset, flags);
+}
+
+auto File::WriteVectored(Span<const Span<const UInt8>> bufs) const noexcept -> io::Result<UInt>
+{
+    return this->n_fd.WriteVectored(bufs);
+}
+
+auto File::WriteVectoredAt(Span<const Span<const UInt8>> bufs, UInt64 offset, Bitflags<io::IOFlag> flags) const noexcept
+    -> io::Result<UInt>
+{
+    return this->n_fd.WriteVectoredAt(bufs, offset, flags);
+}
+
 auto File::Flush() const noexcept -> io::Result<void>
 {
     return this->n_fd.Flush();
 }
 
+auto File::Sync() const noexcept -> io::Result<void>
+{
+    return this->n_fd.Sync();
+}
+
+auto File::SyncData() const noexcept -> io::Result<void>
+{
+    return this->n_fd.SyncData();
+}
+
+auto File::SyncRange(UInt64 offset, UInt64 length, bool wait) const noexcept -> io::Result<void>
+{
+    return this->n_fd.SyncRange(offset, length, wait);
+}
+
 auto File::MkScopedLock() const noexcept -> io::Result<ScopeLock>
 {
     auto result = this->Lock();
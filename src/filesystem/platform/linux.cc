@@ -27,44 +27,74 @@
 #include <violet/Filesystem/File.h>
 #include <violet/Filesystem/Metadata.h>
 #include <violet/Filesystem/Path.h>
+#include <violet/Filesystem/__detail/Copy.unix.h>
 
+#include <algorithm>
 #include <cerrno>
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
 #include <unistd.h>
 
+using violet::Array;
+using violet::Int64;
 using violet::Span;
 using violet::UInt;
 using violet::UInt64;
 using violet::UInt8;
+using violet::filesystem::File;
 using violet::filesystem::OpenOptions;
 using violet::filesystem::PathRef;
 
-auto violet::filesystem::Copy(PathRef src, PathRef dst) -> io::Result<UInt64>
+namespace {
+
+constexpr UInt kBufSize = 1 << 16; // 64KiB
+
+/// Whether `err` means that `copy_file_range(2)` is unusable for this pair of files: cross-filesystem
+/// copies on kernels < 5.3 fail with `EXDEV`, sandboxes that block the syscall report `ENOSYS`, and some
+/// filesystems / pseudo-files reject it with either EINVAL, EOPNOTSUPP, EPERM, or EBADF.
+auto copyFileRangeUnsupported(violet::Int32 err) -> bool
 {
-    auto in = VIOLET_TRY(File::Open(src, OpenOptions{ }.Read()));
+    return err == ENOSYS || err == EXDEV || err == EINVAL || err == EOPNOTSUPP || err == EPERM || err == EBADF;
+}
 
-    // Mirror the source's permission bits onto the destination, like `cp` does
-    auto mt = VIOLET_TRY(in.Metadata());
-    auto out = VIOLET_TRY(File::Open(dst, OpenOptions{ }.Create().Write().Truncate().Mode(mt.Permissions.Mode())));
+/// Copies `[offset, offset + length)` of `in` to the same offset in `out` with `pread(2)`/`pwrite(2)`.
+auto copyRangeThroughUserspace(const File& in, const File& out, UInt64 offset, UInt64 length)
+    -> violet::io::Result<void>
+{
+    Array<UInt8, kBufSize> buf{ };
+    while (length > 0) {
+        UInt read = VIOLET_TRY(in.ReadAt({ buf.data(), static_cast<UInt>(std::min<UInt64>(length, kBufSize)) }, offset));
+        if (read == 0) {
+            break;
+        }
 
-    UInt64 total = 0;
+        VIOLET_TRY(out.WriteAt({ buf.data(), read }, offset));
+        offset += read;
+        length -= read;
+    }
 
-    // Using `copy_file_range(2)` (ref: https://www.man7.org/linux/man-pages/man2/copy_file_range.2.html)
-    // is the fast-path on Linux (and Android if we plan on supporting it in the future). It lets the kernel
-    // copy in-place (reflinks, server-side copies, etc.). It is not always applicable though, cross-filesystem
-    // copies on kernels < 5.3 will fail with `EXDEV`, sandboxes that block the syscall report `ENOSYS`, and some
-    // filesystems / pseudo-files reject it with either EINVAL, EOPNOTSUPP, EPERM, or EBADF. If that's the case
-    // we fallthrough to the userspace read/write loop and resume from where we are.
-    while (true) {
+    return { };
+}
+
+/// Copies `[offset, offset + length)` of `in` to the same offset in `out`, letting the kernel do it with
+/// `copy_file_range(2)` (ref: https://www.man7.org/linux/man-pages/man2/copy_file_range.2.html) if it can.
+auto copyRange(const File& in, const File& out, UInt64 offset, UInt64 length) -> violet::io::Result<void>
+{
+    auto inOff = static_cast<loff_t>(offset);
+    auto outOff = static_cast<loff_t>(offset);
+
+    while (length > 0) {
         ssize_t bytes = copy_file_range(
             /*infd=*/in.Descriptor(),
-            /*pinoff=*/nullptr,
+            /*pinoff=*/&inOff,
             /*outfd=*/out.Descriptor(),
-            /*poutoff=*/nullptr,
-            /*length=*/1 << 20, // TODO(@auguwu): is 1MiB/chunk ok or should this be customizable?
+            /*poutoff=*/&outOff,
+            /*length=*/static_cast<UInt>(std::min<UInt64>(length, 1 << 30)),
             /*flags=*/0);
 
         if (bytes == 0) {
-            return total;
+            return { };
         }
 
         if (bytes < 0) {
@@ -72,19 +102,24 @@ auto violet::filesystem::Copy(PathRef src, PathRef dst) -> io::Result<UInt64>
                 continue;
             }
 
-            // `copy_file_range(2)` is unusable in this context; use userspace read/write loop instead
-            if (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP || errno == EPERM
-                || errno == EBADF) {
-                break;
+            if (copyFileRangeUnsupported(errno)) {
+                return copyRangeThroughUserspace(in, out, static_cast<UInt64>(inOff), length);
             }
 
-            return Err(io::Error::OSError());
+            return violet::Err(violet::io::Error::OSError());
         }
 
-        total += static_cast<UInt64>(bytes);
+        length -= static_cast<UInt64>(bytes);
     }
 
-    constexpr static auto kBufSize = 1 << 16; // 64KiB
+    return { };
+}
+
+/// Streams `in` into `out` until `read(2)` says it's done, for files that report a size of zero but
+/// still have contents (like most of procfs and sysfs).
+auto copyThroughUserspace(const File& in, const File& out) -> violet::io::Result<UInt64>
+{
+    UInt64 total = 0;
     Array<UInt8, kBufSize> buf{ };
     while (true) {
         UInt read = VIOLET_TRY(in.Read(buf));
@@ -103,4 +138,74 @@ auto violet::filesystem::Copy(PathRef src, PathRef dst) -> io::Result<UInt64>
     return total;
 }
 
+} // namespace
+
+auto violet::filesystem::Copy(PathRef src, PathRef dst) -> io::Result<UInt64>
+{
+    auto in = VIOLET_TRY(File::Open(src, OpenOptions{ }.Read()));
+
+    // Mirror the source's permission bits onto the destination, like `cp` does
+    auto mt = VIOLET_TRY(in.Metadata());
+    auto out = VIOLET_TRY(File::Open(dst, OpenOptions{ }.Create().Write().Truncate().Mode(mt.Permissions.Mode())));
+
+    return detail::CopyContents(in, out, mt.Size);
+}
+
+auto violet::filesystem::detail::CopyContents(const File& in, const File& out, UInt64 size) -> io::Result<UInt64>
+{
+    if (size == 0) {
+        return copyThroughUserspace(in, out);
+    }
+
+    // Reflinking shares the source's extents copy-on-write (btrfs, XFS, bcachefs, ...), so the copy is
+    // instant, takes no extra space and keeps the holes of sparse files as they are.
+    if (::ioctl(out.Descriptor(), FICLONE, in.Descriptor()) == 0) {
+        return size;
+    }
+
+    // Otherwise only copy the extents that hold data so that holes stay holes, and preallocate each of
+    // them so the destination doesn't fragment. The destination has to be sized up front as the source
+    // might end with a hole, which no write would ever reach.
+    if (::ftruncate(out.Descriptor(), static_cast<off_t>(size)) < 0) {
+        return Err(io::Error::OSError());
+    }
+
+    UInt64 offset = 0;
+    while (offset < size) {
+        Int64 data = ::lseek(in.Descriptor(), static_cast<off_t>(offset), SEEK_DATA);
+        if (data < 0) {
+            // `ENXIO`: there is no more data past `offset`, the rest is one big hole.
+            if (errno == ENXIO) {
+                break;
+            }
+
+            // the filesystem can't tell where its holes are; treat everything as data
+            if (errno != EINVAL && errno != EOPNOTSUPP) {
+                return Err(io::Error::OSError());
+            }
+
+            data = static_cast<Int64>(offset);
+        }
+
+        if (static_cast<UInt64>(data) >= size) {
+            break;
+        }
+
+        Int64 hole = ::lseek(in.Descriptor(), data, SEEK_HOLE);
+        auto end = hole < 0 ? size : std::min(static_cast<UInt64>(hole), size);
+        auto length = end - static_cast<UInt64>(data);
+
+        // preallocation is only a hint, but running out of space is better reported before copying anything
+        if (::fallocate(out.Descriptor(), FALLOC_FL_KEEP_SIZE, data, static_cast<off_t>(length)) < 0
+            && errno == ENOSPC) {
+            return Err(io::Error::OSError());
+        }
+
+        VIOLET_TRY_VOID(copyRange(in, out, static_cast<UInt64>(data), length));
+        offset = end;
+    }
+
+    return size;
+}
+
 #endif
@@ -24,6 +24,7 @@
 #if VIOLET_PLATFORM(APPLE_MACOS)
 
 #include <violet/Filesystem.h>
+#include <violet/Filesystem/__detail/Copy.unix.h>
 
 #include <sys/clonefile.h>
 
@@ -50,6 +51,11 @@ auto violet::filesystem::Copy(PathRef src, PathRef dst) -> io::Result<UInt64>
     }
 
     auto out = VIOLET_TRY(File::Open(dst, OpenOptions{ }.Create().Write().Truncate().Mode(mt.Permissions.Mode())));
+    return detail::CopyContents(in, out, mt.Size);
+}
+
+auto violet::filesystem::detail::CopyContents(const File& in, const File& out, UInt64) -> io::Result<UInt64>
+{
     UInt64 total = 0;
 
     constexpr static auto kBufSize = 1 << 16; // 64KiB
@@ -29,35 +29,112 @@
 #include <violet/Filesystem/Metadata.h>
 #include <violet/Filesystem/Path.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
+#include <thread>
 
+#ifndef VIOLET_FEATURE_LIBURING
+#define VIOLET_FEATURE_LIBURING 0
+#endif
+
+#if VIOLET_FEATURE(LIBURING)
+#include <liburing.h>
+#endif
+
+using violet::CStr;
+using violet::Int32;
+using violet::Span;
+using violet::String;
+using violet::UInt;
+using violet::UInt32;
 using violet::UInt64;
+using violet::Vec;
 using violet::filesystem::Metadata;
 using violet::filesystem::PathRef;
 using violet::filesystem::SymlinkResolution;
 using violet::io::FileDescriptor;
 using Perms = violet::filesystem::Permissions;
 
+using violet::filesystem::MetadataField;
+
 namespace {
 auto statxTimestampToMillis(const statx_timestamp& ts) -> UInt64
 {
     return (static_cast<UInt64>(ts.tv_sec) * 1000ULL) + (static_cast<UInt64>(ts.tv_nsec) / 1'000'000ULL);
 }
 
+auto statxMask(violet::Bitflags<MetadataField> fields) -> violet::UInt32
+{
+    // the file type is needed to decide whether `Rdev` applies, and it is free to get anyway
+    violet::UInt32 mask = STATX_TYPE;
+    if (fields.Contains(MetadataField::Permissions)) {
+        mask |= STATX_MODE;
+    }
+
+    if (fields.Contains(MetadataField::Size)) {
+        mask |= STATX_SIZE;
+    }
+
+    if (fields.Contains(MetadataField::ModifiedAt)) {
+        mask |= STATX_MTIME;
+    }
+
+    if (fields.Contains(MetadataField::AccessedAt)) {
+        mask |= STATX_ATIME;
+    }
+
+    if (fields.Contains(MetadataField::CreatedAt)) {
+        mask |= STATX_BTIME;
+    }
+
+    if (fields.Contains(MetadataField::Owner)) {
+        mask |= STATX_UID | STATX_GID;
+    }
+
+    if (fields.Contains(MetadataField::HardLinks)) {
+        mask |= STATX_NLINK;
+    }
+
+    if (fields.Contains(MetadataField::Inode)) {
+        mask |= STATX_INO;
+    }
+
+    return mask;
+}
+
 auto statxToMetadata(const struct statx& st) -> Metadata
 {
-    struct Metadata mt;
-    mt.Size = st.stx_size;
-    mt.ModifiedAt = statxTimestampToMillis(st.stx_mtime);
-    mt.AccessedAt = statxTimestampToMillis(st.stx_atime);
+    // only what the kernel reported back in `stx_mask` is trusted; everything else
+    // keeps its default value
+    struct Metadata mt{ };
+    if ((st.stx_mask & STATX_SIZE) != 0U) {
+        mt.Size = st.stx_size;
+    }
+
+    if ((st.stx_mask & STATX_MTIME) != 0U) {
+        mt.ModifiedAt = statxTimestampToMillis(st.stx_mtime);
+    }
+
+    if ((st.stx_mask & STATX_ATIME) != 0U) {
+        mt.AccessedAt = statxTimestampToMillis(st.stx_atime);
+    }
+
     if ((st.stx_mask & STATX_BTIME) != 0U) {
         mt.CreatedAt = statxTimestampToMillis(st.stx_btime);
     }
 
-    mt.Permissions = Perms(st.stx_mode);
-    mt.Inode = st.stx_ino;
+    if ((st.stx_mask & STATX_MODE) != 0U) {
+        mt.Permissions = Perms(st.stx_mode);
+    }
+
+    if ((st.stx_mask & STATX_INO) != 0U) {
+        mt.Inode = st.stx_ino;
+    }
+
     mt.Device = makedev(st.stx_dev_major, st.stx_dev_minor);
     mt.DeviceMajor = st.stx_dev_major;
     mt.DeviceMinor = st.stx_dev_minor;
@@ -72,122 +149,288 @@ auto statxToMetadata(const struct statx& st) -> Metadata
         mt.RdevMinor = st.stx_rdev_minor;
     }
 
-    mt.UserID = st.stx_uid;
-    mt.GroupID = st.stx_gid;
-    mt.HardLinks = st.stx_nlink;
+    if ((st.stx_mask & STATX_UID) != 0U) {
+        mt.UserID = st.stx_uid;
+    }
+
+    if ((st.stx_mask & STATX_GID) != 0U) {
+        mt.GroupID = st.stx_gid;
+    }
+
+    if ((st.stx_mask & STATX_NLINK) != 0U) {
+        mt.HardLinks = st.stx_nlink;
+    }
 
     return mt;
 }
-} // namespace
 
-auto Metadata::For(FileDescriptor::value_type dirfd, PathRef path, SymlinkResolution resolution) -> io::Result<Metadata>
+/// Below this many paths, setting up a ring or threads costs more than it saves.
+constexpr UInt kSequentialThreshold = 16;
+
+/// The number of `statx` operations submitted to the ring at once.
+constexpr UInt kBatchSize = 256;
+
+/// The number of paths a thread claims at once in the fallback.
+constexpr UInt kThreadChunk = 64;
+
+void statxOne(PathRef path, Int32 flags, UInt32 mask, struct statx& st, Int32& error)
 {
-    struct statx st{ };
-    Int32 flags = 0;
+    // an empty path would otherwise resolve to the working directory
     if (path.Empty()) {
-        flags |= AT_EMPTY_PATH;
+        error = ENOENT;
+        return;
     }
 
-    if (resolution == SymlinkResolution::NoFollow) {
-        flags |= AT_SYMLINK_NOFOLLOW;
+    if (path.WithCStr([&](CStr path) -> bool { return ::statx(AT_FDCWD, path, flags, mask, &st) == -1; })) {
+        error = errno;
     }
+}
 
-    if (path.WithCStr([&](CStr path) -> bool {
-            return ::statx(dirfd, path, flags, STATX_BASIC_STATS | STATX_BTIME, &st) != -1;
-        })) {
-        auto mt = statxToMetadata(st);
-        switch (st.stx_mode & S_IFMT) {
-        case S_IFREG:
-            mt.Type = FileType::mkfile();
-            break;
+/// Queries every path from `from` onwards with plain `statx(2)` calls spread across a pool of threads.
+void statxOnThreads(Span<const PathRef> paths, UInt from, Int32 flags, UInt32 mask, Span<struct statx> stats,
+    Span<Int32> errors)
+{
+    std::atomic<UInt> next = from;
+    auto work = [&] -> void {
+        while (true) {
+            auto start = next.fetch_add(kThreadChunk, std::memory_order_relaxed);
+            if (start >= paths.size()) {
+                return;
+            }
+
+            for (UInt i = start; i < std::min(start + kThreadChunk, paths.size()); i++) {
+                statxOne(paths[i], flags, mask, stats[i], errors[i]);
+            }
+        }
+    };
 
-        case S_IFDIR:
-            mt.Type = FileType::mkdir();
-            break;
+    const UInt chunks = (paths.size() - std::min(from, paths.size()) + kThreadChunk - 1) / kThreadChunk;
+    const UInt threads = std::min<UInt>(std::max<UInt>(std::thread::hardware_concurrency(), 1), chunks);
 
-        case S_IFLNK:
-            mt.Type = FileType::mksymlink();
-            break;
+    Vec<std::thread> workers;
+    for (UInt i = 1; i < threads; i++) {
+        workers.emplace_back(work);
+    }
 
-        case S_IFCHR:
-            mt.Type = FileType::mkchardev();
-            break;
+    work();
+    for (auto& worker: workers) {
+        worker.join();
+    }
+}
 
-        case S_IFBLK:
-            mt.Type = FileType::mkblkdev();
-            break;
+#if VIOLET_FEATURE(LIBURING)
+/// Queries the paths through `IORING_OP_STATX` in batches of [`kBatchSize`].
+///
+/// @returns how many paths, from the start, were queried. Everything after that is left to the
+///          fallback, e.g. when the ring can't be set up at all.
+auto statxOnRing(Span<const PathRef> paths, Int32 flags, UInt32 mask, Span<struct statx> stats, Span<Int32> errors)
+    -> UInt
+{
+    struct io_uring ring{ };
+    if (::io_uring_queue_init(kBatchSize, &ring, 0) < 0) {
+        return 0;
+    }
 
-        case S_IFIFO:
-            mt.Type = FileType::mkfifo();
-            break;
+    // the kernel only reads the path once the operation is submitted, so it has to outlive the batch
+    Vec<String> names(kBatchSize);
+
+    UInt done = 0;
+    while (done < paths.size()) {
+        const UInt count = std::min(kBatchSize, paths.size() - done);
+
+        UInt queued = 0;
+        bool exhausted = false;
+        for (UInt i = 0; i < count; i++) {
+            const UInt index = done + i;
+            if (paths[index].Empty()) {
+                errors[index] = ENOENT;
+                continue;
+            }
+
+            names[i] = String(paths[index].Data());
+
+            struct io_uring_sqe* sqe = ::io_uring_get_sqe(&ring);
+            if (sqe == nullptr) {
+                exhausted = true;
+                break;
+            }
+
+            ::io_uring_prep_statx(sqe, AT_FDCWD, names[i].c_str(), flags, mask, &stats[index]);
+            ::io_uring_sqe_set_data64(sqe, index);
+            queued++;
+        }
 
-        case S_IFSOCK:
-            mt.Type = FileType::mksocket();
+        Int32 ret = 0;
+        do {
+            ret = ::io_uring_submit_and_wait(&ring, static_cast<unsigned>(queued));
+        } while (ret == -EINTR);
+
+        // nothing was submitted, so nothing in flight still points into `names` or `stats`
+        if (ret < 0) {
             break;
+        }
 
-        default:
+        // Only part of the batch may have been submitted; what's left over in the submission queue
+        // would be overwritten by the next batch. The submitted operations still have to be reaped
+        // since they write into `stats`, but the whole batch is then left to the fallback.
+        const bool partial = exhausted || static_cast<UInt>(ret) != queued;
+
+        bool reaped = true;
+        for (UInt left = static_cast<UInt>(ret); left > 0;) {
+            struct io_uring_cqe* cqe = nullptr;
+            if (Int32 waited = ::io_uring_wait_cqe(&ring, &cqe); waited < 0) {
+                if (waited == -EINTR) {
+                    continue;
+                }
+
+                reaped = false;
+                break;
+            }
+
+            const auto index = static_cast<UInt>(::io_uring_cqe_get_data64(cqe));
+            const Int32 res = cqe->res;
+            ::io_uring_cqe_seen(&ring, cqe);
+            left--;
+
+            if (partial) {
+                continue;
+            }
+
+            // kernels before 5.6 don't know `IORING_OP_STATX`
+            if (res == -EINVAL || res == -EOPNOTSUPP) {
+                statxOne(paths[index], flags, mask, stats[index], errors[index]);
+            } else if (res < 0) {
+                errors[index] = -res;
+            }
+        }
+
+        // leave the whole batch to the fallback rather than reporting half of it
+        if (partial || !reaped) {
+            std::fill_n(errors.begin() + static_cast<std::ptrdiff_t>(done), count, 0);
             break;
         }
 
-        return mt;
+        done += count;
     }
 
-    return Err(io::Error::OSError());
-}
-
-auto Metadata::For(FileDescriptor::value_type fd) -> io::Result<Metadata>
-{
-    return For(fd, "");
+    ::io_uring_queue_exit(&ring);
+    return done;
 }
+#endif
+} // namespace
 
-auto Metadata::For(PathRef path, SymlinkResolution resolution) -> io::Result<Metadata>
+auto Metadata::For(FileDescriptor::value_type dirfd, PathRef path, SymlinkResolution resolution,
+    Bitflags<MetadataField> mask) -> io::Result<Metadata>
 {
     struct statx st{ };
-    const UInt32 mask = STATX_BASIC_STATS | STATX_BTIME;
     Int32 flags = 0;
+    if (path.Empty()) {
+        flags |= AT_EMPTY_PATH;
+    }
+
     if (resolution == SymlinkResolution::NoFollow) {
         flags |= AT_SYMLINK_NOFOLLOW;
     }
 
-    if (path.WithCStr([&](CStr data) -> bool { return ::statx(AT_FDCWD, data, flags, mask, &st) != -1; })) {
+    const UInt32 request = statxMask(mask);
+    if (path.WithCStr([&](CStr path) -> bool { return ::statx(dirfd, path, flags, request, &st) != -1; })) {
         auto mt = statxToMetadata(st);
-        switch (st.stx_mode & S_IFMT) {
-        case S_IFREG:
-            mt.Type = FileType::mkfile();
-            break;
+        mt.Type = typeOf(st.stx_mode);
 
-        case S_IFDIR:
-            mt.Type = FileType::mkdir();
-            break;
+        return mt;
+    }
 
-        case S_IFLNK:
-            mt.Type = FileType::mksymlink();
-            break;
+    return Err(io::Error::OSError());
+}
 
-        case S_IFCHR:
-            mt.Type = FileType::mkchardev();
-            break;
+auto Metadata::ForMany(Span<const PathRef> paths, Bitflags<MetadataField> mask, SymlinkResolution resolution)
+    -> Vec<io::Result<Metadata>>
+{
+    const Int32 flags = resolution == SymlinkResolution::NoFollow ? AT_SYMLINK_NOFOLLOW : 0;
+    const UInt32 request = statxMask(mask);
 
-        case S_IFBLK:
-            mt.Type = FileType::mkblkdev();
-            break;
+    Vec<struct statx> stats(paths.size());
+    Vec<Int32> errors(paths.size(), 0);
 
-        case S_IFIFO:
-            mt.Type = FileType::mkfifo();
-            break;
+    if (paths.size() < kSequentialThreshold) {
+        for (UInt i = 0; i < paths.size(); i++) {
+            statxOne(paths[i], flags, request, stats[i], errors[i]);
+        }
+    } else {
+        UInt done = 0;
+#if VIOLET_FEATURE(LIBURING)
+        done = statxOnRing(paths, flags, request, stats, errors);
+#endif
 
-        case S_IFSOCK:
-            mt.Type = FileType::mksocket();
-            break;
+        if (done < paths.size()) {
+            statxOnThreads(paths, done, flags, request, stats, errors);
+        }
+    }
 
-        default:
-            break;
+    Vec<io::Result<Metadata>> results;
+    results.reserve(paths.size());
+
+    for (UInt i = 0; i < paths.size(); i++) {
+        if (errors[i] != 0) {
+            results.emplace_back(Err(io::Error::FromOSError(errors[i])));
+            continue;
         }
 
-        return mt;
+        auto mt = statxToMetadata(stats[i]);
+        mt.Type = typeOf(stats[i].stx_mode);
+        results.emplace_back(VIOLET_MOVE(mt));
     }
 
-    return Err(io::Error::OSError());
+    return results;
+}
+
+auto Metadata::typeOf(UInt32 mode) noexcept -> FileType
+{
+    switch (mode & S_IFMT) {
+    case S_IFREG:
+        return FileType::mkfile();
+
+    case S_IFDIR:
+        return FileType::mkdir();
+
+    case S_IFLNK:
+        return FileType::mksymlink();
+
+    case S_IFCHR:
+        return FileType::mkchardev();
+
+    case S_IFBLK:
+        return FileType::mkblkdev();
+
+    case S_IFIFO:
+        return FileType::mkfifo();
+
+    case S_IFSOCK:
+        return FileType::mksocket();
+
+    default:
+        return { };
+    }
+}
+
+auto Metadata::For(FileDescriptor::value_type dirfd, PathRef path, SymlinkResolution resolution) -> io::Result<Metadata>
+{
+    return For(dirfd, path, resolution, MetadataField::All);
+}
+
+auto Metadata::For(FileDescriptor::value_type fd) -> io::Result<Metadata>
+{
+    return For(fd, "");
+}
+
+auto Metadata::For(PathRef path, SymlinkResolution resolution) -> io::Result<Metadata>
+{
+    // an empty path would otherwise resolve to the working directory through `AT_EMPTY_PATH`
+    if (path.Empty()) {
+        return Err(io::Error::FromOSError(ENOENT));
+    }
+
+    return For(AT_FDCWD, path, resolution, MetadataField::All);
 }
 
 #endif
@@ -26,6 +26,11 @@
 #include <violet/Filesystem/Metadata.h>
 #include <violet/Filesystem/Path.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <thread>
+
 #if VIOLET_PLATFORM(LINUX)
 #include <sys/sysmacros.h>
 #elif VIOLET_PLATFORM(APPLE_MACOS)
@@ -34,8 +39,13 @@
 #include <sys/types.h>
 #endif
 
+using violet::Optional;
+using violet::Span;
+using violet::UInt;
 using violet::UInt64;
+using violet::Vec;
 using violet::filesystem::Metadata;
+using violet::filesystem::MetadataField;
 using violet::filesystem::PathRef;
 using violet::filesystem::SymlinkResolution;
 using violet::io::FileDescriptor;
@@ -89,6 +99,12 @@ auto statToMetadata(struct stat st) -> Metadata
     return mt;
 }
 
+/// Below this many paths, spinning up threads costs more than it saves.
+constexpr UInt kSequentialThreshold = 16;
+
+/// The number of paths a thread claims at once.
+constexpr UInt kThreadChunk = 64;
+
 } // namespace
 
 auto Metadata::For(FileDescriptor::value_type dirfd, PathRef path, SymlinkResolution resolution) -> io::Result<Metadata>
@@ -237,4 +253,56 @@ auto Metadata::For(PathRef path, SymlinkResolution resolution) -> io::Result<Met
     return mt;
 }
 
+auto Metadata::ForMany(Span<const PathRef> paths, Bitflags<MetadataField>, SymlinkResolution resolution)
+    -> Vec<io::Result<Metadata>>
+{
+    Vec<Optional<io::Result<Metadata>>> slots(paths.size());
+    std::atomic<UInt> next = 0;
+
+    auto work = [&] -> void {
+        while (true) {
+            auto start = next.fetch_add(kThreadChunk, std::memory_order_relaxed);
+            if (start >= paths.size()) {
+                return;
+            }
+
+            for (UInt i = start; i < std::min(start + kThreadChunk, paths.size()); i++) {
+                slots[i] = paths[i].Empty() ? Err(io::Error::FromOSError(ENOENT)) : For(paths[i], resolution);
+            }
+        }
+    };
+
+    // there's no batched `stat` on macOS, so the next best thing is to have a few in flight at once
+    const UInt threads = paths.size() < kSequentialThreshold
+        ? 1
+        : std::min<UInt>(std::max<UInt>(std::thread::hardware_concurrency(), 1),
+              (paths.size() + kThreadChunk - 1) / kThreadChunk);
+
+    Vec<std::thread> workers;
+    for (UInt i = 1; i < threads; i++) {
+        workers.emplace_back(work);
+    }
+
+    work();
+    for (auto& worker: workers) {
+        worker.join();
+    }
+
+    Vec<io::Result<Metadata>> results;
+    results.reserve(paths.size());
+
+    for (auto& slot: slots) {
+        results.push_back(VIOLET_MOVE(slot).Value());
+    }
+
+    return results;
+}
+
+auto Metadata::For(FileDescriptor::value_type dirfd, PathRef path, SymlinkResolution resolution,
+    Bitflags<MetadataField>) -> io::Result<Metadata>
+{
+    // `fstatat` has no request mask, everything is filled in regardless
+    return For(dirfd, path, resolution);
+}
+
 #endif
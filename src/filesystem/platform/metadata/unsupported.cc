@@ -22,7 +22,11 @@
 #include <violet/Filesystem/Metadata.h>
 #include <violet/Filesystem/Path.h>
 
+using violet::Span;
+using violet::UInt;
+using violet::Vec;
 using violet::filesystem::Metadata;
+using violet::filesystem::MetadataField;
 using violet::filesystem::PathRef;
 using violet::filesystem::SymlinkResolution;
 using violet::io::FileDescriptor;
@@ -36,3 +40,22 @@ auto Metadata::For(PathRef, SymlinkResolution) -> io::Result<Metadata>
 {
     return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
 }
+
+auto Metadata::For(FileDescriptor::value_type, PathRef, SymlinkResolution, Bitflags<MetadataField>)
+    -> io::Result<Metadata>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto Metadata::ForMany(Span<const PathRef> paths, Bitflags<MetadataField>, SymlinkResolution)
+    -> Vec<io::Result<Metadata>>
+{
+    Vec<io::Result<Metadata>> results;
+    results.reserve(paths.size());
+
+    for (UInt i = 0; i < paths.size(); i++) {
+        results.emplace_back(Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation")));
+    }
+
+    return results;
+}
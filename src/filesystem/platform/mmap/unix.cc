@@ -0,0 +1,242 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/Filesystem/Mmap.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using violet::UInt;
+using violet::UInt64;
+using violet::filesystem::Mmap;
+using violet::filesystem::MmapAdvice;
+using violet::filesystem::MmapOptions;
+
+namespace {
+
+auto pageSize() noexcept -> UInt
+{
+    static const auto size = static_cast<UInt>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+auto toAdvice(MmapAdvice advice) noexcept -> int
+{
+    switch (advice) {
+    case MmapAdvice::Normal:
+        return MADV_NORMAL;
+
+    case MmapAdvice::Sequential:
+        return MADV_SEQUENTIAL;
+
+    case MmapAdvice::Random:
+        return MADV_RANDOM;
+
+    case MmapAdvice::WillNeed:
+        return MADV_WILLNEED;
+
+    case MmapAdvice::DontNeed:
+        return MADV_DONTNEED;
+    }
+
+    VIOLET_UNREACHABLE();
+}
+
+} // namespace
+
+auto MmapOptions::Map(const File& file) const noexcept -> io::Result<Mmap>
+{
+    return this->mapImpl(file, false);
+}
+
+auto MmapOptions::MapMut(const File& file) const noexcept -> io::Result<Mmap>
+{
+    return this->mapImpl(file, true);
+}
+
+auto MmapOptions::mapImpl(const File& file, bool writable) const noexcept -> io::Result<Mmap>
+{
+    if (!file.Valid()) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "cannot map an invalid file"));
+    }
+
+    UInt length = 0;
+    if (this->n_length.HasValue()) {
+        length = this->n_length.Value();
+    } else {
+        struct stat st{ };
+        if (::fstat(file.Descriptor(), &st) == -1) {
+            return Err(io::Error::OSError());
+        }
+
+        const auto size = static_cast<UInt64>(st.st_size);
+        if (this->n_offset > size) {
+            return Err(VIOLET_IO_ERROR(InvalidInput, String, "mapping offset is past the end of the file"));
+        }
+
+        length = static_cast<UInt>(size - this->n_offset);
+    }
+
+    // `mmap(2)` rejects zero-length mappings, but an empty file is a perfectly fine thing to map.
+    if (length == 0) {
+        return Mmap();
+    }
+
+    // The offset given to `mmap(2)` has to be page-aligned, so map from the page that
+    // contains it and hide the leading bytes.
+    const UInt delta = static_cast<UInt>(this->n_offset % pageSize());
+    const UInt mapped = length + delta;
+
+    int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if (this->n_populate) {
+        flags |= MAP_POPULATE;
+    }
+#endif
+
+    const int prot = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* base = ::mmap(nullptr, mapped, prot, flags, file.Descriptor(), static_cast<off_t>(this->n_offset - delta));
+    if (base == MAP_FAILED) {
+        return Err(io::Error::OSError());
+    }
+
+    Mmap map(base, mapped, delta, writable);
+
+    // Advice and huge pages are only hints, so failing to apply them doesn't fail the mapping.
+    if (this->n_advice != MmapAdvice::Normal) {
+        (void)::madvise(base, mapped, toAdvice(this->n_advice));
+    }
+
+#ifndef MAP_POPULATE
+    if (this->n_populate) {
+        (void)::madvise(base, mapped, MADV_WILLNEED);
+    }
+#endif
+
+#ifdef MADV_HUGEPAGE
+    if (this->n_hugePages) {
+        (void)::madvise(base, mapped, MADV_HUGEPAGE);
+    }
+#endif
+
+    return map;
+}
+
+Mmap::Mmap(void* base, UInt length, UInt delta, bool writable) noexcept
+    : n_base(base)
+    , n_length(length)
+    , n_data(static_cast<UInt8*>(base) + delta)
+    , n_size(length - delta)
+    , n_writable(writable)
+{
+}
+
+Mmap::Mmap(Mmap&& other) noexcept
+    : n_base(std::exchange(other.n_base, nullptr))
+    , n_length(std::exchange(other.n_length, 0))
+    , n_data(std::exchange(other.n_data, nullptr))
+    , n_size(std::exchange(other.n_size, 0))
+    , n_writable(std::exchange(other.n_writable, false))
+{
+}
+
+auto Mmap::operator=(Mmap&& other) noexcept -> Mmap&
+{
+    if (this != &other) {
+        (void)this->Unmap();
+
+        this->n_base = std::exchange(other.n_base, nullptr);
+        this->n_length = std::exchange(other.n_length, 0);
+        this->n_data = std::exchange(other.n_data, nullptr);
+        this->n_size = std::exchange(other.n_size, 0);
+        this->n_writable = std::exchange(other.n_writable, false);
+    }
+
+    return *this;
+}
+
+Mmap::~Mmap()
+{
+    (void)this->Unmap();
+}
+
+auto Mmap::Advise(MmapAdvice advice) const noexcept -> io::Result<void>
+{
+    return this->Advise(advice, 0, this->n_size);
+}
+
+auto Mmap::Advise(MmapAdvice advice, UInt offset, UInt length) const noexcept -> io::Result<void>
+{
+    if (offset > this->n_size || length > this->n_size - offset) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "advice range is outside of the mapping"));
+    }
+
+    if (length == 0) {
+        return { };
+    }
+
+    // `madvise(2)` wants a page-aligned start, so widen the range down to its page.
+    const auto start = reinterpret_cast<std::uintptr_t>(this->n_data + offset);
+    const auto aligned = start - (start % pageSize());
+    if (::madvise(reinterpret_cast<void*>(aligned), length + (start - aligned), toAdvice(advice)) == -1) {
+        return Err(io::Error::OSError());
+    }
+
+    return { };
+}
+
+auto Mmap::Flush() const noexcept -> io::Result<void>
+{
+    if (this->n_base != nullptr && ::msync(this->n_base, this->n_length, MS_SYNC) == -1) {
+        return Err(io::Error::OSError());
+    }
+
+    return { };
+}
+
+auto Mmap::FlushAsync() const noexcept -> io::Result<void>
+{
+    if (this->n_base != nullptr && ::msync(this->n_base, this->n_length, MS_ASYNC) == -1) {
+        return Err(io::Error::OSError());
+    }
+
+    return { };
+}
+
+auto Mmap::Unmap() noexcept -> io::Result<void>
+{
+    if (this->n_base == nullptr) {
+        return { };
+    }
+
+    void* base = std::exchange(this->n_base, nullptr);
+    const UInt length = std::exchange(this->n_length, 0);
+    this->n_data = nullptr;
+    this->n_size = 0;
+
+    if (::munmap(base, length) == -1) {
+        return Err(io::Error::OSError());
+    }
+
+    return { };
+}
@@ -0,0 +1,77 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/Filesystem/Mmap.h>
+
+using violet::filesystem::Mmap;
+using violet::filesystem::MmapAdvice;
+using violet::filesystem::MmapOptions;
+
+auto MmapOptions::Map(const File&) const noexcept -> io::Result<Mmap>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto MmapOptions::MapMut(const File&) const noexcept -> io::Result<Mmap>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+Mmap::Mmap(Mmap&& other) noexcept
+    : n_base(std::exchange(other.n_base, nullptr))
+    , n_length(std::exchange(other.n_length, 0))
+    , n_data(std::exchange(other.n_data, nullptr))
+    , n_size(std::exchange(other.n_size, 0))
+    , n_writable(std::exchange(other.n_writable, false))
+{
+}
+
+auto Mmap::operator=(Mmap&& other) noexcept -> Mmap&
+{
+    this->n_base = std::exchange(other.n_base, nullptr);
+    this->n_length = std::exchange(other.n_length, 0);
+    this->n_data = std::exchange(other.n_data, nullptr);
+    this->n_size = std::exchange(other.n_size, 0);
+    this->n_writable = std::exchange(other.n_writable, false);
+
+    return *this;
+}
+
+Mmap::~Mmap() = default;
+
+#define MK_UNSUPPORTED_OP(NAME, RETURN, QUALIFIERS, ...)                                                               \
+    auto Mmap::NAME(__VA_ARGS__) QUALIFIERS noexcept -> RETURN                                                        \
+    {                                                                                                                  \
+        return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));                                     \
+    }
+
+MK_UNSUPPORTED_OP(Advise, io::Result<void>, const, MmapAdvice);
+MK_UNSUPPORTED_OP(Advise, io::Result<void>, const, MmapAdvice, UInt, UInt);
+MK_UNSUPPORTED_OP(Flush, io::Result<void>, const);
+MK_UNSUPPORTED_OP(FlushAsync, io::Result<void>, const);
+
+#undef MK_UNSUPPORTED_OP
+
+auto Mmap::Unmap() noexcept -> io::Result<void>
+{
+    return { };
+}
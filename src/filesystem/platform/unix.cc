@@ -26,6 +26,7 @@
 #include <violet/Filesystem.h>
 #include <violet/Filesystem/File.h>
 #include <violet/Filesystem/Path.h>
+#include <violet/Filesystem/__detail/DirStream.unix.h>
 #include <violet/IO/Error.h>
 
 #include <climits> // IWYU pragma: keep
@@ -36,96 +37,92 @@
 
 using violet::CStr;
 using violet::UInt64;
+using violet::filesystem::DirEntry;
 using violet::filesystem::Dirs;
 using violet::filesystem::PathRef;
 using violet::filesystem::WalkDirs;
 
-struct Dirs::Impl final {
-    VIOLET_DISALLOW_COPY_AND_MOVE(Impl);
-    VIOLET_IMPLICIT Impl(PathRef root, DIR* entry)
-        : n_root(root)
-        , n_entries(entry)
-    {
-    }
+DirEntry::DirEntry(SharedPtr<const struct Path> parent, Str name, FileType type, std::weak_ptr<stream> from)
+    : Type(type)
+    , n_parent(VIOLET_MOVE(parent))
+    , n_name(name)
+    , n_stream(VIOLET_MOVE(from))
+{
+}
 
-    VIOLET_IMPLICIT Impl(PathRef root, io::FileDescriptor&& fd, DIR* entry)
-        : n_root(root)
-        , n_entries(entry)
-        , n_fd(VIOLET_MOVE(fd))
-    {
-    }
+auto DirEntry::Name() const noexcept -> Str
+{
+    return this->n_name;
+}
 
-    VIOLET_IMPLICIT Impl(Path root, DIR* entry)
-        : n_root(VIOLET_MOVE(root))
-        , n_entries(entry)
-    {
+auto DirEntry::Path() const -> struct Path
+{
+    return this->n_parent->Join(this->n_name);
+}
+
+auto DirEntry::Metadata(Bitflags<MetadataField> mask) -> io::Result<struct Metadata>
+{
+    if (this->n_metadata.HasValue() && this->n_fetched.Contains(mask)) {
+        return this->n_metadata.Value();
     }
 
-    VIOLET_IMPLICIT Impl(Path root, io::FileDescriptor&& fd, DIR* entry)
-        : n_root(VIOLET_MOVE(root))
-        , n_entries(entry)
-        , n_fd(VIOLET_MOVE(fd))
-    {
+    auto metadata = [&]() -> io::Result<struct Metadata> {
+        // entries are always direct children of the stream that yielded them, so the name is enough
+        if (auto parent = this->n_stream.lock(); parent != nullptr) {
+            return filesystem::Metadata::For(
+                parent->Descriptor(), Str(this->n_name), SymlinkResolution::NoFollow, mask);
+        }
+
+        return filesystem::Metadata::For(AT_FDCWD, this->Path(), SymlinkResolution::NoFollow, mask);
+    }();
+
+    if (metadata.Err()) {
+        return Err(VIOLET_MOVE(metadata).Error());
     }
 
-    ~Impl()
+    this->n_metadata = metadata.Value();
+    this->n_fetched = mask;
+
+    return metadata;
+}
+
+struct Dirs::Impl final {
+    VIOLET_DISALLOW_COPY_AND_MOVE(Impl);
+    VIOLET_IMPLICIT Impl(Path root, SharedPtr<DirEntry::stream> stream)
+        : n_root(std::make_shared<const Path>(VIOLET_MOVE(root)))
+        , n_stream(VIOLET_MOVE(stream))
     {
-        this->close();
     }
 
+    ~Impl() = default;
+
     auto Next() -> Optional<io::Result<DirEntry>>
     {
-        if (this->n_entries == nullptr) {
+        if (this->n_stream == nullptr) {
             return Nothing;
         }
 
-        struct dirent* ent = nullptr;
-        while (true) {
-            errno = 0;
-            ent = ::readdir(this->n_entries);
-            if (ent == nullptr) {
-                if (errno != 0) {
-                    return Err(io::Error::OSError());
-                }
-
-                return Nothing;
-            }
-
-            const Str name(ent->d_name);
-            if (name == "." || name == "..") {
-                continue;
-            }
-
-            break;
+        auto next = this->n_stream->Next();
+        if (next.Err()) {
+            return Err(VIOLET_MOVE(next).Error());
         }
 
-        const Int32 dirfd = ::dirfd(this->n_entries);
-        auto metadata = Metadata::For(dirfd, ent->d_name, SymlinkResolution::NoFollow);
-        if (metadata.Err()) {
-            return Err(VIOLET_MOVE(metadata).Error());
+        if (!next->HasValue()) {
+            return Nothing;
         }
 
-        Path path(this->n_root.Join(ent->d_name));
-        return Ok<DirEntry>(VIOLET_MOVE(path), VIOLET_MOVE(metadata.Value()));
+        const auto& raw = next->Value();
+        return DirEntry(this->n_root, raw.Name, raw.Type, this->n_stream);
     }
 
     void stopTraversing()
     {
-        this->close();
+        this->n_stream.reset();
     }
 
 private:
-    Path n_root;
-    DIR* n_entries;
-    Optional<io::FileDescriptor> n_fd;
-
-    void close()
-    {
-        if (this->n_entries != nullptr) {
-            ::closedir(this->n_entries);
-            this->n_entries = nullptr;
-        }
-    }
+    SharedPtr<const Path> n_root;
+    SharedPtr<DirEntry::stream> n_stream;
 };
 
 template<typename... Args>
@@ -134,12 +131,6 @@ Dirs::Dirs(Args&&... args)
 {
 }
 
-// `Dirs::Impl` is only complete in this TU (and other TUs that implement `Dirs`), so the forwarding
-// constructor above can only be instantiated here. Methods that are outside this TU (like `Dir::Iter`),
-// and try to construct a `Dirs(Args&&...)` will fail with a linker error. So, that's why it is explicitlly
-// instantiated here.
-template Dirs::Dirs(Path&, io::FileDescriptor&&, DIR*&);
-
 Dirs::Dirs(Dirs&& other) noexcept
     : n_impl(std::exchange(other.n_impl, nullptr))
 {
@@ -166,34 +157,37 @@ void Dirs::StopTraversing()
     }
 }
 
-auto violet::filesystem::ReadDir(PathRef path) -> io::Result<Dirs>
+auto Dirs::fromDescriptor(Int32 fd, Path base) -> io::Result<Dirs>
+{
+    auto stream = VIOLET_TRY(DirEntry::stream::Open(fd));
+    return Dirs(VIOLET_MOVE(base), VIOLET_MOVE(stream));
+}
+
+namespace {
+auto openDirectory(PathRef path) -> violet::io::Result<violet::Int32>
 {
-    DIR* entries = nullptr;
+    violet::Int32 fd = -1;
     if (path.WithCStr([&](CStr path) -> bool {
-            entries = ::opendir(path);
-            return entries == nullptr;
+            fd = ::open(path, O_DIRECTORY | O_RDONLY | O_CLOEXEC);
+            return fd < 0;
         })) {
-        return Err(io::Error::OSError());
+        return violet::Err(violet::io::Error::OSError());
     }
 
-    return Dirs(path, entries);
+    return fd;
 }
-
-namespace {
-struct dirdestruct final {
-    auto operator()(DIR* dir) -> void
-    {
-        if (dir != nullptr) {
-            ::closedir(dir);
-        }
-    }
-};
 } // namespace
 
+auto violet::filesystem::ReadDir(PathRef path) -> io::Result<Dirs>
+{
+    auto fd = VIOLET_TRY(openDirectory(path));
+    return Dirs::fromDescriptor(fd, path);
+}
+
 struct WalkDirs::Impl final {
     struct Frame final {
-        violet::UniquePtr<DIR, dirdestruct> Entry = nullptr;
-        struct filesystem::Path Path;
+        SharedPtr<DirEntry::stream> Stream;
+        SharedPtr<const struct filesystem::Path> Path;
     };
 
     VIOLET_DISALLOW_COPY_AND_MOVE(Impl);
@@ -222,45 +216,38 @@ struct WalkDirs::Impl final {
         }
 
         while (!this->n_stack.empty()) {
-            DIR* stream = this->n_stack.back().Entry.get();
-            const Int32 dirfd = ::dirfd(stream);
-
-            errno = 0;
-            dirent* ent = ::readdir(stream);
-            if (ent == nullptr) {
-                if (errno != 0) {
-                    auto saved = errno;
-                    this->n_stack.pop_back();
-
-                    return Err(io::Error::FromOSError(saved));
-                }
+            auto stream = this->n_stack.back().Stream;
+            auto parent = this->n_stack.back().Path;
 
-                // reached EOF
+            auto next = stream->Next();
+            if (next.Err()) {
                 this->n_stack.pop_back();
-                continue;
+                return Err(VIOLET_MOVE(next).Error());
             }
 
-            CStr name = ent->d_name;
-            if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+            if (!next->HasValue()) {
+                // reached EOF, the buffer can go to whichever directory we open next
+                this->n_spare = stream->TakeBuffer();
+                this->n_stack.pop_back();
+
                 continue;
             }
 
-            Path path(this->n_stack.back().Path.Join(name));
-            auto metadata = Metadata::For(dirfd, name, SymlinkResolution::NoFollow);
-            if (metadata.Err()) {
-                return Err(VIOLET_MOVE(metadata.Error()));
-            }
+            const auto& raw = next->Value();
+            DirEntry entry(parent, raw.Name, raw.Type, stream);
 
-            if (metadata->Type.Dir()) {
-                auto subdir = openSubdir(dirfd, name);
+            // symbolic links are reported as-is, so a link to a directory is never descended into
+            if (raw.Type.Dir()) {
+                auto subdir = this->openSubdir(stream->Descriptor(), raw.Name.data());
                 if (subdir.Err()) {
                     this->n_pending = VIOLET_MOVE(subdir.Error());
                 } else {
-                    this->n_stack.push_back({ .Entry = VIOLET_MOVE(subdir.Value()), .Path = path });
+                    this->n_stack.push_back({ .Stream = VIOLET_MOVE(subdir.Value()),
+                        .Path = std::make_shared<const struct filesystem::Path>(parent->Join(raw.Name)) });
                 }
             }
 
-            return DirEntry(VIOLET_MOVE(path), VIOLET_MOVE(metadata.Value()));
+            return entry;
         }
 
         return Nothing;
@@ -274,28 +261,21 @@ struct WalkDirs::Impl final {
 private:
     Vec<Frame> n_stack;
     Optional<io::Error> n_pending;
+    DirEntry::stream::buffer_type n_spare{ };
 
     void close()
     {
         this->n_stack.clear();
     }
 
-    static auto openSubdir(Int32 dirfd, CStr name) -> io::Result<UniquePtr<DIR, dirdestruct>>
+    auto openSubdir(Int32 dirfd, CStr name) -> io::Result<SharedPtr<DirEntry::stream>>
     {
         const Int32 fd = ::openat(dirfd, name, O_DIRECTORY | O_NOFOLLOW | O_RDONLY | O_CLOEXEC);
         if (fd < 0) {
             return Err(io::Error::OSError());
         }
 
-        DIR* subdir = ::fdopendir(fd);
-        if (subdir == nullptr) {
-            auto saved = errno;
-            ::close(fd);
-
-            return Err(io::Error::FromOSError(saved));
-        }
-
-        return UniquePtr<DIR, dirdestruct>(subdir);
+        return DirEntry::stream::Open(fd, VIOLET_MOVE(this->n_spare));
     }
 };
 
@@ -331,25 +311,20 @@ void WalkDirs::StopTraversing()
     }
 }
 
-auto WalkDirs::fromRootStream(DIR* stream, Path base) -> WalkDirs
+auto WalkDirs::fromDescriptor(Int32 fd, Path base) -> io::Result<WalkDirs>
 {
+    auto stream = VIOLET_TRY(DirEntry::stream::Open(fd));
+
     Vec<Impl::Frame> stack;
-    stack.push_back(Impl::Frame(UniquePtr<DIR, dirdestruct>(stream), VIOLET_MOVE(base)));
+    stack.push_back(Impl::Frame(VIOLET_MOVE(stream), std::make_shared<const Path>(VIOLET_MOVE(base))));
 
     return WalkDirs(VIOLET_MOVE(stack));
 }
 
 auto violet::filesystem::WalkDir(PathRef path) -> io::Result<WalkDirs>
 {
-    DIR* ent = nullptr;
-    if (path.WithCStr([&](CStr path) -> bool {
-            ent = ::opendir(path);
-            return ent == nullptr;
-        })) {
-        return Err(io::Error::OSError());
-    }
-
-    return WalkDirs::fromRootStream(ent, path);
+    auto fd = VIOLET_TRY(openDirectory(path));
+    return WalkDirs::fromDescriptor(fd, path);
 }
 
 auto violet::filesystem::Metadata(PathRef path, bool followSymlinks) -> io::Result<struct Metadata>
@@ -427,10 +402,10 @@ auto violet::filesystem::RemoveAllDirs(PathRef path) -> io::Result<void>
             return Err(VIOLET_MOVE(result).Error());
         }
 
-        if (result->Metadata.Type.Dir()) {
-            dirs.push_back(VIOLET_MOVE(result->Path));
+        if (result->Type.Dir()) {
+            dirs.push_back(result->Path());
         } else {
-            if (auto removed = filesystem::RemoveFile(result->Path); removed.Err()) {
+            if (auto removed = filesystem::RemoveFile(result->Path()); removed.Err()) {
                 iter.StopTraversing();
                 return Err(VIOLET_MOVE(removed).Error());
             }
@@ -26,10 +26,26 @@
 
 using violet::CStr;
 using violet::UInt64;
+using violet::filesystem::DirEntry;
 using violet::filesystem::Dirs;
 using violet::filesystem::PathRef;
 using violet::filesystem::WalkDirs;
 
+auto DirEntry::Name() const noexcept -> Str
+{
+    return this->n_name;
+}
+
+auto DirEntry::Path() const -> struct Path
+{
+    return this->n_parent->Join(this->n_name);
+}
+
+auto DirEntry::Metadata(Bitflags<MetadataField>) -> io::Result<struct Metadata>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
 struct Dirs::Impl final {
     Impl() = delete;
 };
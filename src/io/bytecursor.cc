@@ -0,0 +1,107 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/IO/ByteCursor.h>
+
+#include <cstring>
+
+using violet::io::ByteCursor;
+using violet::io::ByteQueue;
+
+auto ByteCursor::Read(Span<UInt8> buf) noexcept -> Result<UInt>
+{
+    const UInt bytes = std::min(buf.size(), this->n_data.size() - this->n_pos);
+    if (bytes == 0) {
+        return 0;
+    }
+
+    ::memcpy(buf.data(), this->n_data.data() + this->n_pos, bytes);
+    this->n_pos += bytes;
+
+    return bytes;
+}
+
+void ByteQueue::Push(Vec<UInt8>&& chunk)
+{
+    if (chunk.empty()) {
+        return;
+    }
+
+    this->n_size += chunk.size();
+    this->n_chunks.push_back(VIOLET_MOVE(chunk));
+}
+
+void ByteQueue::Push(Span<const UInt8> bytes)
+{
+    this->Push(Vec<UInt8>(bytes.begin(), bytes.end()));
+}
+
+auto ByteQueue::Read(Span<UInt8> buf) noexcept -> Result<UInt>
+{
+    UInt total = 0;
+    while (!buf.empty() && !this->n_chunks.empty()) {
+        auto front = this->Front();
+        const UInt bytes = std::min(buf.size(), front.size());
+
+        ::memcpy(buf.data(), front.data(), bytes);
+        this->Consume(bytes);
+
+        buf = buf.subspan(bytes);
+        total += bytes;
+    }
+
+    return total;
+}
+
+auto ByteQueue::Front() const noexcept -> Span<const UInt8>
+{
+    if (this->n_chunks.empty()) {
+        return { };
+    }
+
+    return Span<const UInt8>(this->n_chunks.front()).subspan(this->n_offset);
+}
+
+void ByteQueue::Consume(UInt bytes) noexcept
+{
+    bytes = std::min(bytes, this->n_size);
+    this->n_size -= bytes;
+
+    while (bytes > 0) {
+        const UInt left = this->n_chunks.front().size() - this->n_offset;
+        if (bytes < left) {
+            this->n_offset += bytes;
+            return;
+        }
+
+        bytes -= left;
+        this->n_chunks.pop_front();
+        this->n_offset = 0;
+    }
+}
+
+void ByteQueue::Clear() noexcept
+{
+    this->n_chunks.clear();
+    this->n_offset = 0;
+    this->n_size = 0;
+}
@@ -25,23 +25,26 @@
 
 using violet::io::experimental::BufferedInputStream;
 
-void BufferedInputStream::doRefill() noexcept
+auto BufferedInputStream::doRefill() noexcept -> Result<void>
 {
     if (this->n_pos < this->n_end) {
-        return;
+        return {};
     }
 
     this->n_pos = 0;
     this->n_end = 0;
 
-    Span<UInt8> span(this->n_buf.data(), this->n_buf.size());
-    auto result = n_src->Read(span);
-
-    if (result.Err()) {
-        return;
+    // The source keeps filling the whole buffer, so we're most likely streaming through
+    // something large; grow the buffer to cut down on the number of reads.
+    if (this->n_fullRefills >= kGrowAfterFullRefills && this->n_buf.size() < kMaxAdaptiveSize) {
+        this->n_buf.resize(std::min(this->n_buf.size() * 2, kMaxAdaptiveSize));
+        this->n_fullRefills = 0;
     }
 
-    this->n_end = result.Value();
+    this->n_end = VIOLET_TRY(this->n_src->Read(Span<UInt8>(this->n_buf.data(), this->n_buf.size())));
+    this->n_fullRefills = this->n_end == this->n_buf.size() ? this->n_fullRefills + 1 : 0;
+
+    return {};
 }
 
 auto BufferedInputStream::Read(Span<UInt8> buf) noexcept -> Result<UInt>
@@ -49,7 +52,37 @@ auto BufferedInputStream::Read(Span<UInt8> buf) noexcept -> Result<UInt>
     UInt total = 0;
     while (!buf.empty()) {
         if (this->n_pos == this->n_end) {
-            this->doRefill();
+            // Nothing is buffered and the caller wants at least a buffer's worth, so going
+            // through `n_buf` would only add a copy: read straight into their span.
+            if (buf.size() >= this->n_buf.size()) {
+                auto bytes = this->n_src->Read(buf);
+                if (bytes.Err()) {
+                    // Hand back what we already have; the error resurfaces on the next call.
+                    if (total > 0) {
+                        return total;
+                    }
+
+                    return Err(VIOLET_MOVE(bytes.Error()));
+                }
+
+                if (bytes.Value() == 0) {
+                    break;
+                }
+
+                buf = buf.subspan(bytes.Value());
+                total += bytes.Value();
+
+                continue;
+            }
+
+            if (auto res = this->doRefill(); res.Err()) {
+                if (total > 0) {
+                    return total;
+                }
+
+                return Err(VIOLET_MOVE(res.Error()));
+            }
+
             if (this->n_end == 0) {
                 break;
             }
@@ -85,3 +118,74 @@ auto BufferedInputStream::Skip(UInt bytes) noexcept -> Result<void>
     VIOLET_TRY_VOID(this->n_src->Skip(bytes));
     return {};
 }
+
+auto BufferedInputStream::FillBuf() noexcept -> Result<Span<const UInt8>>
+{
+    VIOLET_TRY_VOID(this->doRefill());
+    return Span<const UInt8>(this->n_buf.data() + this->n_pos, this->n_end - this->n_pos);
+}
+
+void BufferedInputStream::Consume(UInt bytes) noexcept
+{
+    this->n_pos += std::min(bytes, this->n_end - this->n_pos);
+}
+
+auto BufferedInputStream::ReadUntil(UInt8 delim) noexcept -> Result<Span<const UInt8>>
+{
+    // Where to resume looking for `delim`, so that bytes we already searched aren't scanned
+    // again after every refill.
+    UInt scanned = this->n_pos;
+    while (true) {
+        const auto* found = static_cast<const UInt8*>(
+            ::memchr(this->n_buf.data() + scanned, delim, this->n_end - scanned));
+
+        if (found != nullptr) {
+            const UInt start = this->n_pos;
+            this->n_pos = static_cast<UInt>(found - this->n_buf.data()) + 1;
+
+            return Span<const UInt8>(this->n_buf.data() + start, this->n_pos - start);
+        }
+
+        // Make room at the back of the buffer: slide the partial run to the front, or grow
+        // the buffer if the run already fills all of it.
+        if (this->n_pos > 0) {
+            ::memmove(this->n_buf.data(), this->n_buf.data() + this->n_pos, this->n_end - this->n_pos);
+
+            this->n_end -= this->n_pos;
+            this->n_pos = 0;
+        } else if (this->n_end == this->n_buf.size()) {
+            this->n_buf.resize(std::max<UInt>(this->n_buf.size() * 2, 64));
+        }
+
+        scanned = this->n_end;
+
+        const UInt bytes = VIOLET_TRY(
+            this->n_src->Read(Span<UInt8>(this->n_buf.data() + this->n_end, this->n_buf.size() - this->n_end)));
+
+        if (bytes == 0) {
+            const UInt start = this->n_pos;
+            this->n_pos = this->n_end;
+
+            return Span<const UInt8>(this->n_buf.data() + start, this->n_end - start);
+        }
+
+        this->n_end += bytes;
+    }
+}
+
+auto BufferedInputStream::ReadLine() noexcept -> Result<Optional<Str>>
+{
+    Span<const UInt8> line = VIOLET_TRY(this->ReadUntil('\n'));
+    if (line.empty()) {
+        return Nothing;
+    }
+
+    if (line.back() == '\n') {
+        line = line.first(line.size() - 1);
+        if (!line.empty() && line.back() == '\r') {
+            line = line.first(line.size() - 1);
+        }
+    }
+
+    return Optional<Str>(Str(reinterpret_cast<const char*>(line.data()), line.size()));
+}
@@ -25,6 +25,7 @@
 
 #include <violet/IO/Experimental/Input/FileInputStream.h>
 
+#include <fcntl.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 
@@ -62,4 +63,20 @@ auto FileInputStream::Available() const noexcept -> Result<UInt>
     // return static_cast<UInt>(st.st_size - seeked);
 }
 
+auto FileInputStream::HintSequential() const noexcept -> Result<void>
+{
+#if VIOLET_PLATFORM(LINUX)
+    // `posix_fadvise` returns the error instead of setting `errno`.
+    if (int error = ::posix_fadvise(this->n_file.Descriptor(), 0, 0, POSIX_FADV_SEQUENTIAL); error != 0) {
+        return Err(io::Error::FromOSError(error));
+    }
+#elif VIOLET_PLATFORM(APPLE_MACOS)
+    if (::fcntl(this->n_file.Descriptor(), F_RDAHEAD, 1) == -1) {
+        return Err(io::Error::OSError());
+    }
+#endif
+
+    return {};
+}
+
 #endif
@@ -21,9 +21,14 @@
 
 #include <violet/IO/Experimental/Input/FileInputStream.h>
 
-using violet::io::FileInputStream;
+using violet::io::experimental::FileInputStream;
 
 auto FileInputStream::Available() const noexcept -> Result<UInt>
 {
     return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
 }
+
+auto FileInputStream::HintSequential() const noexcept -> Result<void>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
@@ -0,0 +1,60 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/IO/Experimental/Input/MmapInputStream.h>
+
+#include <cstring>
+
+using violet::io::experimental::MmapInputStream;
+
+auto MmapInputStream::Open(const filesystem::File& file) noexcept -> Result<MmapInputStream>
+{
+    filesystem::Mmap map
+        = VIOLET_TRY(filesystem::MmapOptions{ }.Advise(filesystem::MmapAdvice::Sequential).Map(file));
+
+    return MmapInputStream(VIOLET_MOVE(map));
+}
+
+auto MmapInputStream::Read(Span<UInt8> buf) noexcept -> Result<UInt>
+{
+    auto remaining = this->Remaining();
+    if (remaining.empty() || buf.empty()) {
+        return 0;
+    }
+
+    const UInt toRead = std::min(remaining.size(), buf.size());
+    ::memcpy(buf.data(), remaining.data(), toRead);
+
+    this->n_pos += toRead;
+    return toRead;
+}
+
+auto MmapInputStream::Available() const noexcept -> Result<UInt>
+{
+    return this->Remaining().size();
+}
+
+auto MmapInputStream::Skip(UInt bytes) noexcept -> Result<void>
+{
+    this->n_pos += std::min(bytes, this->Remaining().size());
+    return {};
+}
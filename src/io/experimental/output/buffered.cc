@@ -21,48 +21,206 @@
 
 #include <violet/IO/Experimental/BufferedOutputStream.h>
 
+#include <cstring>
+
 using violet::io::experimental::BufferedOutputStream;
 
 auto BufferedOutputStream::Write(Span<const UInt8> data) noexcept -> io::Result<UInt>
 {
-    UInt written = 0;
-    Span<const UInt8> subspan = data;
+    VIOLET_TRY_VOID(this->takePending());
 
-    while (!subspan.empty()) {
-        UInt space = n_capacity - static_cast<UInt>(this->n_buffer.size());
-        UInt spaceToWrite = std::min(space, static_cast<UInt>(subspan.size()));
+    if (data.size() >= this->n_capacity) {
+        Array<Span<const UInt8>, 2> bufs = { Span<const UInt8>(this->n_buffer.get() + this->n_start,
+                                                 this->n_end - this->n_start),
+            data };
 
-        this->n_buffer.insert(this->n_buffer.end(), subspan.begin(), subspan.begin() + static_cast<Int>(spaceToWrite));
-        written += spaceToWrite;
-        subspan = subspan.subspan(spaceToWrite); // move forward in subspan
+        return this->writeThrough(bufs);
+    }
 
-        if (this->n_buffer.size() >= this->n_capacity) {
-            VIOLET_TRY_VOID(this->Flush());
-        }
+    VIOLET_TRY_VOID(this->makeRoom(data.size()));
+
+    ::memcpy(this->n_buffer.get() + this->n_end, data.data(), data.size());
+    this->n_end += data.size();
+
+    return data.size();
+}
+
+auto BufferedOutputStream::WriteVectored(Span<const Span<const UInt8>> bufs) noexcept -> io::Result<UInt>
+{
+    VIOLET_TRY_VOID(this->takePending());
+
+    UInt total = 0;
+    for (const auto& buf: bufs) {
+        total += buf.size();
     }
 
-    return written;
+    if (total >= this->n_capacity) {
+        Vec<Span<const UInt8>> all;
+        all.reserve(bufs.size() + 1);
+        all.emplace_back(this->n_buffer.get() + this->n_start, this->n_end - this->n_start);
+        all.insert(all.end(), bufs.begin(), bufs.end());
+
+        return this->writeThrough(all);
+    }
+
+    VIOLET_TRY_VOID(this->makeRoom(total));
+    for (const auto& buf: bufs) {
+        ::memcpy(this->n_buffer.get() + this->n_end, buf.data(), buf.size());
+        this->n_end += buf.size();
+    }
+
+    return total;
 }
 
 auto BufferedOutputStream::Flush() noexcept -> io::Result<void>
 {
+    VIOLET_TRY_VOID(this->takePending());
+
     if (auto result = this->doFlush(); result.Err()) {
         return Err(VIOLET_MOVE(result.Error()));
     }
 
-    return {};
+    return this->n_source->Flush();
+}
+
+auto BufferedOutputStream::Sync() noexcept -> io::Result<void>
+{
+    VIOLET_TRY_VOID(this->Flush());
+    return this->n_source->Sync();
+}
+
+auto BufferedOutputStream::SyncData() noexcept -> io::Result<void>
+{
+    VIOLET_TRY_VOID(this->Flush());
+    return this->n_source->SyncData();
 }
 
 auto BufferedOutputStream::doFlush() noexcept -> io::Result<UInt>
 {
-    if (this->n_buffer.empty()) {
-        return 0;
-    }
+    UInt written = 0;
+    while (this->n_start < this->n_end) {
+        const UInt bytes = VIOLET_TRY(this->n_source->Write(
+            Span<const UInt8>(this->n_buffer.get() + this->n_start, this->n_end - this->n_start)));
 
-    UInt written = VIOLET_TRY(this->n_source->Write(this->n_buffer));
+        if (bytes == 0) {
+            // Keep whatever wasn't written so that a later flush can retry it.
+            return Err(VIOLET_IO_ERROR(WriteZero, String, "source stream didn't accept any more bytes"));
+        }
 
-    this->n_buffer.clear();
-    VIOLET_TRY_VOID(this->n_source->Flush());
+        this->n_start += bytes;
+        written += bytes;
+    }
+
+    this->n_start = 0;
+    this->n_end = 0;
 
     return written;
 }
+
+auto BufferedOutputStream::makeRoom(UInt bytes) noexcept -> io::Result<void>
+{
+    if (bytes <= this->n_capacity - this->n_end) {
+        return { };
+    }
+
+    // A full buffer only needs to be drained into the source, the source itself
+    // doesn't need to be flushed (or synced) until the caller asks for it.
+    if (bytes > this->n_capacity - (this->n_end - this->n_start)) {
+        if (auto result = this->doFlush(); result.Err()) {
+            return Err(VIOLET_MOVE(result.Error()));
+        }
+
+        return { };
+    }
+
+    // There is enough room once a previous partial drain is slid out of the way.
+    ::memmove(this->n_buffer.get(), this->n_buffer.get() + this->n_start, this->n_end - this->n_start);
+    this->n_end -= this->n_start;
+    this->n_start = 0;
+
+    return { };
+}
+
+auto BufferedOutputStream::takePending() noexcept -> io::Result<void>
+{
+    if (this->n_pending.HasValue()) {
+        auto error = VIOLET_MOVE(this->n_pending).Value();
+        this->n_pending = Nothing;
+
+        return Err(error);
+    }
+
+    return { };
+}
+
+auto BufferedOutputStream::writeThrough(Span<Span<const UInt8>> bufs) noexcept -> io::Result<UInt>
+{
+    // `bufs[0]` is always what was buffered, so keep `n_start` in step with how much of
+    // it the source took, even when it fails halfway through.
+    auto& buffered = bufs[0];
+    auto remaining = bufs;
+
+    UInt total = 0;
+    for (const auto& buf: bufs.subspan(1)) {
+        total += buf.size();
+    }
+
+    Optional<io::Error> failure;
+    while (!remaining.empty()) {
+        if (remaining.front().empty()) {
+            remaining = remaining.subspan(1);
+            continue;
+        }
+
+        auto written = this->n_source->WriteVectored(remaining);
+        if (written.Err()) {
+            failure = VIOLET_MOVE(written.Error());
+            break;
+        }
+
+        UInt bytes = written.Value();
+        if (bytes == 0) {
+            failure = VIOLET_IO_ERROR(WriteZero, String, "source stream didn't accept any more bytes");
+            break;
+        }
+
+        while (bytes > 0 && !remaining.empty()) {
+            const UInt consumed = std::min(bytes, remaining.front().size());
+            remaining.front() = remaining.front().subspan(consumed);
+            bytes -= consumed;
+
+            if (remaining.front().empty()) {
+                remaining = remaining.subspan(1);
+            }
+        }
+    }
+
+    this->n_start = this->n_end - buffered.size();
+    if (this->n_start == this->n_end) {
+        this->n_start = 0;
+        this->n_end = 0;
+    }
+
+    if (!failure.HasValue()) {
+        return total;
+    }
+
+    // Once any of the caller's bytes went out they can't be reported as unwritten, so the
+    // error waits for the next call. The rest of the caller's data is never buffered.
+    UInt left = 0;
+    for (const auto& buf: remaining) {
+        left += buf.size();
+    }
+
+    // `remaining` still holds the unwritten part of `bufs[0]` when it didn't get past it
+    if (!remaining.empty() && remaining.data() == bufs.data()) {
+        left -= remaining.front().size();
+    }
+
+    if (left < total) {
+        this->n_pending = VIOLET_MOVE(failure);
+        return total - left;
+    }
+
+    return Err(VIOLET_MOVE(failure).Value());
+}
@@ -31,7 +31,7 @@ ByteArrayOutputStream::ByteArrayOutputStream(Vec<UInt8> buf) noexcept
 auto ByteArrayOutputStream::Write(Span<const UInt8> data) noexcept -> io::Result<UInt>
 {
     this->n_buf.insert(this->n_buf.end(), data.begin(), data.end());
-    return static_cast<UInt>(this->n_buf.size());
+    return data.size();
 }
 
 auto ByteArrayOutputStream::Flush() noexcept -> io::Result<void>
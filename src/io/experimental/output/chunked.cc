@@ -0,0 +1,118 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/IO/Experimental/Output/ChunkedOutputStream.h>
+
+#include <cstring>
+
+using violet::io::experimental::ChunkedOutputStream;
+using violet::io::experimental::OutputStream;
+
+ChunkedOutputStream::ChunkedOutputStream(UInt chunkSize) noexcept
+    : n_chunkSize(std::max<UInt>(chunkSize, 1))
+{
+}
+
+auto ChunkedOutputStream::Write(Span<const UInt8> data) noexcept -> io::Result<UInt>
+{
+    const UInt written = data.size();
+    while (!data.empty()) {
+        if (this->n_chunks.empty() || this->n_chunks.back().Size == this->n_chunkSize) {
+            this->n_chunks.push_back({ .Data = std::make_unique_for_overwrite<UInt8[]>(this->n_chunkSize) });
+        }
+
+        auto& last = this->n_chunks.back();
+        const UInt bytes = std::min(data.size(), this->n_chunkSize - last.Size);
+
+        ::memcpy(last.Data.get() + last.Size, data.data(), bytes);
+        last.Size += bytes;
+        data = data.subspan(bytes);
+    }
+
+    this->n_size += written;
+    return written;
+}
+
+auto ChunkedOutputStream::WriteVectored(Span<const Span<const UInt8>> bufs) noexcept -> io::Result<UInt>
+{
+    UInt written = 0;
+    for (const auto& buf: bufs) {
+        written += VIOLET_TRY(this->Write(buf));
+    }
+
+    return written;
+}
+
+auto ChunkedOutputStream::Chunks() const -> Vec<Span<const UInt8>>
+{
+    Vec<Span<const UInt8>> chunks;
+    chunks.reserve(this->n_chunks.size());
+
+    for (const auto& chunk: this->n_chunks) {
+        chunks.emplace_back(chunk.Data.get(), chunk.Size);
+    }
+
+    return chunks;
+}
+
+auto ChunkedOutputStream::Flatten() const -> Vec<UInt8>
+{
+    Vec<UInt8> out;
+    out.reserve(this->n_size);
+
+    for (const auto& chunk: this->n_chunks) {
+        out.insert(out.end(), chunk.Data.get(), chunk.Data.get() + chunk.Size);
+    }
+
+    return out;
+}
+
+auto ChunkedOutputStream::WriteTo(OutputStream& stream) const noexcept -> io::Result<void>
+{
+    auto chunks = this->Chunks();
+    Span<Span<const UInt8>> remaining(chunks);
+
+    while (!remaining.empty()) {
+        UInt bytes = VIOLET_TRY(stream.WriteVectored(remaining));
+        if (bytes == 0) {
+            return Err(VIOLET_IO_ERROR(WriteZero, String, "stream didn't accept any more bytes"));
+        }
+
+        while (bytes > 0 && !remaining.empty()) {
+            const UInt consumed = std::min(bytes, remaining.front().size());
+            remaining.front() = remaining.front().subspan(consumed);
+            bytes -= consumed;
+
+            if (remaining.front().empty()) {
+                remaining = remaining.subspan(1);
+            }
+        }
+    }
+
+    return { };
+}
+
+void ChunkedOutputStream::Clear() noexcept
+{
+    this->n_chunks.clear();
+    this->n_size = 0;
+}
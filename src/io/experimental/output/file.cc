@@ -23,17 +23,65 @@
 
 using violet::io::experimental::FileOutputStream;
 
-FileOutputStream::FileOutputStream(filesystem::File&& file) noexcept
+FileOutputStream::FileOutputStream(filesystem::File&& file, WriteBehind policy) noexcept
     : n_file(VIOLET_MOVE(file))
+    , n_policy(policy)
+    , n_offset(policy.Offset)
 {
 }
 
 auto FileOutputStream::Write(Span<const UInt8> buf) noexcept -> io::Result<UInt>
 {
-    return this->n_file.Write(buf);
+    UInt written = VIOLET_TRY(this->n_file.Write(buf));
+    if (this->n_policy.Window > 0) {
+        VIOLET_TRY_VOID(this->writeBehind(written));
+    }
+
+    return written;
+}
+
+auto FileOutputStream::WriteVectored(Span<const Span<const UInt8>> bufs) noexcept -> io::Result<UInt>
+{
+    UInt written = VIOLET_TRY(this->n_file.WriteVectored(bufs));
+    if (this->n_policy.Window > 0) {
+        VIOLET_TRY_VOID(this->writeBehind(written));
+    }
+
+    return written;
 }
 
 auto FileOutputStream::Flush() noexcept -> io::Result<void>
 {
     return this->n_file.Flush();
 }
+
+auto FileOutputStream::Sync() noexcept -> io::Result<void>
+{
+    return this->n_file.Sync();
+}
+
+auto FileOutputStream::SyncData() noexcept -> io::Result<void>
+{
+    return this->n_file.SyncData();
+}
+
+auto FileOutputStream::writeBehind(UInt written) noexcept -> io::Result<void>
+{
+    this->n_pending += written;
+    if (this->n_pending < this->n_policy.Window) {
+        return { };
+    }
+
+    // Kick off writeback for the window we just filled, then wait for the one before it
+    // so that at most two windows are ever dirty at once.
+    VIOLET_TRY_VOID(this->n_file.SyncRange(this->n_offset, this->n_pending));
+    if (this->n_previous > 0) {
+        VIOLET_TRY_VOID(this->n_file.SyncRange(this->n_offset - this->n_previous, this->n_previous, /*wait=*/true));
+    }
+
+    this->n_offset += this->n_pending;
+    this->n_previous = this->n_pending;
+    this->n_pending = 0;
+
+    return { };
+}
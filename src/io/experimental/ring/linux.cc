@@ -0,0 +1,381 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/Violet.h>
+
+#if VIOLET_PLATFORM(LINUX)
+
+#include <liburing.h>
+#include <violet/IO/Experimental/Ring.h>
+
+#include <algorithm>
+
+using violet::experimental::chrono::Duration;
+using violet::io::Error;
+using violet::io::experimental::Completion;
+using violet::io::experimental::Ring;
+using violet::io::experimental::RingFile;
+using violet::io::experimental::RingOptions;
+
+struct Ring::Impl final {
+    VIOLET_DISALLOW_COPY_AND_MOVE(Impl);
+
+    VIOLET_IMPLICIT Impl() = default;
+    ~Impl()
+    {
+        if (this->Ready) {
+            ::io_uring_queue_exit(&this->Ring);
+        }
+    }
+
+    struct io_uring Ring{ };
+    bool Ready = false; ///< whether `Ring` was set up and has to be torn down.
+    Vec<Span<UInt8>> Buffers; ///< the buffers registered with `RegisterBuffers`, for bounds checks.
+    UInt InFlight = 0;
+
+    /// Returns a free submission queue entry, submitting what's queued when there's none left.
+    auto Entry() -> io::Result<struct io_uring_sqe*>
+    {
+        struct io_uring_sqe* sqe = ::io_uring_get_sqe(&this->Ring);
+        if (sqe != nullptr) {
+            return sqe;
+        }
+
+        if (auto submitted = this->Submit(); submitted.Err()) {
+            return Err(VIOLET_MOVE(submitted.Error()));
+        }
+
+        sqe = ::io_uring_get_sqe(&this->Ring);
+        if (sqe == nullptr) {
+            return Err(VIOLET_IO_ERROR(WouldBlock, String, "the submission queue is still full after submitting"));
+        }
+
+        return sqe;
+    }
+
+    auto Submit() -> io::Result<UInt>
+    {
+        while (true) {
+            Int32 ret = ::io_uring_submit(&this->Ring);
+            if (ret < 0) {
+                if (ret == -EINTR) {
+                    continue;
+                }
+
+                return Err(Error::FromOSError(-ret));
+            }
+
+            this->InFlight += static_cast<UInt>(ret);
+            return static_cast<UInt>(ret);
+        }
+    }
+
+    auto Reap(Span<Completion> out) -> UInt
+    {
+        constexpr UInt kBatch = 64;
+
+        UInt reaped = 0;
+        while (reaped < out.size()) {
+            Array<struct io_uring_cqe*, kBatch> cqes{ };
+            auto count = ::io_uring_peek_batch_cqe(
+                &this->Ring, cqes.data(), static_cast<unsigned>(std::min(kBatch, out.size() - reaped)));
+
+            if (count == 0) {
+                break;
+            }
+
+            for (UInt i = 0; i < count; i++) {
+                out[reaped + i].UserData = ::io_uring_cqe_get_data64(cqes[i]);
+                out[reaped + i].n_result = cqes[i]->res;
+            }
+
+            ::io_uring_cq_advance(&this->Ring, count);
+            reaped += count;
+        }
+
+        this->InFlight -= std::min(this->InFlight, reaped);
+        return reaped;
+    }
+};
+
+namespace {
+
+void target(struct io_uring_sqe* sqe, bool fixed, violet::UInt64 userData)
+{
+    if (fixed) {
+        ::io_uring_sqe_set_flags(sqe, IOSQE_FIXED_FILE);
+    }
+
+    ::io_uring_sqe_set_data64(sqe, userData);
+}
+
+auto withinRegistered(violet::Span<const violet::Span<violet::UInt8>> buffers, const violet::UInt8* data,
+    violet::UInt size, violet::UInt16 index) -> violet::io::Result<void>
+{
+    if (index >= buffers.size()) {
+        return VIOLET_IO_ERROR(InvalidInput, violet::String, "there is no registered buffer at that index");
+    }
+
+    const auto& registered = buffers[index];
+    if (data < registered.data() || data + size > registered.data() + registered.size()) {
+        return VIOLET_IO_ERROR(InvalidInput, violet::String, "buffer doesn't lie within the registered buffer");
+    }
+
+    return { };
+}
+
+} // namespace
+
+Ring::Ring(Impl* impl) noexcept
+    : n_impl(impl)
+{
+}
+
+Ring::Ring(Ring&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+auto Ring::operator=(Ring&& other) noexcept -> Ring&
+{
+    if (this != &other) {
+        delete this->n_impl;
+        this->n_impl = std::exchange(other.n_impl, nullptr);
+    }
+
+    return *this;
+}
+
+Ring::~Ring()
+{
+    if (this->n_impl != nullptr) {
+        delete this->n_impl;
+        this->n_impl = nullptr;
+    }
+}
+
+auto Ring::New(RingOptions options) -> io::Result<Ring>
+{
+    struct io_uring_params params{ };
+    if (options.CompletionEntries != 0) {
+        params.flags |= IORING_SETUP_CQSIZE;
+        params.cq_entries = options.CompletionEntries;
+    }
+
+    if (options.SubmissionPolling) {
+        params.flags |= IORING_SETUP_SQPOLL;
+    }
+
+    auto impl = std::make_unique<Impl>();
+    if (Int32 ret = ::io_uring_queue_init_params(options.Entries, &impl->Ring, &params); ret < 0) {
+        return Err(Error::FromOSError(-ret));
+    }
+
+    impl->Ready = true;
+    return Ring(impl.release());
+}
+
+auto Ring::RegisterBuffers(Span<const Span<UInt8>> buffers) -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+
+    Vec<struct iovec> iovecs;
+    iovecs.reserve(buffers.size());
+    for (const auto& buffer: buffers) {
+        iovecs.push_back({ .iov_base = buffer.data(), .iov_len = buffer.size() });
+    }
+
+    Int32 ret = ::io_uring_register_buffers(&this->n_impl->Ring, iovecs.data(), static_cast<unsigned>(iovecs.size()));
+    if (ret < 0) {
+        return Err(Error::FromOSError(-ret));
+    }
+
+    this->n_impl->Buffers.assign(buffers.begin(), buffers.end());
+    return { };
+}
+
+auto Ring::UnregisterBuffers() -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    if (Int32 ret = ::io_uring_unregister_buffers(&this->n_impl->Ring); ret < 0) {
+        return Err(Error::FromOSError(-ret));
+    }
+
+    this->n_impl->Buffers.clear();
+    return { };
+}
+
+auto Ring::RegisterFiles(Span<const FileDescriptor::value_type> fds) -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    if (Int32 ret = ::io_uring_register_files(&this->n_impl->Ring, fds.data(), static_cast<unsigned>(fds.size()));
+        ret < 0) {
+        return Err(Error::FromOSError(-ret));
+    }
+
+    return { };
+}
+
+auto Ring::UpdateFiles(UInt32 offset, Span<const FileDescriptor::value_type> fds) -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+
+    Int32 ret = ::io_uring_register_files_update(
+        &this->n_impl->Ring, offset, fds.data(), static_cast<unsigned>(fds.size()));
+
+    if (ret < 0) {
+        return Err(Error::FromOSError(-ret));
+    }
+
+    return { };
+}
+
+auto Ring::UnregisterFiles() -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    if (Int32 ret = ::io_uring_unregister_files(&this->n_impl->Ring); ret < 0) {
+        return Err(Error::FromOSError(-ret));
+    }
+
+    return { };
+}
+
+auto Ring::ReadAt(RingFile file, Span<UInt8> buf, UInt64 offset, UInt64 userData) -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+
+    auto* sqe = VIOLET_TRY(this->n_impl->Entry());
+    ::io_uring_prep_read(sqe, file.n_fd, buf.data(), static_cast<unsigned>(buf.size()), offset);
+    target(sqe, file.n_fixed, userData);
+
+    return { };
+}
+
+auto Ring::WriteAt(RingFile file, Span<const UInt8> buf, UInt64 offset, UInt64 userData) -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+
+    auto* sqe = VIOLET_TRY(this->n_impl->Entry());
+    ::io_uring_prep_write(sqe, file.n_fd, buf.data(), static_cast<unsigned>(buf.size()), offset);
+    target(sqe, file.n_fixed, userData);
+
+    return { };
+}
+
+auto Ring::ReadFixed(RingFile file, Span<UInt8> buf, UInt64 offset, UInt16 index, UInt64 userData)
+    -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    VIOLET_TRY_VOID(withinRegistered(this->n_impl->Buffers, buf.data(), buf.size(), index));
+
+    auto* sqe = VIOLET_TRY(this->n_impl->Entry());
+    ::io_uring_prep_read_fixed(sqe, file.n_fd, buf.data(), static_cast<unsigned>(buf.size()), offset, index);
+    target(sqe, file.n_fixed, userData);
+
+    return { };
+}
+
+auto Ring::WriteFixed(RingFile file, Span<const UInt8> buf, UInt64 offset, UInt16 index, UInt64 userData)
+    -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    VIOLET_TRY_VOID(withinRegistered(this->n_impl->Buffers, buf.data(), buf.size(), index));
+
+    auto* sqe = VIOLET_TRY(this->n_impl->Entry());
+    ::io_uring_prep_write_fixed(sqe, file.n_fd, buf.data(), static_cast<unsigned>(buf.size()), offset, index);
+    target(sqe, file.n_fixed, userData);
+
+    return { };
+}
+
+auto Ring::Sync(RingFile file, bool dataOnly, UInt64 userData) -> io::Result<void>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+
+    auto* sqe = VIOLET_TRY(this->n_impl->Entry());
+    ::io_uring_prep_fsync(sqe, file.n_fd, dataOnly ? IORING_FSYNC_DATASYNC : 0);
+    target(sqe, file.n_fixed, userData);
+
+    return { };
+}
+
+auto Ring::Submit() -> io::Result<UInt>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    return this->n_impl->Submit();
+}
+
+auto Ring::Poll(Span<Completion> out) -> UInt
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    return this->n_impl->Reap(out);
+}
+
+auto Ring::Wait(Span<Completion> out, UInt minimum, Optional<Duration> timeout) -> io::Result<UInt>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    if (auto submitted = this->n_impl->Submit(); submitted.Err()) {
+        return Err(VIOLET_MOVE(submitted.Error()));
+    }
+
+    minimum = std::min({ minimum, out.size(), this->n_impl->InFlight });
+    if (minimum == 0) {
+        return this->n_impl->Reap(out);
+    }
+
+    struct __kernel_timespec ts{ };
+    if (timeout.HasValue()) {
+        auto nanos = std::max<Int64>(timeout.Value().AsNanos(), 0);
+        ts.tv_sec = nanos / 1'000'000'000;
+        ts.tv_nsec = nanos % 1'000'000'000;
+    }
+
+    while (true) {
+        struct io_uring_cqe* cqe = nullptr;
+        Int32 ret = ::io_uring_wait_cqes(&this->n_impl->Ring, &cqe, static_cast<unsigned>(minimum),
+            timeout.HasValue() ? &ts : nullptr, /*sigmask=*/nullptr);
+
+        if (ret == -EINTR) {
+            continue;
+        }
+
+        if (ret < 0 && ret != -ETIME) {
+            return Err(Error::FromOSError(-ret));
+        }
+
+        return this->n_impl->Reap(out);
+    }
+}
+
+auto Ring::Queued() const noexcept -> UInt
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    return ::io_uring_sq_ready(&this->n_impl->Ring);
+}
+
+auto Ring::InFlight() const noexcept -> UInt
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    return this->n_impl->InFlight;
+}
+
+#endif
@@ -0,0 +1,87 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/IO/Experimental/Ring.h>
+
+using violet::experimental::chrono::Duration;
+using violet::io::experimental::Completion;
+using violet::io::experimental::Ring;
+using violet::io::experimental::RingFile;
+using violet::io::experimental::RingOptions;
+
+struct Ring::Impl final {
+    Impl() = delete;
+};
+
+Ring::Ring(Ring&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+auto Ring::operator=(Ring&& other) noexcept -> Ring&
+{
+    this->n_impl = std::exchange(other.n_impl, nullptr);
+    return *this;
+}
+
+Ring::~Ring() = default;
+
+auto Ring::New(RingOptions) -> io::Result<Ring>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+#define MK_UNSUPPORTED_OP(NAME, RETURN, ...)                                                                           \
+    auto Ring::NAME(__VA_ARGS__) -> RETURN                                                                             \
+    {                                                                                                                  \
+        return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));                                     \
+    }
+
+MK_UNSUPPORTED_OP(RegisterBuffers, io::Result<void>, Span<const Span<UInt8>>);
+MK_UNSUPPORTED_OP(UnregisterBuffers, io::Result<void>);
+MK_UNSUPPORTED_OP(RegisterFiles, io::Result<void>, Span<const FileDescriptor::value_type>);
+MK_UNSUPPORTED_OP(UpdateFiles, io::Result<void>, UInt32, Span<const FileDescriptor::value_type>);
+MK_UNSUPPORTED_OP(UnregisterFiles, io::Result<void>);
+MK_UNSUPPORTED_OP(ReadAt, io::Result<void>, RingFile, Span<UInt8>, UInt64, UInt64);
+MK_UNSUPPORTED_OP(WriteAt, io::Result<void>, RingFile, Span<const UInt8>, UInt64, UInt64);
+MK_UNSUPPORTED_OP(ReadFixed, io::Result<void>, RingFile, Span<UInt8>, UInt64, UInt16, UInt64);
+MK_UNSUPPORTED_OP(WriteFixed, io::Result<void>, RingFile, Span<const UInt8>, UInt64, UInt16, UInt64);
+MK_UNSUPPORTED_OP(Sync, io::Result<void>, RingFile, bool, UInt64);
+MK_UNSUPPORTED_OP(Submit, io::Result<UInt>);
+MK_UNSUPPORTED_OP(Wait, io::Result<UInt>, Span<Completion>, UInt, Optional<Duration>);
+
+#undef MK_UNSUPPORTED_OP
+
+auto Ring::Poll(Span<Completion>) -> UInt
+{
+    return 0;
+}
+
+auto Ring::Queued() const noexcept -> UInt
+{
+    return 0;
+}
+
+auto Ring::InFlight() const noexcept -> UInt
+{
+    return 0;
+}
@@ -25,10 +25,15 @@
 
 #include <violet/IO/Descriptor.h>
 
+#include <algorithm>
+#include <climits>
+#include <fcntl.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 using violet::Int32;
 using violet::io::FileDescriptor;
+using violet::io::IOFlag;
 
 FileDescriptor::FileDescriptor(Int32 fd) noexcept
     : n_fd(fd)
@@ -126,19 +131,327 @@ auto FileDescriptor::Write(Span<const UInt8> buf) const noexcept -> Result<UInt>
 
 auto FileDescriptor::Flush() const noexcept -> io::Result<void>
 {
-    if (this->Valid() && ::fsync(this->Get()) == -1) {
-        // For now, it is ok to ignore `EINVAL` since this means
-        // that the file descriptor wasn't a valid one (i.e, `STDOUT_FILENO`)
-        if (errno == EINVAL) {
-            return { };
+    return { };
+}
+
+namespace {
+
+/// The `iovec`s for a list of buffers, kept inline for the common case of a handful of them.
+struct iovecs final {
+    template<typename T>
+    VIOLET_EXPLICIT iovecs(violet::Span<const violet::Span<T>> bufs)
+        : n_count(bufs.size())
+    {
+        if (bufs.size() > kInline) {
+            this->n_heap.resize(bufs.size());
+        }
+
+        auto* vecs = this->n_heap.empty() ? this->n_inline.data() : this->n_heap.data();
+        for (violet::UInt i = 0; i < bufs.size(); i++) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            vecs[i] = { .iov_base = const_cast<violet::UInt8*>(bufs[i].data()), .iov_len = bufs[i].size() };
+        }
+    }
+
+    /// Returns the `iovec`s that are left, at most `IOV_MAX` at a time.
+    [[nodiscard]] auto Data() noexcept -> struct iovec*
+    {
+        return (this->n_heap.empty() ? this->n_inline.data() : this->n_heap.data()) + this->n_start;
+    }
+
+    [[nodiscard]] auto Count() const noexcept -> int
+    {
+        return static_cast<int>(std::min<violet::UInt>(this->n_count - this->n_start, IOV_MAX));
+    }
+
+    [[nodiscard]] auto Empty() const noexcept -> bool
+    {
+        return this->n_start == this->n_count;
+    }
+
+    /// Drops the first `bytes` bytes after a short write, skipping the buffers that are done.
+    void Advance(violet::UInt bytes) noexcept
+    {
+        auto* vecs = this->n_heap.empty() ? this->n_inline.data() : this->n_heap.data();
+        while (this->n_start < this->n_count && bytes >= vecs[this->n_start].iov_len) {
+            bytes -= vecs[this->n_start++].iov_len;
+        }
+
+        if (this->n_start < this->n_count) {
+            vecs[this->n_start].iov_base = static_cast<violet::UInt8*>(vecs[this->n_start].iov_base) + bytes;
+            vecs[this->n_start].iov_len -= bytes;
+        }
+    }
+
+private:
+    static constexpr violet::UInt kInline = 8;
+
+    violet::Array<struct iovec, kInline> n_inline{ };
+    violet::Vec<struct iovec> n_heap;
+    violet::UInt n_start = 0;
+    violet::UInt n_count;
+};
+
+#if VIOLET_PLATFORM(LINUX)
+auto rwFlags(violet::Bitflags<IOFlag> flags) noexcept -> int
+{
+    int rw = 0;
+    if (flags.Contains(IOFlag::NoWait)) {
+        rw |= RWF_NOWAIT;
+    }
+
+    if (flags.Contains(IOFlag::DataSync)) {
+        rw |= RWF_DSYNC;
+    }
+
+    if (flags.Contains(IOFlag::Sync)) {
+        rw |= RWF_SYNC;
+    }
+
+    if (flags.Contains(IOFlag::HighPriority)) {
+        rw |= RWF_HIPRI;
+    }
+
+    return rw;
+}
+#endif
+
+auto readv(Int32 fd, iovecs& vecs, violet::Optional<violet::UInt64> offset, violet::Bitflags<IOFlag> flags)
+    -> violet::io::Result<violet::UInt>
+{
+#if !VIOLET_PLATFORM(LINUX)
+    if (flags.Contains(IOFlag::NoWait)) {
+        return violet::Err(VIOLET_IO_ERROR(Unsupported, violet::String, "`IOFlag::NoWait` is only supported on Linux"));
+    }
+#endif
+
+    ssize_t bytes = 0;
+    do {
+        if (!offset.HasValue()) {
+            bytes = ::readv(fd, vecs.Data(), vecs.Count());
+        }
+#if VIOLET_PLATFORM(LINUX)
+        else if (flags.Get() != 0) {
+            bytes = ::preadv2(fd, vecs.Data(), vecs.Count(), static_cast<off_t>(offset.Value()), rwFlags(flags));
         }
+#endif
+        else {
+            bytes = ::preadv(fd, vecs.Data(), vecs.Count(), static_cast<off_t>(offset.Value()));
+        }
+    } while (bytes == -1 && errno == EINTR);
+
+    if (bytes == -1) {
+        return violet::Err(violet::io::Error::OSError());
+    }
+
+    return static_cast<violet::UInt>(bytes);
+}
+
+auto writev(const FileDescriptor& fd, iovecs& vecs, violet::Optional<violet::UInt64> offset,
+    violet::Bitflags<IOFlag> flags) -> violet::io::Result<violet::UInt>
+{
+#if !VIOLET_PLATFORM(LINUX)
+    if (flags.Contains(IOFlag::NoWait)) {
+        return violet::Err(VIOLET_IO_ERROR(Unsupported, violet::String, "`IOFlag::NoWait` is only supported on Linux"));
+    }
+#endif
+
+    violet::UInt total = 0;
+    while (!vecs.Empty()) {
+        ssize_t bytes = 0;
+        if (!offset.HasValue()) {
+            bytes = ::writev(fd.Get(), vecs.Data(), vecs.Count());
+        }
+#if VIOLET_PLATFORM(LINUX)
+        else if (flags.Get() != 0) {
+            bytes = ::pwritev2(fd.Get(), vecs.Data(), vecs.Count(), static_cast<off_t>(offset.Value() + total),
+                rwFlags(flags));
+        }
+#endif
+        else {
+            bytes = ::pwritev(fd.Get(), vecs.Data(), vecs.Count(), static_cast<off_t>(offset.Value() + total));
+        }
+
+        if (bytes == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (errno == EAGAIN && flags.Contains(IOFlag::NoWait) && total > 0) {
+                return total;
+            }
+
+            return violet::Err(violet::io::Error::OSError());
+        }
+
+        total += static_cast<violet::UInt>(bytes);
+        vecs.Advance(static_cast<violet::UInt>(bytes));
+    }
+
+#if !VIOLET_PLATFORM(LINUX)
+    if (flags.Contains(IOFlag::Sync)) {
+        VIOLET_TRY_VOID(fd.Sync());
+    } else if (flags.Contains(IOFlag::DataSync)) {
+        VIOLET_TRY_VOID(fd.SyncData());
+    }
+#endif
+
+    return total;
+}
+
+} // namespace
+
+auto FileDescriptor::ReadAt(Span<UInt8> buf, UInt64 offset, Bitflags<IOFlag> flags) const noexcept
+    -> io::Result<UInt>
+{
+    if (!this->Valid()) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "operation on an invalid file descriptor"));
+    }
+
+    if (buf.empty()) {
+        return 0;
+    }
+
+    if (flags.Get() != 0) {
+        const Span<UInt8> bufs[] = { buf }; // NOLINT(modernize-avoid-c-arrays)
+        return this->ReadVectoredAt(bufs, offset, flags);
+    }
+
+    ssize_t bytes = 0;
+    do {
+        bytes = ::pread(this->Get(), buf.data(), buf.size(), static_cast<off_t>(offset));
+    } while (bytes == -1 && errno == EINTR);
+
+    if (bytes == -1) {
+        return Err(Error::OSError());
+    }
+
+    return static_cast<UInt>(bytes);
+}
+
+auto FileDescriptor::WriteAt(Span<const UInt8> buf, UInt64 offset, Bitflags<IOFlag> flags) const noexcept
+    -> io::Result<UInt>
+{
+    const Span<const UInt8> bufs[] = { buf }; // NOLINT(modernize-avoid-c-arrays)
+    return this->WriteVectoredAt(bufs, offset, flags);
+}
+
+auto FileDescriptor::ReadVectored(Span<const Span<UInt8>> bufs) const noexcept -> io::Result<UInt>
+{
+    if (!this->Valid()) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "operation on an invalid file descriptor"));
+    }
+
+    iovecs vecs(bufs);
+    return readv(this->Get(), vecs, Nothing, { });
+}
+
+auto FileDescriptor::ReadVectoredAt(Span<const Span<UInt8>> bufs, UInt64 offset, Bitflags<IOFlag> flags) const noexcept
+    -> io::Result<UInt>
+{
+    if (!this->Valid()) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "operation on an invalid file descriptor"));
+    }
+
+    iovecs vecs(bufs);
+    return readv(this->Get(), vecs, offset, flags);
+}
+
+auto FileDescriptor::WriteVectored(Span<const Span<const UInt8>> bufs) const noexcept -> io::Result<UInt>
+{
+    if (!this->Valid()) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "operation on an invalid file descriptor"));
+    }
+
+    iovecs vecs(bufs);
+    return writev(*this, vecs, Nothing, { });
+}
+
+auto FileDescriptor::WriteVectoredAt(
+    Span<const Span<const UInt8>> bufs, UInt64 offset, Bitflags<IOFlag> flags) const noexcept -> io::Result<UInt>
+{
+    if (!this->Valid()) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "operation on an invalid file descriptor"));
+    }
+
+    iovecs vecs(bufs);
+    return writev(*this, vecs, offset, flags);
+}
+
+namespace {
 
+// `EINVAL` and `EROFS` mean that the descriptor doesn't support synchronization (i.e, `STDOUT_FILENO`
+// pointing to a terminal, a pipe or a socket), which is fine to ignore as there's nothing to flush.
+auto isUnsyncable(Int32 error) noexcept -> bool
+{
+    return error == EINVAL || error == EROFS;
+}
+
+} // namespace
+
+auto FileDescriptor::Sync() const noexcept -> io::Result<void>
+{
+    if (!this->Valid()) {
+        return { };
+    }
+
+#if VIOLET_PLATFORM(APPLE_MACOS)
+    if (::fcntl(this->Get(), F_FULLFSYNC) != -1) {
+        return { };
+    }
+#endif
+
+    if (::fsync(this->Get()) == -1 && !isUnsyncable(errno)) {
         return Err(Error::OSError());
     }
 
     return { };
 }
 
+auto FileDescriptor::SyncData() const noexcept -> io::Result<void>
+{
+#if VIOLET_PLATFORM(LINUX)
+    if (this->Valid() && ::fdatasync(this->Get()) == -1 && !isUnsyncable(errno)) {
+        return Err(Error::OSError());
+    }
+
+    return { };
+#else
+    return this->Sync();
+#endif
+}
+
+auto FileDescriptor::SyncRange(UInt64 offset, UInt64 length, bool wait) const noexcept -> io::Result<void>
+{
+    if (!this->Valid() || length == 0) {
+        return { };
+    }
+
+#if VIOLET_PLATFORM(LINUX)
+    unsigned int flags = SYNC_FILE_RANGE_WRITE;
+    if (wait) {
+        flags |= SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WAIT_AFTER;
+    }
+
+    Int32 ret = 0;
+    do {
+        ret = ::sync_file_range(this->Get(), static_cast<off64_t>(offset), static_cast<off64_t>(length), flags);
+    } while (ret == -1 && errno == EINTR);
+
+    if (ret == -1 && !isUnsyncable(errno) && errno != ESPIPE) {
+        return Err(Error::OSError());
+    }
+
+    return { };
+#else
+    if (wait) {
+        return this->SyncData();
+    }
+
+    return { };
+#endif
+}
+
 FileDescriptor::operator bool() const noexcept
 {
     return this->Valid();
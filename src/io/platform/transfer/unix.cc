@@ -0,0 +1,251 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <violet/Violet.h>
+
+#if VIOLET_PLATFORM(UNIX)
+
+#include <violet/IO/Transfer.h>
+
+#include <algorithm>
+#include <memory>
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if VIOLET_PLATFORM(LINUX)
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#endif
+
+using violet::Int32;
+using violet::Int64;
+using violet::UInt;
+using violet::UInt64;
+using violet::UInt8;
+using violet::io::Error;
+using violet::io::Result;
+
+namespace {
+
+/// The size of the bounce buffer when the kernel can't move the data by itself.
+constexpr UInt kBufferSize = 64 * 1024;
+
+#if VIOLET_PLATFORM(LINUX)
+/// The most that `copy_file_range(2)`, `sendfile(2)` and `splice(2)` move in one call anyway.
+constexpr UInt64 kMaxChunk = 0x7ffff000;
+
+/// Whether `err` means that the kernel doesn't support this pair of descriptors for the
+/// primitive that was tried, so the next one should be tried instead.
+auto unsupportedPair(Int32 err) -> bool
+{
+    return err == EINVAL || err == ENOSYS || err == EXDEV || err == EOPNOTSUPP || err == EBADF;
+}
+
+/// Drives one of the kernel primitives until `count` bytes were moved or `src` ran dry.
+///
+/// @returns **true** if the transfer is done, or **false** if the kernel refused the pair
+/// and the rest has to be moved by something else.
+template<typename Fn>
+auto kernelLoop(Fn&& fn, UInt64 count, UInt64& done) -> Result<bool>
+{
+    while (done < count) {
+        Int64 moved = fn(static_cast<UInt>(std::min(count - done, kMaxChunk)));
+        if (moved > 0) {
+            done += static_cast<UInt64>(moved);
+            continue;
+        }
+
+        if (moved == 0) {
+            return true;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+
+        if (errno == EAGAIN && done > 0) {
+            return true;
+        }
+
+        // only fall back if nothing was moved yet: a failure halfway through is a real error
+        if (unsupportedPair(errno) && done == 0) {
+            return false;
+        }
+
+        return violet::Err(Error::OSError());
+    }
+
+    return true;
+}
+#endif
+
+auto writeAll(Int32 fd, const UInt8* data, UInt size) -> Result<void>
+{
+    UInt written = 0;
+    while (written < size) {
+        Int64 bytes = ::write(fd, data + written, size - written);
+        if (bytes >= 0) {
+            written += static_cast<UInt>(bytes);
+            continue;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+
+        // the data was already taken out of `src`, so wait for `dst` instead of dropping it
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            struct pollfd pfd = { .fd = fd, .events = POLLOUT, .revents = 0 };
+            if (::poll(&pfd, 1, -1) < 0 && errno != EINTR) {
+                return violet::Err(Error::OSError());
+            }
+
+            continue;
+        }
+
+        return violet::Err(Error::OSError());
+    }
+
+    return { };
+}
+
+auto copyThroughUserspace(Int32 src, Int32 dst, UInt64 count, UInt64 done) -> Result<UInt64>
+{
+    auto buffer = std::make_unique_for_overwrite<UInt8[]>(kBufferSize);
+    while (done < count) {
+        Int64 bytes = ::read(src, buffer.get(), static_cast<UInt>(std::min<UInt64>(count - done, kBufferSize)));
+        if (bytes == 0) {
+            break;
+        }
+
+        if (bytes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if ((errno == EAGAIN || errno == EWOULDBLOCK) && done > 0) {
+                break;
+            }
+
+            return violet::Err(Error::OSError());
+        }
+
+        VIOLET_TRY_VOID(writeAll(dst, buffer.get(), static_cast<UInt>(bytes)));
+        done += static_cast<UInt64>(bytes);
+    }
+
+    return done;
+}
+
+} // namespace
+
+auto violet::io::Transfer(Int32 src, Int32 dst, UInt64 count) noexcept -> Result<UInt64>
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    struct stat srcStat{};
+    struct stat dstStat{};
+    if (::fstat(src, &srcStat) < 0 || ::fstat(dst, &dstStat) < 0) {
+        return Err(Error::OSError());
+    }
+
+    UInt64 done = 0;
+
+#if VIOLET_PLATFORM(LINUX)
+    // `copy_file_range(2)` reports files in pseudo-filesystems like procfs (which claim a size
+    // of zero) as empty, so those go through `sendfile(2)` instead.
+    if (S_ISREG(srcStat.st_mode) && S_ISREG(dstStat.st_mode) && srcStat.st_size > 0) {
+        auto finished = kernelLoop(
+            [src, dst](UInt chunk) -> Int64 { return ::copy_file_range(src, nullptr, dst, nullptr, chunk, 0); },
+            count, done);
+
+        if (finished.Err()) {
+            return Err(VIOLET_MOVE(finished.Error()));
+        }
+
+        if (finished.Value()) {
+            return done;
+        }
+    }
+
+    if (S_ISFIFO(srcStat.st_mode) || S_ISFIFO(dstStat.st_mode)) {
+        auto finished = kernelLoop(
+            [src, dst](UInt chunk) -> Int64 {
+                return ::splice(src, nullptr, dst, nullptr, chunk, SPLICE_F_MOVE | SPLICE_F_MORE);
+            },
+            count, done);
+
+        if (finished.Err()) {
+            return Err(VIOLET_MOVE(finished.Error()));
+        }
+
+        if (finished.Value()) {
+            return done;
+        }
+    }
+
+    if (S_ISREG(srcStat.st_mode) || S_ISBLK(srcStat.st_mode)) {
+        auto finished
+            = kernelLoop([src, dst](UInt chunk) -> Int64 { return ::sendfile(dst, src, nullptr, chunk); }, count, done);
+
+        if (finished.Err()) {
+            return Err(VIOLET_MOVE(finished.Error()));
+        }
+
+        if (finished.Value()) {
+            return done;
+        }
+    }
+#endif
+
+    return copyThroughUserspace(src, dst, count, done);
+}
+
+#if VIOLET_PLATFORM(LINUX)
+auto violet::io::Tee(Int32 src, Int32 dst, UInt64 count) noexcept -> Result<UInt64>
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    Int64 bytes = 0;
+    do {
+        bytes = ::tee(src, dst, static_cast<UInt>(std::min(count, kMaxChunk)), 0);
+    } while (bytes < 0 && errno == EINTR);
+
+    if (bytes < 0) {
+        return Err(Error::OSError());
+    }
+
+    return static_cast<UInt64>(bytes);
+}
+#else
+auto violet::io::Tee(Int32, Int32, UInt64) noexcept -> Result<UInt64>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "`tee(2)` is only available on Linux"));
+}
+#endif
+
+#endif
@@ -24,9 +24,16 @@
 
 auto violet::io::Read(Vec<UInt8>& data, Span<UInt8> buf) -> Result<UInt>
 {
-    UInt minToCopy = std::min(buf.size(), data.size());
-    std::copy_n(data.begin(), minToCopy, buf.begin());
-    data.erase(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(minToCopy));
+    ByteCursor cursor(data);
+    const UInt bytes = VIOLET_TRY(cursor.Read(buf));
 
-    return minToCopy;
+    // Draining everything (the common case when `buf` is large enough) doesn't need to
+    // shift anything.
+    if (cursor.EOS()) {
+        data.clear();
+    } else {
+        data.erase(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(bytes));
+    }
+
+    return bytes;
 }
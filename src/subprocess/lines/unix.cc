@@ -0,0 +1,325 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Violet.h>
+
+#if VIOLET_PLATFORM(UNIX)
+
+#include <violet/Subprocess.h>
+
+#include <algorithm>
+#include <cstring>
+#include <poll.h>
+#include <unistd.h>
+
+using violet::Array;
+using violet::Err;
+using violet::Int32;
+using violet::Int64;
+using violet::Nothing;
+using violet::Optional;
+using violet::Str;
+using violet::UInt;
+using violet::Vec;
+using violet::subprocess::Child;
+using violet::subprocess::ChildLine;
+using violet::subprocess::ChildLines;
+using violet::subprocess::ChildStream;
+using violet::subprocess::LineOptions;
+
+constexpr UInt kReadSize = 8192;
+
+namespace {
+
+/// A stream being read, and the buffer its lines are yielded from.
+struct source final {
+    violet::io::FileDescriptor Descriptor;
+    ChildStream Stream;
+    Vec<char> Buffer;
+    UInt Start = 0; ///< where the next line begins in `Buffer`
+    UInt Scanned = 0; ///< how many bytes past `Start` are known not to hold a `\n`
+    UInt End = 0; ///< how much of `Buffer` was filled
+    bool Closed = false; ///< whether end-of-file was reached, or reading failed
+    bool Cut = false; ///< whether bytes before the tail window were thrown away
+};
+
+/// Takes the next line out of what `src` buffered.
+auto nextLine(source& src, const LineOptions& options) -> Optional<Str>
+{
+    // tailing only yields once the whole stream was seen
+    if (options.Tail.HasValue() && !src.Closed) {
+        return Nothing;
+    }
+
+    char* data = src.Buffer.data();
+    if (const auto* newline = static_cast<const char*>(
+            std::memchr(data + src.Start + src.Scanned, '\n', src.End - src.Start - src.Scanned))) {
+        UInt at = newline - data;
+        Str line(data + src.Start, at - src.Start);
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
+        }
+
+        src.Start = at + 1;
+        src.Scanned = 0;
+
+        return line;
+    }
+
+    UInt pending = src.End - src.Start;
+    src.Scanned = pending;
+
+    if (pending > 0 && (src.Closed || pending >= options.MaxLineLength)) {
+        Str line(data + src.Start, std::min(pending, options.MaxLineLength));
+        src.Start += line.size();
+        src.Scanned = 0;
+
+        return line;
+    }
+
+    return Nothing;
+}
+
+/// Moves the start of `src`'s tail window to the first line that is whole within it.
+void settleTail(source& src, UInt tail)
+{
+    if (src.End - src.Start > tail) {
+        src.Start = src.End - tail;
+        src.Cut = true;
+    }
+
+    // the byte right before the window tells whether it starts on a line of its own
+    if (!src.Cut || src.Buffer[src.Start - 1] == '\n') {
+        return;
+    }
+
+    char* data = src.Buffer.data();
+    const auto* newline = static_cast<const char*>(std::memchr(data + src.Start, '\n', src.End - src.Start));
+    if (newline != nullptr && newline + 1 < data + src.End) {
+        src.Start = newline + 1 - data;
+    }
+}
+
+/// Reads whatever `src` has available into its buffer, once.
+auto fill(source& src, const LineOptions& options) -> violet::io::Result<void>
+{
+    char* data = src.Buffer.data();
+    if (options.Tail.HasValue()) {
+        // keep one byte more than the window, which `settleTail` looks at
+        UInt keep = *options.Tail + 1;
+        if (src.End == src.Buffer.size()) {
+            std::memmove(data, data + src.End - keep, keep);
+            src.End = keep;
+            src.Cut = true;
+        }
+    } else {
+        // everything before `Start` was yielded already and isn't borrowed anymore
+        if (src.Start > 0) {
+            std::memmove(data, data + src.Start, src.End - src.Start);
+            src.End -= src.Start;
+            src.Start = 0;
+        }
+
+        if (src.End == src.Buffer.size()) {
+            src.Buffer.resize(std::min(src.Buffer.size() * 2, options.MaxLineLength));
+            data = src.Buffer.data();
+        }
+    }
+
+    Int64 read = -1;
+    do {
+        read = ::read(src.Descriptor.Get(), data + src.End, src.Buffer.size() - src.End);
+    } while (read < 0 && errno == EINTR);
+
+    if (read <= 0) {
+        Int32 error = errno;
+
+        src.Closed = true;
+        if (options.Tail.HasValue()) {
+            settleTail(src, *options.Tail);
+        }
+
+        if (read < 0) {
+            return Err(violet::io::Error::FromOSError(error));
+        }
+
+        return { };
+    }
+
+    src.End += static_cast<UInt>(read);
+    return { };
+}
+
+} // namespace
+
+struct ChildLines::Impl final {
+    Vec<source> Sources;
+    LineOptions Options;
+    UInt Turn = 0; ///< the source to look at first, so that both get their turn
+
+    auto Next() -> Optional<ChildLines::Item>
+    {
+        while (true) {
+            UInt count = this->Sources.size();
+            for (UInt i = 0; i < count; i++) {
+                auto& src = this->Sources[(this->Turn + i) % count];
+                if (auto line = nextLine(src, this->Options)) {
+                    this->Turn = (this->Turn + i + 1) % count;
+                    return Item(ChildLine{ .Stream = src.Stream, .Data = *line });
+                }
+            }
+
+            Array<struct pollfd, 2> fds{ };
+            Array<source*, 2> polled{ };
+            UInt open = 0;
+
+            for (auto& src: this->Sources) {
+                if (!src.Closed) {
+                    fds[open] = { .fd = src.Descriptor.Get(), .events = POLLIN, .revents = 0 };
+                    polled[open++] = &src;
+                }
+            }
+
+            if (open == 0) {
+                return Nothing;
+            }
+
+            // a single stream can just block in `read(2)`
+            if (open == 1) {
+                if (auto res = fill(*polled[0], this->Options); res.Err()) {
+                    return Err(VIOLET_MOVE(res.Error()));
+                }
+
+                continue;
+            }
+
+            Int32 ready = -1;
+            do {
+                ready = ::poll(fds.data(), open, /*timeout=*/-1);
+            } while (ready < 0 && errno == EINTR);
+
+            if (ready < 0) {
+                return Err(violet::io::Error::OSError());
+            }
+
+            for (UInt i = 0; i < open; i++) {
+                if ((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0) {
+                    continue;
+                }
+
+                if (auto res = fill(*polled[i], this->Options); res.Err()) {
+                    return Err(VIOLET_MOVE(res.Error()));
+                }
+            }
+        }
+    }
+};
+
+ChildLines::ChildLines(io::FileDescriptor stdoutFd, io::FileDescriptor stderrFd, LineOptions options)
+    : n_impl(new Impl)
+{
+    options.MaxLineLength = std::max<UInt>(options.MaxLineLength, 1);
+
+    UInt size = options.Tail.HasValue() ? std::max(2 * (*options.Tail + 1), kReadSize)
+                                        : std::min(kReadSize, options.MaxLineLength);
+
+    for (auto [fd, stream]: { std::pair{ &stdoutFd, ChildStream::Stdout }, std::pair{ &stderrFd, ChildStream::Stderr } }) {
+        if (fd->Valid()) {
+            auto& src = this->n_impl->Sources.emplace_back();
+            src.Descriptor = VIOLET_MOVE(*fd);
+            src.Stream = stream;
+            src.Buffer.resize(size);
+        }
+    }
+
+    this->n_impl->Options = VIOLET_MOVE(options);
+}
+
+ChildLines::ChildLines(ChildLines&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+auto ChildLines::operator=(ChildLines&& other) noexcept -> ChildLines&
+{
+    if (this != &other) {
+        delete this->n_impl;
+        this->n_impl = std::exchange(other.n_impl, nullptr);
+    }
+
+    return *this;
+}
+
+ChildLines::~ChildLines()
+{
+    if (this->n_impl != nullptr) {
+        delete this->n_impl;
+        this->n_impl = nullptr;
+    }
+}
+
+auto ChildLines::Next() noexcept -> Optional<Item>
+{
+    VIOLET_ASSERT0(this->n_impl != nullptr);
+    return this->n_impl->Next();
+}
+
+auto Child::StdoutLines(LineOptions options) -> ChildLines
+{
+    io::FileDescriptor fd;
+    if (this->Stdout.HasValue()) {
+        fd = VIOLET_MOVE(this->Stdout->Descriptor);
+        this->Stdout = Nothing;
+    }
+
+    return ChildLines(VIOLET_MOVE(fd), { }, VIOLET_MOVE(options));
+}
+
+auto Child::StderrLines(LineOptions options) -> ChildLines
+{
+    io::FileDescriptor fd;
+    if (this->Stderr.HasValue()) {
+        fd = VIOLET_MOVE(this->Stderr->Descriptor);
+        this->Stderr = Nothing;
+    }
+
+    return ChildLines({ }, VIOLET_MOVE(fd), VIOLET_MOVE(options));
+}
+
+auto Child::Lines(LineOptions options) -> ChildLines
+{
+    io::FileDescriptor stdoutFd;
+    io::FileDescriptor stderrFd;
+
+    if (this->Stdout.HasValue()) {
+        stdoutFd = VIOLET_MOVE(this->Stdout->Descriptor);
+        this->Stdout = Nothing;
+    }
+
+    if (this->Stderr.HasValue()) {
+        stderrFd = VIOLET_MOVE(this->Stderr->Descriptor);
+        this->Stderr = Nothing;
+    }
+
+    return ChildLines(VIOLET_MOVE(stdoutFd), VIOLET_MOVE(stderrFd), VIOLET_MOVE(options));
+}
+
+#endif
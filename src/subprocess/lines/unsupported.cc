@@ -0,0 +1,107 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Subprocess.h>
+
+using violet::subprocess::Child;
+using violet::subprocess::ChildLines;
+using violet::subprocess::LineOptions;
+
+struct ChildLines::Impl final {
+    io::FileDescriptor Stdout;
+    io::FileDescriptor Stderr;
+    bool Reported = false;
+};
+
+ChildLines::ChildLines(io::FileDescriptor stdoutFd, io::FileDescriptor stderrFd, LineOptions)
+    : n_impl(new Impl{ .Stdout = VIOLET_MOVE(stdoutFd), .Stderr = VIOLET_MOVE(stderrFd) })
+{
+}
+
+ChildLines::ChildLines(ChildLines&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+auto ChildLines::operator=(ChildLines&& other) noexcept -> ChildLines&
+{
+    if (this != &other) {
+        delete this->n_impl;
+        this->n_impl = std::exchange(other.n_impl, nullptr);
+    }
+
+    return *this;
+}
+
+ChildLines::~ChildLines()
+{
+    delete this->n_impl;
+}
+
+auto ChildLines::Next() noexcept -> Optional<Item>
+{
+    if (this->n_impl == nullptr || std::exchange(this->n_impl->Reported, true)) {
+        return Nothing;
+    }
+
+    return Err(VIOLET_IO_ERROR(
+        Unsupported, String, "unsupported on platform: `violet::subprocess::ChildLines::Next()`"));
+}
+
+auto Child::StdoutLines(LineOptions options) -> ChildLines
+{
+    io::FileDescriptor fd;
+    if (this->Stdout.HasValue()) {
+        fd = VIOLET_MOVE(this->Stdout->Descriptor);
+        this->Stdout = Nothing;
+    }
+
+    return ChildLines(VIOLET_MOVE(fd), { }, VIOLET_MOVE(options));
+}
+
+auto Child::StderrLines(LineOptions options) -> ChildLines
+{
+    io::FileDescriptor fd;
+    if (this->Stderr.HasValue()) {
+        fd = VIOLET_MOVE(this->Stderr->Descriptor);
+        this->Stderr = Nothing;
+    }
+
+    return ChildLines({ }, VIOLET_MOVE(fd), VIOLET_MOVE(options));
+}
+
+auto Child::Lines(LineOptions options) -> ChildLines
+{
+    io::FileDescriptor stdoutFd;
+    io::FileDescriptor stderrFd;
+
+    if (this->Stdout.HasValue()) {
+        stdoutFd = VIOLET_MOVE(this->Stdout->Descriptor);
+        this->Stdout = Nothing;
+    }
+
+    if (this->Stderr.HasValue()) {
+        stderrFd = VIOLET_MOVE(this->Stderr->Descriptor);
+        this->Stderr = Nothing;
+    }
+
+    return ChildLines(VIOLET_MOVE(stdoutFd), VIOLET_MOVE(stderrFd), VIOLET_MOVE(options));
+}
@@ -126,7 +126,7 @@ auto Child::Wait() const -> io::Result<ExitStatus>
 
 auto Command::Spawn() -> io::Result<Child>
 {
-    return detail::SpawnAsForkExec(*this);
+    return detail::SpawnWithClone(*this);
 }
 
 #endif
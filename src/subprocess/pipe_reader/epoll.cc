@@ -25,8 +25,10 @@
 
 #include <violet/Subprocess/PipeReader.h>
 
+#include <algorithm>
 #include <fcntl.h>
 #include <sys/epoll.h>
+#include <sys/ioctl.h>
 #include <unistd.h>
 
 using violet::Array;
@@ -34,6 +36,8 @@ using violet::Err;
 using violet::Int32;
 using violet::Int64;
 using violet::String;
+using violet::UInt;
+using violet::UInt64;
 using violet::UInt8;
 using violet::Vec;
 using violet::io::Error;
@@ -41,36 +45,99 @@ using violet::subprocess::PipeReader;
 
 using Fd = violet::io::FileDescriptor::value_type;
 
+constexpr UInt kMinimumReadSize = 4096;
+constexpr UInt kDefaultPipeCapacity = 65536;
+
 namespace {
 
-struct EpollPipeReader final: public PipeReader {
-    VIOLET_IMPLICIT EpollPipeReader() noexcept = default;
-    ~EpollPipeReader() override
+/// A registered pipe and the buffer its bytes are appended to.
+struct entry final {
+    Fd FD;
+    Vec<UInt8>* Sink;
+    UInt Capacity;
+    bool Done;
+};
+
+/// Owns the calling thread's `epoll` instance, which every reader drained on this thread shares.
+struct instance final {
+    Fd FD = -1;
+
+    ~instance()
     {
-        if (this->n_epollFD >= 0) {
-            ::close(this->n_epollFD);
-            this->n_epollFD = -1;
+        if (this->FD >= 0) {
+            ::close(this->FD);
         }
     }
+};
 
-    VIOLET_IMPLICIT_COPY_AND_MOVE(EpollPipeReader);
-
-    auto Register(Fd fd) -> violet::io::Result<void> override
-    {
-        this->n_pipeFD = fd;
-        this->n_epollFD = ::epoll_create1(EPOLL_CLOEXEC);
-        if (this->n_epollFD < 0) {
+auto threadEpoll() -> violet::io::Result<Fd>
+{
+    thread_local instance epoll;
+    if (epoll.FD < 0) {
+        epoll.FD = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epoll.FD < 0) {
             return Err(Error::OSError());
         }
+    }
+
+    return epoll.FD;
+}
 
-        struct epoll_event event{ };
-        event.events = EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP;
-        event.data.fd = fd;
+/// Returns how many bytes the next `read(2)` on `p` should ask for: whatever is
+/// already queued in the pipe, or its capacity if the kernel won't tell us.
+auto readSize(const entry& p) noexcept -> UInt
+{
+    Int32 queued = 0;
+    if (::ioctl(p.FD, FIONREAD, &queued) != 0) {
+        return p.Capacity;
+    }
 
-        if (::epoll_ctl(this->n_epollFD, EPOLL_CTL_ADD, fd, &event) < 0) {
-            return Err(Error::OSError());
+    return std::max(static_cast<UInt>(queued), kMinimumReadSize);
+}
+
+/// Performs a single read on `p` straight into its sink. Returns `true` once the
+/// write end has been closed.
+auto readOnce(entry& p) -> violet::io::Result<bool>
+{
+    auto& sink = *p.Sink;
+    while (true) {
+        UInt size = readSize(p);
+        UInt old = sink.size();
+
+        sink.resize(old + size);
+        Int64 num = ::read(p.FD, sink.data() + old, size);
+        if (num >= 0) {
+            sink.resize(old + static_cast<UInt>(num));
+            return num == 0;
+        }
+
+        sink.resize(old);
+        if (errno == EINTR) {
+            continue;
+        }
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return false;
         }
 
+        return Err(Error::OSError());
+    }
+}
+
+struct EpollPipeReader final: public PipeReader {
+    VIOLET_IMPLICIT EpollPipeReader() noexcept = default;
+    ~EpollPipeReader() override = default;
+
+    // `Register(fd)` points an entry at `n_captured`, so the reader can't be relocated.
+    VIOLET_DISALLOW_COPY_AND_MOVE(EpollPipeReader);
+
+    auto Register(Fd fd) -> violet::io::Result<void> override
+    {
+        return this->Register(fd, this->n_captured);
+    }
+
+    auto Register(Fd fd, Vec<UInt8>& sink) -> violet::io::Result<void> override
+    {
         int flags = ::fcntl(fd, F_GETFL, 0);
         if (flags < 0) {
             return Err(Error::OSError());
@@ -80,70 +147,105 @@ struct EpollPipeReader final: public PipeReader {
             return Err(Error::OSError());
         }
 
+        Int32 capacity = ::fcntl(fd, F_GETPIPE_SZ);
+        this->n_pipes.push_back({
+            .FD = fd,
+            .Sink = &sink,
+            .Capacity = capacity > 0 ? static_cast<UInt>(capacity) : kDefaultPipeCapacity,
+            .Done = false,
+        });
+
         return { };
     }
 
+    auto Drain() -> violet::io::Result<void> override
+    {
+        return this->drain();
+    }
+
     [[nodiscard]] auto CaptureAll() const -> violet::io::Result<Vec<UInt8>> override
     {
-        Vec<UInt8> output;
-        if (this->n_pipeFD < 0 || this->n_epollFD < 0) {
+        if (this->n_pipes.empty()) {
             return Err(VIOLET_IO_ERROR(InvalidData, String,
                 "reader was not successfully initialized. did you forget to call `PipeReader::Register`?"));
         }
 
-        Array<UInt8, 4096> chunk;
-        while (true) {
+        VIOLET_TRY_VOID(this->drain());
+        return VIOLET_MOVE(this->n_captured);
+    }
+
+private:
+    mutable Vec<entry> n_pipes;
+    mutable Vec<UInt8> n_captured;
+
+    auto drain() const -> violet::io::Result<void>
+    {
+        Fd epfd = VIOLET_TRY(threadEpoll());
+
+        // The pipes are only attached to this thread's instance while we're draining them,
+        // so readers never see each other's events.
+        UInt open = 0;
+        for (UInt i = 0; i < this->n_pipes.size(); i++) {
+            auto& p = this->n_pipes[i];
+            if (p.Done) {
+                continue;
+            }
+
             struct epoll_event event{ };
-            Int32 bytes = ::epoll_wait(this->n_epollFD, &event, 1, /*__timeout=*/-1);
-            if (bytes < 0) {
+            event.events = EPOLLIN | EPOLLRDHUP;
+            event.data.u64 = i;
+
+            if (::epoll_ctl(epfd, EPOLL_CTL_ADD, p.FD, &event) < 0) {
+                auto error = Error::OSError();
+                this->detach(epfd);
+
+                return Err(error);
+            }
+
+            open++;
+        }
+
+        Array<struct epoll_event, 8> events;
+        while (open > 0) {
+            Int32 ready = ::epoll_wait(epfd, events.data(), static_cast<Int32>(events.size()), /*__timeout=*/-1);
+            if (ready < 0) {
                 if (errno == EINTR) {
                     continue;
                 }
 
-                return Err(Error::OSError());
-            }
+                auto error = Error::OSError();
+                this->detach(epfd);
 
-            // Drain all available data whenever `EPOLLIN` fires
-            if ((event.events & EPOLLIN) != 0) {
-                while (true) {
-                    Int64 readBytes = ::read(this->n_pipeFD, chunk.data(), chunk.size());
-                    if (readBytes > 0) {
-                        output.insert(output.end(), chunk.begin(), chunk.begin() + readBytes);
-                    } else if (readBytes == 0) {
-                        return output;
-                    } else {
-                        if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                            break;
-                        }
-
-                        if (errno == EINTR) {
-                            continue;
-                        }
-
-                        return Err(Error::OSError());
-                    }
-                }
+                return Err(error);
             }
 
-            // Peer was closed -- drain then exit
-            if ((event.events & (EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0) {
-                while (true) {
-                    Int64 readBytes = ::read(this->n_pipeFD, chunk.data(), chunk.size());
-                    if (readBytes <= 0) {
-                        break;
-                    }
-
-                    output.insert(output.end(), chunk.begin(), chunk.begin() + readBytes);
+            for (Int32 i = 0; i < ready; i++) {
+                auto& p = this->n_pipes[static_cast<UInt>(events[static_cast<UInt>(i)].data.u64)];
+                auto closed = readOnce(p);
+                if (closed.Err()) {
+                    this->detach(epfd);
+                    return Err(VIOLET_MOVE(closed.Error()));
                 }
 
-                return output;
+                if (closed.Value()) {
+                    ::epoll_ctl(epfd, EPOLL_CTL_DEL, p.FD, nullptr);
+                    p.Done = true;
+                    open--;
+                }
             }
         }
+
+        return { };
     }
 
-private:
-    Fd n_pipeFD = -1;
-    Fd n_epollFD = -1;
+    void detach(Fd epfd) const noexcept
+    {
+        for (const auto& p: this->n_pipes) {
+            if (!p.Done) {
+                ::epoll_ctl(epfd, EPOLL_CTL_DEL, p.FD, nullptr);
+            }
+        }
+    }
 };
 
 } // namespace
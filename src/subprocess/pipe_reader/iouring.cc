@@ -26,12 +26,16 @@
 #include <liburing.h>
 #include <violet/Subprocess/PipeReader.h>
 
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/ioctl.h>
 #include <unistd.h>
 
 using violet::Err;
 using violet::Int32;
 using violet::String;
 using violet::UInt;
+using violet::UInt64;
 using violet::UInt8;
 using violet::Vec;
 using violet::io::Error;
@@ -40,91 +44,208 @@ using violet::subprocess::PipeReader;
 using Fd = violet::io::FileDescriptor::value_type;
 
 constexpr unsigned kRingDepth = 8;
-constexpr UInt kBufferSize = 65535; // 64KiB per read
+constexpr UInt kMinimumReadSize = 4096;
+constexpr UInt kDefaultPipeCapacity = 65536;
 
 namespace {
 
-struct IoUringPipeReader final: public PipeReader {
-    VIOLET_IMPLICIT IoUringPipeReader() noexcept
+/// A registered pipe and the buffer its bytes are appended to.
+struct entry final {
+    Fd FD;
+    Vec<UInt8>* Sink;
+    UInt Capacity;
+    UInt Offset; ///< where the in-flight read landed in `Sink`
+    bool Done;
+};
+
+/// Owns the calling thread's ring, which every reader drained on this thread shares.
+struct instance final {
+    struct io_uring Ring{ };
+    bool Ok = false;
+
+    ~instance()
     {
-        this->n_buf.reserve(kBufferSize);
+        this->Reset();
     }
 
-    ~IoUringPipeReader() override
+    void Reset() noexcept
     {
-        if (this->n_ringOk) {
-            ::io_uring_queue_exit(&this->n_ring);
+        if (this->Ok) {
+            ::io_uring_queue_exit(&this->Ring);
+            this->Ok = false;
         }
     }
+};
+
+thread_local instance t_ring;
+
+auto threadRing() -> violet::io::Result<struct io_uring*>
+{
+    if (!t_ring.Ok) {
+        if (Int32 ret = ::io_uring_queue_init(kRingDepth, &t_ring.Ring, /*flags=*/0); ret < 0) {
+            return Err(Error::FromOSError(-ret));
+        }
+
+        t_ring.Ok = true;
+    }
+
+    return &t_ring.Ring;
+}
+
+/// Returns how many bytes the next read on `p` should ask for: whatever is already
+/// queued in the pipe, or its capacity if the kernel won't tell us.
+auto readSize(const entry& p) noexcept -> UInt
+{
+    Int32 queued = 0;
+    if (::ioctl(p.FD, FIONREAD, &queued) != 0) {
+        return p.Capacity;
+    }
 
-    VIOLET_IMPLICIT_COPY_AND_MOVE(IoUringPipeReader);
+    return std::max(static_cast<UInt>(queued), kMinimumReadSize);
+}
+
+struct IoUringPipeReader final: public PipeReader {
+    VIOLET_IMPLICIT IoUringPipeReader() noexcept = default;
+    ~IoUringPipeReader() override = default;
+
+    // `Register(fd)` points an entry at `n_captured`, so the reader can't be relocated.
+    VIOLET_DISALLOW_COPY_AND_MOVE(IoUringPipeReader);
 
     auto Register(Fd fd) -> violet::io::Result<void> override
     {
-        this->n_pipeFD = fd;
-
-        Int32 ret = ::io_uring_queue_init(kRingDepth, &this->n_ring, /*flags=*/0);
-        if (ret < 0) {
-            return Err(Error::FromOSError(-ret));
+        // Reads are in flight on every pipe at once, so two pipes can't share `n_captured`.
+        if (this->n_legacy) {
+            return Err(VIOLET_IO_ERROR(InvalidInput, String,
+                "`PipeReader::Register(fd)` was already called; use `PipeReader::Register(fd, sink)` to drain "
+                "several pipes"));
         }
 
-        this->n_ringOk = true;
+        VIOLET_TRY_VOID(this->Register(fd, this->n_captured));
+        this->n_legacy = true;
+
         return { };
     }
 
-    [[nodiscard]] auto CaptureAll() const noexcept -> violet::io::Result<Vec<UInt8>> override
+    auto Register(Fd fd, Vec<UInt8>& sink) -> violet::io::Result<void> override
     {
-        if (this->n_pipeFD < 0 || !this->n_ringOk) {
+        Int32 capacity = ::fcntl(fd, F_GETPIPE_SZ);
+        this->n_pipes.push_back({
+            .FD = fd,
+            .Sink = &sink,
+            .Capacity = capacity > 0 ? static_cast<UInt>(capacity) : kDefaultPipeCapacity,
+            .Offset = 0,
+            .Done = false,
+        });
+
+        return { };
+    }
+
+    auto Drain() -> violet::io::Result<void> override
+    {
+        return this->drain();
+    }
+
+    [[nodiscard]] auto CaptureAll() const -> violet::io::Result<Vec<UInt8>> override
+    {
+        if (this->n_pipes.empty()) {
             return Err(VIOLET_IO_ERROR(
                 InvalidData, String, "iouring is not setup, did you forget to call `PipeReader::Register`?"));
         }
 
-        Vec<UInt8> out;
-        while (true) {
-            struct io_uring_sqe* sqe = ::io_uring_get_sqe(&this->n_ring);
-            ::io_uring_prep_read(
-                sqe, this->n_pipeFD, this->n_buf.data(), kBufferSize, /*offset=*/static_cast<violet::UInt64>(-1));
+        VIOLET_TRY_VOID(this->drain());
+        return VIOLET_MOVE(this->n_captured);
+    }
 
-            ::io_uring_sqe_set_flags(sqe, 0);
-            if (Int32 ret = ::io_uring_submit(&this->n_ring); ret < 0) {
-                return Err(Error::OSError());
-            }
+    auto WantsNonBlocking() const -> bool override
+    {
+        return false;
+    }
 
-            struct io_uring_cqe* cqe = nullptr;
-            if (Int32 ret = ::io_uring_wait_cqe(&this->n_ring, &cqe); ret < 0) {
-                return Err(Error::OSError());
+private:
+    mutable Vec<entry> n_pipes;
+    mutable Vec<UInt8> n_captured;
+    bool n_legacy = false;
+
+    auto drain() const -> violet::io::Result<void>
+    {
+        auto* ring = VIOLET_TRY(threadRing());
+
+        // Keeps exactly one read in flight per open pipe; each read lands directly at
+        // the end of that pipe's sink, which is only resized once its read completes.
+        UInt inflight = 0;
+        auto submit = [&](UInt index) -> void {
+            auto& p = this->n_pipes[index];
+            auto& sink = *p.Sink;
+            UInt size = readSize(p);
+
+            p.Offset = sink.size();
+            sink.resize(p.Offset + size);
+
+            struct io_uring_sqe* sqe = ::io_uring_get_sqe(ring);
+            if (sqe == nullptr) {
+                ::io_uring_submit(ring);
+                sqe = ::io_uring_get_sqe(ring);
             }
 
-            Int32 result = cqe->res;
-            ::io_uring_cqe_seen(&this->n_ring, cqe);
-            if (result == 0) {
-                break;
+            ::io_uring_prep_read(sqe, p.FD, sink.data() + p.Offset, static_cast<unsigned>(size),
+                /*offset=*/static_cast<UInt64>(-1));
+
+            ::io_uring_sqe_set_data64(sqe, index);
+            inflight++;
+        };
+
+        for (UInt i = 0; i < this->n_pipes.size(); i++) {
+            if (!this->n_pipes[i].Done) {
+                submit(i);
             }
+        }
 
-            if (result < 0) {
-                if (-result == EAGAIN || -result == EINTR) {
+        Int32 failure = 0;
+        while (inflight > 0) {
+            if (Int32 ret = ::io_uring_submit_and_wait(ring, 1); ret < 0) {
+                if (-ret == EINTR || -ret == EAGAIN || -ret == EBUSY) {
                     continue;
                 }
 
-                return Err(Error::FromOSError(-result));
+                // Reads may still be pending against the sinks; tearing the ring down is
+                // the only way to make sure the kernel lets go of them.
+                t_ring.Reset();
+                return Err(Error::FromOSError(-ret));
             }
 
-            out.insert(out.end(), this->n_buf.data(), this->n_buf.data() + static_cast<UInt>(result));
+            struct io_uring_cqe* cqe = nullptr;
+            while (::io_uring_peek_cqe(ring, &cqe) == 0) {
+                auto index = static_cast<UInt>(::io_uring_cqe_get_data64(cqe));
+                Int32 result = cqe->res;
+
+                ::io_uring_cqe_seen(ring, cqe);
+                inflight--;
+
+                auto& p = this->n_pipes[index];
+                p.Sink->resize(p.Offset + static_cast<UInt>(std::max(result, 0)));
+
+                if (result == 0) {
+                    p.Done = true;
+                    continue;
+                }
+
+                if (result < 0 && -result != EAGAIN && -result != EINTR) {
+                    failure = failure != 0 ? failure : -result;
+                    continue;
+                }
+
+                if (failure == 0) {
+                    submit(index);
+                }
+            }
         }
 
-        return out;
-    }
+        if (failure != 0) {
+            return Err(Error::FromOSError(failure));
+        }
 
-    auto WantsNonBlocking() const -> bool override
-    {
-        return false;
+        return { };
     }
-
-private:
-    mutable struct io_uring n_ring{ };
-    mutable bool n_ringOk = false;
-    mutable Vec<UInt8> n_buf;
-    Fd n_pipeFD = -1;
 };
 
 } // namespace
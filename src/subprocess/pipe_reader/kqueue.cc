@@ -25,6 +25,7 @@
 
 #include <violet/Subprocess/PipeReader.h>
 
+#include <algorithm>
 #include <fcntl.h>
 #include <sys/event.h>
 #include <unistd.h>
@@ -33,6 +34,8 @@ using violet::Array;
 using violet::Err;
 using violet::Int32;
 using violet::Int64;
+using violet::UInt;
+using violet::UInt16;
 using violet::UInt8;
 using violet::Vec;
 using violet::io::Error;
@@ -40,34 +43,94 @@ using violet::subprocess::PipeReader;
 
 using Fd = violet::io::FileDescriptor::value_type;
 
+constexpr UInt kMinimumReadSize = 4096;
+
 namespace {
 
-struct KqueuePipeReader final: public PipeReader {
-    VIOLET_IMPLICIT_COPY_AND_MOVE(KqueuePipeReader);
+/// A registered pipe and the buffer its bytes are appended to.
+struct entry final {
+    Fd FD;
+    Vec<UInt8>* Sink;
+    bool Done;
+};
 
-    VIOLET_IMPLICIT KqueuePipeReader() = default;
-    ~KqueuePipeReader() override
+/// Owns the calling thread's `kqueue`, which every reader drained on this thread shares.
+struct instance final {
+    Fd FD = -1;
+
+    ~instance()
     {
-        if (this->n_kqueueFD >= 0) {
-            ::close(this->n_kqueueFD);
-            this->n_kqueueFD = -1;
+        if (this->FD >= 0) {
+            ::close(this->FD);
         }
     }
+};
 
-    auto Register(Fd fd) noexcept -> violet::io::Result<void> override
-    {
-        this->n_pipeFD = fd;
-        this->n_kqueueFD = ::kqueue();
-        if (this->n_kqueueFD < 0) {
+auto threadKqueue() -> violet::io::Result<Fd>
+{
+    thread_local instance kq;
+    if (kq.FD < 0) {
+        kq.FD = ::kqueue();
+        if (kq.FD < 0) {
             return Err(Error::OSError());
         }
 
-        struct kevent event{ };
-        EV_SET(&event, fd, EVFILT_READ, EV_ADD | EV_CLEAR, 0, 0, nullptr);
-        if (::kevent(this->n_kqueueFD, &event, 1, nullptr, 0, nullptr) < 0) {
-            return Err(Error::OSError());
+        ::fcntl(kq.FD, F_SETFD, FD_CLOEXEC);
+    }
+
+    return kq.FD;
+}
+
+void change(Fd kq, Fd fd, UInt index, UInt16 flags) noexcept
+{
+    struct kevent event{ };
+    EV_SET(&event, fd, EVFILT_READ, flags, 0, 0, reinterpret_cast<void*>(index));
+    ::kevent(kq, &event, 1, nullptr, 0, nullptr);
+}
+
+/// Performs a single read on `p` straight into its sink, sized from the byte count
+/// `kevent` reported. Returns `true` once the write end has been closed.
+auto readOnce(entry& p, UInt queued) -> violet::io::Result<bool>
+{
+    auto& sink = *p.Sink;
+    while (true) {
+        UInt size = std::max(queued, kMinimumReadSize);
+        UInt old = sink.size();
+
+        sink.resize(old + size);
+        Int64 num = ::read(p.FD, sink.data() + old, size);
+        if (num >= 0) {
+            sink.resize(old + static_cast<UInt>(num));
+            return num == 0;
+        }
+
+        sink.resize(old);
+        if (errno == EINTR) {
+            continue;
         }
 
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return false;
+        }
+
+        return Err(Error::OSError());
+    }
+}
+
+struct KqueuePipeReader final: public PipeReader {
+    VIOLET_IMPLICIT KqueuePipeReader() = default;
+    ~KqueuePipeReader() override = default;
+
+    // `Register(fd)` points an entry at `n_captured`, so the reader can't be relocated.
+    VIOLET_DISALLOW_COPY_AND_MOVE(KqueuePipeReader);
+
+    auto Register(Fd fd) noexcept -> violet::io::Result<void> override
+    {
+        return this->Register(fd, this->n_captured);
+    }
+
+    auto Register(Fd fd, Vec<UInt8>& sink) -> violet::io::Result<void> override
+    {
         int flags = ::fcntl(fd, F_GETFL, 0);
         if (flags < 0) {
             return Err(Error::OSError());
@@ -77,70 +140,93 @@ struct KqueuePipeReader final: public PipeReader {
             return Err(Error::OSError());
         }
 
+        this->n_pipes.push_back({ .FD = fd, .Sink = &sink, .Done = false });
         return { };
     }
 
+    auto Drain() -> violet::io::Result<void> override
+    {
+        return this->drain();
+    }
+
     [[nodiscard]] auto CaptureAll() const -> violet::io::Result<Vec<UInt8>> override
     {
-        Vec<UInt8> output;
-        if (this->n_pipeFD < 0 || this->n_kqueueFD < 0) {
-            return output;
+        if (this->n_pipes.empty()) {
+            return Vec<UInt8>{ };
         }
 
-        Array<UInt8, 4096> chunk;
-        while (true) {
-            struct kevent event{ };
-            Int32 nev = ::kevent(this->n_kqueueFD, nullptr, 0, &event, 1, nullptr);
+        VIOLET_TRY_VOID(this->drain());
+        return VIOLET_MOVE(this->n_captured);
+    }
+
+    auto WantsNonBlocking() const -> bool override
+    {
+        return false;
+    }
+
+private:
+    mutable Vec<entry> n_pipes;
+    mutable Vec<UInt8> n_captured;
+
+    auto drain() const -> violet::io::Result<void>
+    {
+        Fd kq = VIOLET_TRY(threadKqueue());
+
+        // The pipes are only attached to this thread's queue while we're draining them,
+        // so readers never see each other's events.
+        UInt open = 0;
+        for (UInt i = 0; i < this->n_pipes.size(); i++) {
+            if (!this->n_pipes[i].Done) {
+                change(kq, this->n_pipes[i].FD, i, EV_ADD);
+                open++;
+            }
+        }
+
+        Array<struct kevent, 8> events;
+        while (open > 0) {
+            Int32 nev = ::kevent(kq, nullptr, 0, events.data(), static_cast<Int32>(events.size()), nullptr);
             if (nev < 0) {
                 if (errno == EINTR) {
                     continue;
                 }
 
-                return Err(Error::OSError());
-            }
+                auto error = Error::OSError();
+                this->detach(kq);
 
-            if (nev == 0) {
-                continue;
+                return Err(error);
             }
 
-            // EV_EOF indicates the write end was closed
-            bool peerClosed = (event.flags & EV_EOF) != 0;
-
-            // Drain all available data
-            while (true) {
-                Int64 readBytes = ::read(this->n_pipeFD, chunk.data(), chunk.size());
-                if (readBytes > 0) {
-                    output.insert(output.end(), chunk.begin(), chunk.begin() + readBytes);
-                } else if (readBytes == 0) {
-                    return output;
-                } else {
-                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                        break;
-                    }
-
-                    if (errno == EINTR) {
-                        continue;
-                    }
-
-                    return Err(Error::OSError());
+            for (Int32 i = 0; i < nev; i++) {
+                const auto& event = events[static_cast<UInt>(i)];
+                auto index = reinterpret_cast<UInt>(event.udata);
+                auto& p = this->n_pipes[index];
+
+                // For pipes, `data` holds the number of bytes ready to be read.
+                auto closed = readOnce(p, static_cast<UInt>(std::max<Int64>(event.data, 0)));
+                if (closed.Err()) {
+                    this->detach(kq);
+                    return Err(VIOLET_MOVE(closed.Error()));
                 }
-            }
 
-            // After draining, if the peer closed, we're done
-            if (peerClosed) {
-                return output;
+                if (closed.Value()) {
+                    change(kq, p.FD, index, EV_DELETE);
+                    p.Done = true;
+                    open--;
+                }
             }
         }
+
+        return { };
     }
 
-    auto WantsNonBlocking() const -> bool override
+    void detach(Fd kq) const noexcept
     {
-        return false;
+        for (UInt i = 0; i < this->n_pipes.size(); i++) {
+            if (!this->n_pipes[i].Done) {
+                change(kq, this->n_pipes[i].FD, i, EV_DELETE);
+            }
+        }
     }
-
-private:
-    Fd n_pipeFD = -1;
-    Fd n_kqueueFD = -1;
 };
 
 } // namespace
@@ -0,0 +1,165 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Violet.h>
+
+#if VIOLET_PLATFORM(LINUX)
+
+#include <violet/Subprocess/PreparedCommand.h>
+#include <violet/Subprocess/__detail/Impl.unix.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using violet::Err;
+using violet::Int32;
+using violet::Str;
+using violet::UInt;
+using violet::io::Error;
+using violet::subprocess::Child;
+using violet::subprocess::Command;
+using violet::subprocess::ExitStatus;
+using violet::subprocess::PreparedCommand;
+using violet::subprocess::detail::SpawnPlan;
+
+struct PreparedCommand::Impl final {
+    VIOLET_IMPLICIT Impl(const Command& command, SpawnPlan plan)
+        : Source(command)
+        , Plan(VIOLET_MOVE(plan))
+    {
+    }
+
+    Command Source;
+    SpawnPlan Plan;
+};
+
+PreparedCommand::PreparedCommand(Impl* impl) noexcept
+    : n_impl(impl)
+{
+}
+
+PreparedCommand::PreparedCommand(PreparedCommand&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+auto PreparedCommand::operator=(PreparedCommand&& other) noexcept -> PreparedCommand&
+{
+    if (this != &other) {
+        delete this->n_impl;
+        this->n_impl = std::exchange(other.n_impl, nullptr);
+    }
+
+    return *this;
+}
+
+PreparedCommand::~PreparedCommand()
+{
+    if (this->n_impl != nullptr) {
+        delete this->n_impl;
+        this->n_impl = nullptr;
+    }
+}
+
+auto PreparedCommand::New(const Command& command) -> io::Result<PreparedCommand>
+{
+    const auto& impl = *command.n_impl;
+    auto plan = VIOLET_TRY(impl.Prepare());
+
+    // A forked child would inherit neither of these, so only keep them around for clones.
+    if (!impl.n_exec.HasValue()) {
+        // a relative program is relative to where the child is going to be
+        Int32 program = plan.Executable.starts_with('/') || !plan.WorkingDirectory.HasValue()
+            ? ::open(plan.Executable.c_str(), O_PATH | O_CLOEXEC)
+            : ::open(std::format("{}/{}", *plan.WorkingDirectory, plan.Executable).c_str(), O_PATH | O_CLOEXEC);
+        if (program < 0) {
+            return Err(Error::OSError());
+        }
+
+        plan.Program = io::FileDescriptor(program);
+
+        if (impl.n_stdin.IsNull() || impl.n_stdout.IsNull() || impl.n_stderr.IsNull()) {
+            Int32 null = ::open("/dev/null", O_RDWR | O_CLOEXEC);
+            if (null < 0) {
+                return Err(Error::OSError());
+            }
+
+            plan.Null = io::FileDescriptor(null);
+        }
+    }
+
+    return PreparedCommand(new Impl(command, VIOLET_MOVE(plan)));
+}
+
+auto PreparedCommand::WithArg(UInt index, Str value) -> PreparedCommand&
+{
+    auto& plan = this->n_impl->Plan;
+    VIOLET_ASSERT(index + 1 < plan.Arguments.size(), "argument index is out of bounds");
+
+    // `argv[0]` is the program, and assigning may have moved the argument's characters.
+    auto& arg = plan.Arguments[index + 1];
+    arg.assign(value);
+    plan.Argv[index + 1] = arg.c_str();
+
+    return *this;
+}
+
+auto PreparedCommand::Arg(UInt index) const -> Str
+{
+    const auto& plan = this->n_impl->Plan;
+    VIOLET_ASSERT(index + 1 < plan.Arguments.size(), "argument index is out of bounds");
+
+    return plan.Arguments[index + 1];
+}
+
+auto PreparedCommand::Args() const noexcept -> UInt
+{
+    return this->n_impl->Plan.Arguments.size() - 1;
+}
+
+auto PreparedCommand::Output() -> io::Result<struct Output>
+{
+    auto child = VIOLET_TRY(this->Spawn());
+    return detail::CollectOutput(child);
+}
+
+auto PreparedCommand::Status() -> io::Result<ExitStatus>
+{
+    auto child = VIOLET_TRY(this->Spawn());
+    return detail::CollectStatus(child);
+}
+
+auto PreparedCommand::Spawn() -> io::Result<Child>
+{
+    const auto& source = this->n_impl->Source;
+    const auto& plan = this->n_impl->Plan;
+
+    if (source.n_impl->n_exec.HasValue()) {
+        Command command = source;
+        command.n_impl->n_args.assign(plan.Arguments.begin() + 1, plan.Arguments.end());
+
+        return detail::SpawnAsForkExec(command);
+    }
+
+    return detail::SpawnPlanned(source, plan);
+}
+
+#endif
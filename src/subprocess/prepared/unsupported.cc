@@ -0,0 +1,79 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Subprocess/PreparedCommand.h>
+
+using violet::subprocess::Child;
+using violet::subprocess::Command;
+using violet::subprocess::ExitStatus;
+using violet::subprocess::PreparedCommand;
+
+struct PreparedCommand::Impl final {
+    Impl() = delete;
+};
+
+PreparedCommand::PreparedCommand(PreparedCommand&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+auto PreparedCommand::operator=(PreparedCommand&& other) noexcept -> PreparedCommand&
+{
+    this->n_impl = std::exchange(other.n_impl, nullptr);
+    return *this;
+}
+
+PreparedCommand::~PreparedCommand() = default;
+
+auto PreparedCommand::New(const Command&) -> io::Result<PreparedCommand>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto PreparedCommand::WithArg(UInt, Str) -> PreparedCommand&
+{
+    return *this;
+}
+
+auto PreparedCommand::Arg(UInt) const -> Str
+{
+    return { };
+}
+
+auto PreparedCommand::Args() const noexcept -> UInt
+{
+    return 0;
+}
+
+auto PreparedCommand::Output() -> io::Result<struct Output>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto PreparedCommand::Status() -> io::Result<ExitStatus>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto PreparedCommand::Spawn() -> io::Result<Child>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
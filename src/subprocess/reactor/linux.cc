@@ -0,0 +1,409 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Violet.h>
+
+#if VIOLET_PLATFORM(LINUX)
+
+#include <violet/Subprocess/Reactor.h>
+
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using violet::Array;
+using violet::Err;
+using violet::Int32;
+using violet::Int64;
+using violet::Optional;
+using violet::String;
+using violet::UInt;
+using violet::UInt64;
+using violet::UInt8;
+using violet::UniquePtr;
+using violet::Vec;
+using violet::io::Error;
+using violet::subprocess::Child;
+using violet::subprocess::ExitStatus;
+using violet::subprocess::Output;
+using violet::subprocess::PID;
+using violet::subprocess::Reactor;
+using violet::subprocess::ReactorCallback;
+
+using Fd = violet::io::FileDescriptor::value_type;
+
+constexpr UInt kMinimumReadSize = 4096;
+
+namespace {
+
+/// What a registered descriptor of a watched child is.
+enum struct source : UInt64 {
+    Exit = 0, ///< the child's pidfd
+    Stdout = 1,
+    Stderr = 2,
+};
+
+auto token(UInt slot, source src) noexcept -> UInt64
+{
+    return (static_cast<UInt64>(slot) << 2) | static_cast<UInt64>(src);
+}
+
+/// A child that is being watched by the reactor.
+struct watched final {
+    VIOLET_DISALLOW_COPY_AND_MOVE(watched);
+    ~watched()
+    {
+        if (this->PidFD >= 0) {
+            ::close(this->PidFD);
+        }
+    }
+
+    VIOLET_IMPLICIT watched(Child child, ReactorCallback done)
+        : Process(VIOLET_MOVE(child))
+        , Done(VIOLET_MOVE(done))
+    {
+    }
+
+    Child Process;
+    ReactorCallback Done;
+    Fd PidFD = -1;
+    Output Out;
+    UInt Open = 0; ///< how many of the child's descriptors are still registered
+    Optional<Error> Failure;
+};
+
+/// Performs a single read on `fd` straight into the end of `sink`, sized from the number of
+/// bytes that are queued in the pipe. Returns `true` once the write end has been closed.
+auto readOnce(Fd fd, Vec<UInt8>& sink) -> violet::io::Result<bool>
+{
+    while (true) {
+        Int32 queued = 0;
+        if (::ioctl(fd, FIONREAD, &queued) != 0) {
+            queued = 0;
+        }
+
+        UInt size = std::max(static_cast<UInt>(queued), kMinimumReadSize);
+        UInt old = sink.size();
+
+        sink.resize(old + size);
+        Int64 num = ::read(fd, sink.data() + old, size);
+        if (num >= 0) {
+            sink.resize(old + static_cast<UInt>(num));
+            return num == 0;
+        }
+
+        sink.resize(old);
+        if (errno == EINTR) {
+            continue;
+        }
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return false;
+        }
+
+        return Err(Error::OSError());
+    }
+}
+
+} // namespace
+
+struct Reactor::Impl final {
+    VIOLET_DISALLOW_COPY_AND_MOVE(Impl);
+
+    VIOLET_IMPLICIT Impl() = default;
+    ~Impl()
+    {
+        if (this->Epoll >= 0) {
+            ::close(this->Epoll);
+        }
+    }
+
+    Fd Epoll = -1;
+    Vec<UniquePtr<watched>> Slots; ///< watched children, indexed by the slot in their event tokens
+    Vec<UInt> Free; ///< slots that can be handed out again
+    UInt Pending = 0;
+
+    auto Add(UInt slot, Fd fd, source src) const -> violet::io::Result<void>
+    {
+        struct epoll_event event{ };
+        event.events = EPOLLIN;
+        event.data.u64 = token(slot, src);
+
+        if (::epoll_ctl(this->Epoll, EPOLL_CTL_ADD, fd, &event) < 0) {
+            return Err(Error::OSError());
+        }
+
+        return { };
+    }
+
+    void Remove(watched& child, Fd fd) const noexcept
+    {
+        ::epoll_ctl(this->Epoll, EPOLL_CTL_DEL, fd, nullptr);
+        child.Open--;
+    }
+
+    void Detach(watched& child) const noexcept
+    {
+        if (child.PidFD >= 0) {
+            ::epoll_ctl(this->Epoll, EPOLL_CTL_DEL, child.PidFD, nullptr);
+        }
+
+        if (child.Process.Stdout.HasValue()) {
+            ::epoll_ctl(this->Epoll, EPOLL_CTL_DEL, child.Process.Stdout->Descriptor.Get(), nullptr);
+        }
+
+        if (child.Process.Stderr.HasValue()) {
+            ::epoll_ctl(this->Epoll, EPOLL_CTL_DEL, child.Process.Stderr->Descriptor.Get(), nullptr);
+        }
+    }
+
+    /// Handles readiness of one of `child`'s descriptors.
+    void Dispatch(watched& child, source src) const
+    {
+        if (src == source::Exit) {
+            Int32 status = 0;
+            pid_t waited = -1;
+            do {
+                waited = ::waitpid(child.Process.PID.Get(), &status, WNOHANG);
+            } while (waited < 0 && errno == EINTR);
+
+            if (waited == 0) {
+                return;
+            }
+
+            if (waited < 0) {
+                child.Failure = Error::OSError();
+            } else {
+                child.Out.Status = ExitStatus(status);
+            }
+
+            this->Remove(child, child.PidFD);
+            ::close(child.PidFD);
+            child.PidFD = -1;
+
+            return;
+        }
+
+        auto& stream = src == source::Stdout ? child.Process.Stdout->Descriptor : child.Process.Stderr->Descriptor;
+        auto& sink = src == source::Stdout ? child.Out.Stdout : child.Out.Stderr;
+
+        auto closed = readOnce(stream.Get(), sink);
+        if (closed.Err()) {
+            if (!child.Failure.HasValue()) {
+                child.Failure = VIOLET_MOVE(closed.Error());
+            }
+
+            this->Remove(child, stream.Get());
+            return;
+        }
+
+        if (closed.Value()) {
+            this->Remove(child, stream.Get());
+        }
+    }
+};
+
+Reactor::Reactor(Impl* impl) noexcept
+    : n_impl(impl)
+{
+}
+
+Reactor::Reactor(Reactor&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+auto Reactor::operator=(Reactor&& other) noexcept -> Reactor&
+{
+    if (this != &other) {
+        delete this->n_impl;
+        this->n_impl = std::exchange(other.n_impl, nullptr);
+    }
+
+    return *this;
+}
+
+Reactor::~Reactor()
+{
+    if (this->n_impl != nullptr) {
+        delete this->n_impl;
+        this->n_impl = nullptr;
+    }
+}
+
+auto Reactor::New() -> io::Result<Reactor>
+{
+    auto impl = std::make_unique<Impl>();
+    impl->Epoll = ::epoll_create1(EPOLL_CLOEXEC);
+    if (impl->Epoll < 0) {
+        return Err(Error::OSError());
+    }
+
+    return Reactor(impl.release());
+}
+
+auto Reactor::Spawn(Command& command, ReactorCallback done) -> io::Result<PID>
+{
+    auto child = VIOLET_TRY(command.Spawn());
+    struct PID pid = child.PID;
+
+    VIOLET_TRY_VOID(this->Watch(VIOLET_MOVE(child), VIOLET_MOVE(done)));
+    return pid;
+}
+
+auto Reactor::Watch(Child child, ReactorCallback done) -> io::Result<void>
+{
+    VIOLET_ASSERT(this->n_impl != nullptr, "reactor was moved");
+    if (!child.PID) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "child is not running"));
+    }
+
+    auto entry = std::make_unique<watched>(VIOLET_MOVE(child), VIOLET_MOVE(done));
+    entry->PidFD = static_cast<Fd>(::syscall(SYS_pidfd_open, entry->Process.PID.Get(), 0));
+    if (entry->PidFD < 0) {
+        return Err(Error::OSError());
+    }
+
+    // Nobody is left to write into it, so let the child see end-of-file right away.
+    if (entry->Process.Stdin.HasValue()) {
+        entry->Process.Stdin->Descriptor.Close();
+        entry->Process.Stdin = Nothing;
+    }
+
+    UInt slot = this->n_impl->Slots.size();
+    if (!this->n_impl->Free.empty()) {
+        slot = this->n_impl->Free.back();
+        this->n_impl->Free.pop_back();
+    } else {
+        this->n_impl->Slots.emplace_back();
+    }
+
+    auto attach = [&](Fd fd, source src) -> io::Result<void> {
+        if (src != source::Exit) {
+            Int32 flags = ::fcntl(fd, F_GETFL, 0);
+            if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+                return Err(Error::OSError());
+            }
+        }
+
+        VIOLET_TRY_VOID(this->n_impl->Add(slot, fd, src));
+        entry->Open++;
+
+        return { };
+    };
+
+    auto attached = attach(entry->PidFD, source::Exit);
+    if (attached.Ok() && entry->Process.Stdout.HasValue()) {
+        attached = attach(entry->Process.Stdout->Descriptor.Get(), source::Stdout);
+    }
+
+    if (attached.Ok() && entry->Process.Stderr.HasValue()) {
+        attached = attach(entry->Process.Stderr->Descriptor.Get(), source::Stderr);
+    }
+
+    if (attached.Err()) {
+        this->n_impl->Detach(*entry);
+        this->n_impl->Free.push_back(slot);
+
+        return attached;
+    }
+
+    this->n_impl->Slots[slot] = VIOLET_MOVE(entry);
+    this->n_impl->Pending++;
+
+    return { };
+}
+
+auto Reactor::Poll(Optional<std::chrono::milliseconds> timeout) -> io::Result<UInt>
+{
+    VIOLET_ASSERT(this->n_impl != nullptr, "reactor was moved");
+    if (this->n_impl->Pending == 0) {
+        return 0;
+    }
+
+    Array<struct epoll_event, 64> events;
+    Int32 ready = ::epoll_wait(this->n_impl->Epoll, events.data(), static_cast<Int32>(events.size()),
+        timeout.HasValue() ? static_cast<Int32>(timeout->count()) : -1);
+
+    if (ready < 0) {
+        if (errno == EINTR) {
+            return 0;
+        }
+
+        return Err(Error::OSError());
+    }
+
+    // Callbacks only run once the whole batch was handled: they may watch new children, which
+    // could otherwise reuse the slot of an event that is still waiting in `events`.
+    Vec<UInt> finished;
+    for (Int32 i = 0; i < ready; i++) {
+        UInt64 data = events[static_cast<UInt>(i)].data.u64;
+        UInt slot = static_cast<UInt>(data >> 2);
+
+        auto& child = this->n_impl->Slots[slot];
+        if (child == nullptr || child->Open == 0) {
+            continue;
+        }
+
+        this->n_impl->Dispatch(*child, static_cast<source>(data & 0b11));
+        if (child->Open == 0) {
+            finished.push_back(slot);
+        }
+    }
+
+    for (UInt slot: finished) {
+        auto child = VIOLET_MOVE(this->n_impl->Slots[slot]);
+        this->n_impl->Free.push_back(slot);
+        this->n_impl->Pending--;
+
+        if (!child->Done) {
+            continue;
+        }
+
+        if (child->Failure.HasValue()) {
+            child->Done(Err(VIOLET_MOVE(child->Failure.Value())));
+        } else {
+            child->Done(VIOLET_MOVE(child->Out));
+        }
+    }
+
+    return finished.size();
+}
+
+auto Reactor::Run() -> io::Result<void>
+{
+    while (this->Pending() > 0) {
+        VIOLET_TRY(this->Poll());
+    }
+
+    return { };
+}
+
+auto Reactor::Pending() const noexcept -> UInt
+{
+    return this->n_impl != nullptr ? this->n_impl->Pending : 0;
+}
+
+#endif
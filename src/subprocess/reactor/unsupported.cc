@@ -0,0 +1,75 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Subprocess/Reactor.h>
+
+using violet::subprocess::Child;
+using violet::subprocess::Command;
+using violet::subprocess::PID;
+using violet::subprocess::Reactor;
+using violet::subprocess::ReactorCallback;
+
+struct Reactor::Impl final {
+    Impl() = delete;
+};
+
+Reactor::Reactor(Reactor&& other) noexcept
+    : n_impl(std::exchange(other.n_impl, nullptr))
+{
+}
+
+auto Reactor::operator=(Reactor&& other) noexcept -> Reactor&
+{
+    this->n_impl = std::exchange(other.n_impl, nullptr);
+    return *this;
+}
+
+Reactor::~Reactor() = default;
+
+auto Reactor::New() -> io::Result<Reactor>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto Reactor::Spawn(Command&, ReactorCallback) -> io::Result<PID>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto Reactor::Watch(Child, ReactorCallback) -> io::Result<void>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto Reactor::Poll(Optional<std::chrono::milliseconds>) -> io::Result<UInt>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto Reactor::Run() -> io::Result<void>
+{
+    return Err(VIOLET_IO_ERROR(Unsupported, String, "unsupported operation"));
+}
+
+auto Reactor::Pending() const noexcept -> UInt
+{
+    return 0;
+}
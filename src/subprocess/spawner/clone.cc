@@ -0,0 +1,363 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <violet/Violet.h>
+
+#if VIOLET_PLATFORM(LINUX)
+
+#include <violet/Subprocess.h>
+#include <violet/Subprocess/__detail/Impl.unix.h>
+
+#include <csignal>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using violet::CStr;
+using violet::Err;
+using violet::Int32;
+using violet::Optional;
+using violet::String;
+using violet::UInt;
+using violet::subprocess::Command;
+using violet::subprocess::Stdio;
+using violet::subprocess::detail::SpawnPlan;
+
+constexpr UInt kStackSize = 64 * 1024;
+
+namespace {
+
+void closePipes(Int32 fds[2])
+{
+    if (fds[0] >= 0) {
+        ::close(fds[0]);
+        fds[0] = -1;
+    }
+
+    if (fds[1] >= 0) {
+        ::close(fds[1]);
+        fds[1] = -1;
+    }
+}
+
+/// The stack the child runs on until it calls `execve(2)`.
+///
+/// The parent is suspended for as long as the child uses it (`CLONE_VFORK`), so each thread
+/// only ever needs one and can keep reusing it.
+struct stack final {
+    void* Base = MAP_FAILED;
+
+    ~stack()
+    {
+        if (this->Base != MAP_FAILED) {
+            ::munmap(this->Base, kStackSize);
+        }
+    }
+
+    auto Top() -> void*
+    {
+        if (this->Base == MAP_FAILED) {
+            this->Base = ::mmap(nullptr, kStackSize, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, /*fd=*/-1, /*offset=*/0);
+
+            if (this->Base == MAP_FAILED) {
+                return nullptr;
+            }
+        }
+
+        return static_cast<char*>(this->Base) + kStackSize;
+    }
+};
+
+/// What the child is handed. It lives on the parent's stack, which the child shares, so the
+/// child reports a failure by writing into `Error` instead of through a pipe.
+struct context final {
+    const SpawnPlan* Plan;
+    const CStr* ShellArgv; ///< `argv` for running `Plan->Executable` through `/bin/sh`
+    const Stdio* Streams[3];
+    Int32 Pipes[3]; ///< the child's ends of the stdin, stdout and stderr pipes, or `-1`
+    const gid_t* Groups;
+    UInt GroupCount;
+    Optional<gid_t> GID;
+    Optional<uid_t> UID;
+    sigset_t Mask; ///< the parent's signal mask, which the child gets back before `execve(2)`
+    Int32 Error;
+};
+
+/// Connects `target` to what `config` asks for.
+/// @returns `0` on success, or the `errno` of what failed.
+auto setupFileDescriptor(
+    Int32 pipe, Int32 target, const Stdio& config, const Optional<String>& file, Int32 null, bool readonly) -> Int32
+{
+    if (pipe >= 0) {
+        // `dup2` is a no-op when both are the same, which would leave `FD_CLOEXEC` set
+        if (pipe == target) {
+            return ::fcntl(target, F_SETFD, 0) < 0 ? errno : 0;
+        }
+
+        return ::dup2(pipe, target) < 0 ? errno : 0;
+    }
+
+    if (config.IsNull() && null >= 0) {
+        // the shared `/dev/null` is opened with `O_CLOEXEC`, which `dup2` leaves alone as well
+        if (null == target) {
+            return ::fcntl(target, F_SETFD, 0) < 0 ? errno : 0;
+        }
+
+        return ::dup2(null, target) < 0 ? errno : 0;
+    }
+
+    if (config.IsNull()) {
+        Int32 devNull = ::open("/dev/null", readonly ? O_RDONLY : O_WRONLY);
+        if (devNull >= 0 && devNull != target) {
+            ::dup2(devNull, target);
+            ::close(devNull);
+        }
+    } else if (file.HasValue()) {
+        Int32 flags = readonly ? O_RDONLY : (O_WRONLY | O_CREAT | O_TRUNC);
+        Int32 fd = ::open(file->c_str(), flags, 0644);
+        if (fd < 0) {
+            return errno;
+        }
+
+        if (fd != target) {
+            ::dup2(fd, target);
+            ::close(fd);
+        }
+    }
+
+    return 0;
+}
+
+[[noreturn]] void fail(context* ctx, Int32 error)
+{
+    ctx->Error = error;
+    ::_exit(127);
+}
+
+/// Runs in the child, which shares the parent's memory: only async-signal-safe calls on data the
+/// parent already prepared are allowed in here, and credentials are changed with raw system calls so
+/// that libc doesn't try to synchronize them across the parent's threads.
+auto childMain(void* arg) -> int
+{
+    auto* ctx = static_cast<context*>(arg);
+
+    // A handler installed by the parent would run on the parent's memory; reset every one of them
+    // before unblocking signals. Ignored signals stay ignored, like they would across `fork()`.
+    for (Int32 sig = 1; sig < NSIG; sig++) {
+        struct sigaction action{ };
+        if (::sigaction(sig, nullptr, &action) != 0) {
+            continue;
+        }
+
+        if (action.sa_handler != SIG_IGN && action.sa_handler != SIG_DFL) {
+            action.sa_handler = SIG_DFL;
+            action.sa_flags = 0;
+            ::sigemptyset(&action.sa_mask);
+            ::sigaction(sig, &action, nullptr);
+        }
+    }
+
+    ::sigprocmask(SIG_SETMASK, &ctx->Mask, nullptr);
+
+    const auto& plan = *ctx->Plan;
+    constexpr Int32 kTargets[3] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+    for (UInt i = 0; i < 3; i++) {
+        if (Int32 err = setupFileDescriptor(ctx->Pipes[i], kTargets[i], *ctx->Streams[i], plan.Files[i],
+                plan.Null.Get(), /*readonly=*/i == 0);
+            err != 0) {
+            fail(ctx, err);
+        }
+    }
+
+    if (ctx->GroupCount > 0 && ::syscall(SYS_setgroups, ctx->GroupCount, ctx->Groups) < 0) {
+        fail(ctx, errno);
+    }
+
+    if (ctx->GID.HasValue() && ::syscall(SYS_setgid, *ctx->GID) < 0) {
+        fail(ctx, errno);
+    }
+
+    if (ctx->UID.HasValue() && ::syscall(SYS_setuid, *ctx->UID) < 0) {
+        fail(ctx, errno);
+    }
+
+    if (plan.WorkingDirectory.HasValue() && ::chdir(plan.WorkingDirectory->c_str()) < 0) {
+        fail(ctx, errno);
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+    auto* argv = const_cast<char* const*>(plan.Argv.data());
+    auto* envp = const_cast<char* const*>(plan.Envp.data());
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+
+    // Skips the path walk when the plan kept the program open. A script can't be run this way
+    // (its interpreter couldn't reopen a close-on-exec descriptor), which is reported as `ENOENT`,
+    // or as `ENOEXEC` when it doesn't name an interpreter at all.
+    if (plan.Program.Valid()) {
+        ::syscall(SYS_execveat, plan.Program.Get(), "", argv, envp, AT_EMPTY_PATH);
+        if (errno != ENOENT && errno != ENOSYS && errno != ENOEXEC) {
+            fail(ctx, errno);
+        }
+    }
+
+    ::execve(plan.Executable.c_str(), argv, envp);
+
+    // like `execvp(3)`, a file the kernel doesn't recognize is taken to be a shell script
+    if (errno == ENOEXEC) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        ::execve("/bin/sh", const_cast<char* const*>(ctx->ShellArgv), envp);
+    }
+
+    fail(ctx, errno);
+}
+
+} // namespace
+
+auto violet::subprocess::detail::SpawnWithClone(Command& command) -> io::Result<Child>
+{
+    // `PreExec` hooks were written against `fork()`: with a shared address space anything they
+    // touch would be the parent's memory.
+    if (command.n_impl->n_exec.HasValue()) {
+        return SpawnAsForkExec(command);
+    }
+
+    auto plan = VIOLET_TRY(command.n_impl->Prepare());
+    return SpawnPlanned(command, plan);
+}
+
+auto violet::subprocess::detail::SpawnPlanned(const Command& command, const SpawnPlan& plan) -> io::Result<Child>
+{
+    const auto& impl = *command.n_impl;
+
+    thread_local stack childStack;
+    void* stackTop = childStack.Top();
+    if (stackTop == nullptr) {
+        return Err(io::Error::OSError());
+    }
+
+    Int32 stdinPipes[2] = { -1, -1 };
+    Int32 stdoutPipes[2] = { -1, -1 };
+    Int32 stderrPipes[2] = { -1, -1 };
+
+    if (impl.n_stdin.Piped() && !impl.n_stdin.PipedIntoFile()) {
+        if (!detail::MakePipes(stdinPipes)) {
+            return Err(io::Error::OSError());
+        }
+    }
+
+    if (impl.n_stdout.Piped() && !impl.n_stdout.PipedIntoFile()) {
+        if (!detail::MakePipes(stdoutPipes)) {
+            closePipes(stdinPipes);
+            return Err(io::Error::OSError());
+        }
+    }
+
+    if (impl.n_stderr.Piped() && !impl.n_stderr.PipedIntoFile()) {
+        if (!detail::MakePipes(stderrPipes)) {
+            closePipes(stdinPipes);
+            closePipes(stdoutPipes);
+            return Err(io::Error::OSError());
+        }
+    }
+
+    // The child can't allocate, so it's handed the `argv` it needs should `execve(2)` fail with
+    // `ENOEXEC` up front.
+    Vec<CStr> shellArgv;
+    shellArgv.reserve(plan.Argv.size() + 1);
+    shellArgv.push_back("/bin/sh");
+    shellArgv.push_back(plan.Executable.c_str());
+    shellArgv.insert(shellArgv.end(), plan.Argv.begin() + 1, plan.Argv.end());
+
+    context ctx{
+        .Plan = &plan,
+        .ShellArgv = shellArgv.data(),
+        .Streams = { &impl.n_stdin, &impl.n_stdout, &impl.n_stderr },
+        .Pipes = { stdinPipes[0], stdoutPipes[1], stderrPipes[1] },
+        .Groups = impl.n_extraGroupIDs.data(),
+        .GroupCount = impl.n_extraGroupIDs.size(),
+        .GID = impl.n_gid,
+        .UID = impl.n_uid,
+        .Mask = { },
+        .Error = 0,
+    };
+
+    // Nothing may be delivered to the child before it has reset the parent's handlers.
+    sigset_t all;
+    ::sigfillset(&all);
+    ::pthread_sigmask(SIG_BLOCK, &all, &ctx.Mask);
+
+    // `CLONE_VM | CLONE_VFORK` skips copying the page tables, which is what makes `fork()` slow
+    // for large parents; we're suspended until the child has called `execve(2)` or exited.
+    Int32 pid = ::clone(childMain, stackTop, CLONE_VM | CLONE_VFORK | SIGCHLD, &ctx);
+    Int32 cloneErrno = errno;
+
+    ::pthread_sigmask(SIG_SETMASK, &ctx.Mask, nullptr);
+
+    if (pid < 0) {
+        closePipes(stdinPipes);
+        closePipes(stdoutPipes);
+        closePipes(stderrPipes);
+
+        return Err(io::Error::FromOSError(cloneErrno));
+    }
+
+    for (Int32* fd: { &stdinPipes[0], &stdoutPipes[1], &stderrPipes[1] }) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+
+    if (ctx.Error != 0) {
+        Int32 waited = -1;
+        do {
+            waited = ::waitpid(pid, nullptr, 0);
+        } while (waited < 0 && errno == EINTR);
+
+        closePipes(stdinPipes);
+        closePipes(stdoutPipes);
+        closePipes(stderrPipes);
+
+        return Err(io::Error::FromOSError(ctx.Error));
+    }
+
+    Child child(pid);
+    if (stdinPipes[1] >= 0) {
+        child.Stdin = ChildStdin(stdinPipes[1]);
+    }
+
+    if (stdoutPipes[0] >= 0) {
+        child.Stdout = ChildStdout(stdoutPipes[0]);
+    }
+
+    if (stderrPipes[0] >= 0) {
+        child.Stderr = ChildStderr(stderrPipes[0]);
+    }
+
+    child.DeathTimeout = impl.n_deathTimeout;
+    return child;
+}
+
+#endif
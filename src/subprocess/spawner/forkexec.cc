@@ -53,10 +53,14 @@ void closePipes(Int32 fds[2])
     }
 }
 
-void setupFileDescriptor(Int32 pipe, Int32 target, const Stdio& config, bool readonly = false)
+/// Connects `target` to what `config` asks for in the child process.
+/// @returns `0` on success, or the `errno` of what failed.
+auto setupFileDescriptor(Int32 pipe, Int32 target, const Stdio& config, bool readonly = false) -> Int32
 {
     if (pipe >= 0) {
-        ::dup2(pipe, target);
+        if (::dup2(pipe, target) < 0) {
+            return errno;
+        }
     } else if (config.IsNull()) {
         Int32 devNull = ::open("/dev/null", readonly ? O_RDONLY : O_WRONLY);
         if (devNull >= 0) {
@@ -64,14 +68,19 @@ void setupFileDescriptor(Int32 pipe, Int32 target, const Stdio& config, bool rea
             ::close(devNull);
         }
     } else if (config.PipedIntoFile()) {
+        // the child writes into the file by itself, so none of its output passes through the parent
         auto path = config.PipedFile().Unwrap();
         Int32 flags = readonly ? O_RDONLY : (O_WRONLY | O_CREAT | O_TRUNC);
         Int32 file = ::open(path.Data().c_str(), flags, 0644);
-        if (file >= 0) {
-            ::dup2(file, target);
-            ::close(file);
+        if (file < 0) {
+            return errno;
         }
+
+        ::dup2(file, target);
+        ::close(file);
     }
+
+    return 0;
 }
 
 } // namespace
@@ -138,9 +147,18 @@ auto violet::subprocess::detail::SpawnAsForkExec(Command& command) -> io::Result
             ::_exit(127);
         };
 
-        setupFileDescriptor(stdinPipes[0], STDIN_FILENO, command.n_impl->n_stdin, /*readonly=*/true);
-        setupFileDescriptor(stdoutPipes[1], STDOUT_FILENO, command.n_impl->n_stdout);
-        setupFileDescriptor(stderrPipes[1], STDERR_FILENO, command.n_impl->n_stderr);
+        if (Int32 err = setupFileDescriptor(stdinPipes[0], STDIN_FILENO, command.n_impl->n_stdin, /*readonly=*/true);
+            err != 0) {
+            reportErrno(err);
+        }
+
+        if (Int32 err = setupFileDescriptor(stdoutPipes[1], STDOUT_FILENO, command.n_impl->n_stdout); err != 0) {
+            reportErrno(err);
+        }
+
+        if (Int32 err = setupFileDescriptor(stderrPipes[1], STDERR_FILENO, command.n_impl->n_stderr); err != 0) {
+            reportErrno(err);
+        }
 
         if (!command.n_impl->n_extraGroupIDs.empty()) {
             if (::setgroups(command.n_impl->n_extraGroupIDs.size(), command.n_impl->n_extraGroupIDs.data()) < 0) {
@@ -23,21 +23,81 @@
 
 #if VIOLET_PLATFORM(UNIX)
 
+#include <violet/IO/Transfer.h>
 #include <violet/Subprocess.h>
 #include <violet/Subprocess/PipeReader.h>
 #include <violet/Subprocess/__detail/Impl.unix.h>
 
 #include <fcntl.h>
 #include <sys/poll.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 using violet::Array;
+using violet::Err;
+using violet::Int32;
+using violet::Optional;
+using violet::Str;
+using violet::String;
+using violet::UInt;
 using violet::UInt8;
 using violet::Vec;
 using violet::subprocess::Child;
 using violet::subprocess::Command;
 using violet::subprocess::Stdio;
 
+extern char** environ; // NOLINT
+
+namespace {
+
+/// The search path `execvp(3)` falls back to when `PATH` isn't set.
+constexpr Str kDefaultSearchPath = "/bin:/usr/bin";
+
+/// Finds `program` in the `:`-separated directories of `path` like `execvp(3)` would, so that
+/// the child can call `execve(2)` on the result directly.
+///
+/// Relative entries are looked up in `cwd` (if given), since that's where the child will be once
+/// it calls `execve(2)`; the result is still relative to it.
+auto resolveExecutable(const String& program, Str path, const Optional<String>& cwd) -> violet::io::Result<String>
+{
+    if (program.empty()) {
+        return Err(violet::io::Error::FromOSError(ENOENT));
+    }
+
+    if (program.find('/') != String::npos) {
+        return program;
+    }
+
+    Int32 error = ENOENT;
+    for (UInt start = 0; start <= path.size();) {
+        UInt end = std::min(path.find(':', start), path.size());
+        Str dir = path.substr(start, end - start);
+        start = end + 1;
+
+        // an empty entry means the current working directory
+        String candidate = dir.empty() ? program : std::format("{}/{}", dir, program);
+        String probe = candidate;
+        if (!candidate.starts_with('/') && cwd.HasValue()) {
+            probe = std::format("{}/{}", *cwd, candidate);
+        }
+
+        struct stat st{ };
+        if (::stat(probe.c_str(), &st) != 0 || S_ISDIR(st.st_mode)) {
+            continue;
+        }
+
+        if (::access(probe.c_str(), X_OK) == 0) {
+            return candidate;
+        }
+
+        error = EACCES;
+    }
+
+    return Err(violet::io::Error::FromOSError(error));
+}
+
+} // namespace
+
 Command::Impl::Impl(Str program)
     : Impl(program, { })
 {
@@ -55,6 +115,67 @@ Command::Impl::Impl(Str program, std::initializer_list<String> args)
 {
 }
 
+auto Command::Impl::Prepare() const -> io::Result<detail::SpawnPlan>
+{
+    detail::SpawnPlan plan;
+    plan.Arguments.reserve(this->n_args.size() + 1);
+    plan.Arguments.push_back(this->n_program);
+    plan.Arguments.insert(plan.Arguments.end(), this->n_args.begin(), this->n_args.end());
+
+    // The command's own variables win over the ones inherited from us.
+    if (environ != nullptr) {
+        for (char** env = environ; *env != nullptr; env++) {
+            Str entry(*env);
+            if (this->n_environ.contains(String(entry.substr(0, entry.find('='))))) {
+                continue;
+            }
+
+            plan.Environment.emplace_back(entry);
+        }
+    }
+
+    for (const auto& [key, value]: this->n_environ) {
+        plan.Environment.push_back(std::format("{}={}", key, value));
+    }
+
+    Str searchPath = kDefaultSearchPath;
+    for (const auto& entry: plan.Environment) {
+        if (entry.starts_with("PATH=")) {
+            searchPath = Str(entry).substr(5);
+            break;
+        }
+    }
+
+    if (this->n_wd.HasValue()) {
+        plan.WorkingDirectory = this->n_wd->Data();
+    }
+
+    plan.Executable = VIOLET_TRY(resolveExecutable(this->n_program, searchPath, plan.WorkingDirectory));
+
+    plan.Argv.reserve(plan.Arguments.size() + 1);
+    for (const auto& arg: plan.Arguments) {
+        plan.Argv.push_back(arg.c_str());
+    }
+
+    plan.Argv.push_back(nullptr);
+
+    plan.Envp.reserve(plan.Environment.size() + 1);
+    for (const auto& entry: plan.Environment) {
+        plan.Envp.push_back(entry.c_str());
+    }
+
+    plan.Envp.push_back(nullptr);
+
+    const Stdio* streams[3] = { &this->n_stdin, &this->n_stdout, &this->n_stderr };
+    for (UInt i = 0; i < 3; i++) {
+        if (streams[i]->PipedIntoFile()) {
+            plan.Files[i] = streams[i]->PipedFile()->Data();
+        }
+    }
+
+    return plan;
+}
+
 Command::Command(Str program)
     : n_impl(new Impl(program))
 {
@@ -185,6 +306,17 @@ auto Command::WithWorkingDirectory(filesystem::PathRef path) -> Command&
 auto Command::Output() -> io::Result<struct Output>
 {
     auto child = VIOLET_TRY(this->Spawn());
+    return detail::CollectOutput(child);
+}
+
+auto Command::Status() -> io::Result<ExitStatus>
+{
+    auto child = VIOLET_TRY(this->Spawn());
+    return detail::CollectStatus(child);
+}
+
+auto violet::subprocess::detail::CollectOutput(Child& child) -> io::Result<struct Output>
+{
     struct Output out;
 
     auto setFDAsNonBlocking = [](Int32 fd) -> void {
@@ -194,46 +326,39 @@ auto Command::Output() -> io::Result<struct Output>
         }
     };
 
-    bool needsMultiplexing = child.Stdout.HasValue() && child.Stderr.HasValue();
-    if (auto& stdout = child.Stdout; stdout.HasValue()) {
-        if (!needsMultiplexing) {
-            auto reader = GetPipeReader();
-            VIOLET_ASSERT(reader != nullptr, "there is no unique PipeReader implementation available");
-
-            if (reader->WantsNonBlocking()) {
-                setFDAsNonBlocking(stdout->Descriptor.Get());
-            }
-
-            VIOLET_TRY_VOID(reader->Register(stdout->Descriptor.Get()));
-            out.Stdout = VIOLET_TRY(reader->CaptureAll());
-        }
-    }
+    io::FileDescriptor::value_type stdoutFd = child.Stdout.HasValue() ? child.Stdout->Descriptor.Get() : -1;
+    io::FileDescriptor::value_type stderrFd = child.Stderr.HasValue() ? child.Stderr->Descriptor.Get() : -1;
+
+    // Both streams are drained by one reader on one event loop, each into its own sink.
+    if (stdoutFd >= 0 || stderrFd >= 0) {
+        auto reader = GetPipeReader();
+        if (reader == nullptr) {
+            setFDAsNonBlocking(stdoutFd);
+            setFDAsNonBlocking(stderrFd);
+            detail::DrainPipes(stdoutFd, stderrFd, out);
+        } else {
+            for (auto [fd, sink]: { std::pair{ stdoutFd, &out.Stdout }, std::pair{ stderrFd, &out.Stderr } }) {
+                if (fd < 0) {
+                    continue;
+                }
 
-    if (auto& stderr = child.Stderr; stderr.HasValue()) {
-        if (!needsMultiplexing) {
-            auto reader = GetPipeReader();
-            VIOLET_ASSERT(reader != nullptr, "there is no unique PipeReader implementation available");
+                if (reader->WantsNonBlocking()) {
+                    setFDAsNonBlocking(fd);
+                }
 
-            if (reader->WantsNonBlocking()) {
-                setFDAsNonBlocking(stderr->Descriptor.Get());
+                VIOLET_TRY_VOID(reader->Register(fd, *sink));
             }
 
-            VIOLET_TRY_VOID(reader->Register(stderr->Descriptor.Get()));
-            out.Stdout = VIOLET_TRY(reader->CaptureAll());
+            VIOLET_TRY_VOID(reader->Drain());
         }
     }
 
-    if (needsMultiplexing) {
-        detail::DrainPipes(child.Stdout->Descriptor.Get(), child.Stderr->Descriptor.Get(), out);
-    }
-
     out.Status = VIOLET_TRY(child.Wait());
     return out;
 }
 
-auto Command::Status() -> io::Result<ExitStatus>
+auto violet::subprocess::detail::CollectStatus(Child& child) -> io::Result<ExitStatus>
 {
-    auto child = VIOLET_TRY(this->Spawn());
     if (child.Stdin.HasValue()) {
         child.Stdin->Descriptor.Close();
     }
@@ -254,6 +379,24 @@ auto Child::ToString() const -> String
     return std::format("Child(pid={})", this->PID);
 }
 
+auto Child::TransferStdout(io::FileDescriptor::value_type dst, UInt64 count) const -> io::Result<UInt64>
+{
+    if (!this->Stdout.HasValue()) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "stdout of the child process was not piped"));
+    }
+
+    return io::Transfer(this->Stdout->Descriptor.Get(), dst, count);
+}
+
+auto Child::TransferStderr(io::FileDescriptor::value_type dst, UInt64 count) const -> io::Result<UInt64>
+{
+    if (!this->Stderr.HasValue()) {
+        return Err(VIOLET_IO_ERROR(InvalidInput, String, "stderr of the child process was not piped"));
+    }
+
+    return io::Transfer(this->Stderr->Descriptor.Get(), dst, count);
+}
+
 auto Child::Kill(Int32 signal) const -> io::Result<void>
 {
     if (!this->PID) {
@@ -314,7 +457,6 @@ void violet::subprocess::detail::DrainPipes(
                         out.Stderr.insert(out.Stderr.end(), chunk.begin(), chunk.begin() + num);
                     }
                 } else if (num == 0) {
-                    ::close(pfds[i].fd);
                     pfds[i].fd = -1;
                     openFDs--;
                     break;
@@ -327,7 +469,6 @@ void violet::subprocess::detail::DrainPipes(
                         continue;
                     }
 
-                    ::close(pfds[i].fd);
                     pfds[i].fd = -1;
                     openFDs--;
                     break;
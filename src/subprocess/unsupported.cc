@@ -75,6 +75,18 @@ __return_this__(WithWorkingDirectory, filesystem::PathRef);
 
 #undef __return_this__
 
+auto Child::TransferStdout(io::FileDescriptor::value_type, UInt64) const -> io::Result<UInt64>
+{
+    return Err(VIOLET_IO_ERROR(
+        Unsupported, String, "unsupported on platform: `violet::subprocess::Child::TransferStdout(...)`"));
+}
+
+auto Child::TransferStderr(io::FileDescriptor::value_type, UInt64) const -> io::Result<UInt64>
+{
+    return Err(VIOLET_IO_ERROR(
+        Unsupported, String, "unsupported on platform: `violet::subprocess::Child::TransferStderr(...)`"));
+}
+
 auto Child::Kill(Int32) const -> io::Result<void>
 {
     return Err(
@@ -670,6 +670,63 @@ TEST(ResultVoid, MoveAssign)
     EXPECT_EQ(b.Error(), "fail");
 }
 
+TEST(ResultVoid, CopyAssignOkOverErr)
+{
+    Result<void, String> a;
+    Result<void, String> b = Err<String>("fail");
+    b = a;
+    EXPECT_TRUE(b.Ok());
+}
+
+TEST(ResultVoid, MoveAssignOkOverErr)
+{
+    Result<void, String> a;
+    Result<void, String> b = Err<String>("fail");
+    b = VIOLET_MOVE(a);
+    EXPECT_TRUE(b.Ok());
+}
+
+TEST(ResultVoid, MoveAssignErrOverErr)
+{
+    Result<void, String> a = Err<String>("second");
+    Result<void, String> b = Err<String>("first");
+    b = VIOLET_MOVE(a);
+    EXPECT_TRUE(b.Err());
+    EXPECT_EQ(b.Error(), "second");
+}
+
+TEST(ResultVoid, InspectErrOnlyOnErr)
+{
+    Int32 calls = 0;
+
+    Result<void, String> ok;
+    ok.InspectErr([&](const String&) -> void { calls++; });
+    EXPECT_EQ(calls, 0);
+
+    Result<void, String> err = Err<String>("fail");
+    err.InspectErr([&](const String& s) -> void {
+        EXPECT_EQ(s, "fail");
+        calls++;
+    });
+
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ResultVoid, IntoErr)
+{
+    Result<void, String> err = Err<String>("fail");
+    String error = VIOLET_MOVE(err).IntoErr();
+    EXPECT_EQ(error, "fail");
+}
+
+TEST(ResultVoid, StoresErrorInline)
+{
+    // The error lives inside the `Result` itself, so it is never larger than the
+    // tagged union that the primary `Result<T, E>` uses.
+    static_assert(sizeof(Result<void, String>) <= sizeof(Result<bool, String>));
+    static_assert(sizeof(Result<void, Int32>) <= 2 * sizeof(Int32));
+}
+
 TEST(ResultVoid, BoolConversion)
 {
     Result<void, String> ok;
@@ -1059,6 +1116,13 @@ TEST(ResultVoidConstexpr, DefaultIsOk)
 
 #endif
 
+TEST(ResultVoidConstexpr, ConstructErr)
+{
+    constexpr Result<void, Int32> r = Err<Int32>(7);
+    static_assert(r.Err());
+    static_assert(r.Error() == 7);
+}
+
 TEST(ResultTraitsConstexpr, IsResult)
 {
     static_assert(is_result_v<Result<Int32, Int32>>);
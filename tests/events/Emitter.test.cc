@@ -143,3 +143,76 @@ TEST(Events, EmitterThreadSafe)
 
     ASSERT_EQ(ids.size(), 1300);
 }
+
+TEST(Events, OnceListenerFiresOnlyOnce)
+{
+    Emitter<UInt32> emitter;
+    Event<UInt32> event = emitter.Event();
+
+    UInt32 calls = 0;
+    auto guard = event.Once([&](UInt32) -> void { calls++; });
+
+    emitter.Fire(1);
+    emitter.Fire(2);
+
+    ASSERT_EQ(calls, 1);
+}
+
+TEST(Events, ListenersFireInSubscriptionOrder)
+{
+    Emitter<UInt32> emitter;
+    Event<UInt32> event = emitter.Event();
+
+    Vec<Int32> order;
+    auto first = event([&](UInt32) -> void { order.push_back(1); });
+    auto second = event([&](UInt32) -> void { order.push_back(2); });
+    auto third = event([&](UInt32) -> void { order.push_back(3); });
+
+    second.Dispose();
+    emitter.Fire(0);
+
+    ASSERT_EQ(order, (Vec<Int32>{ 1, 3 }));
+}
+
+TEST(Events, StaleIdDoesNotRemoveReusedSlot)
+{
+    Emitter<UInt32> emitter;
+    Event<UInt32> event = emitter.Event();
+
+    Int64 stale = -1;
+    {
+        auto guard = event([](UInt32) -> void { });
+        stale = guard.ID();
+    }
+
+    UInt32 called = 0;
+    auto guard = event([&](UInt32 value) -> void { called = value; });
+    ASSERT_NE(guard.ID(), stale);
+
+    emitter.Unsubscribe(stale);
+    emitter.Fire(7);
+
+    ASSERT_EQ(called, 7);
+}
+
+TEST(Events, FireWhileSubscribing)
+{
+    Emitter<UInt32> emitter;
+    Event<UInt32> event = emitter.Event();
+
+    std::atomic<UInt32> fired = 0;
+    auto guard = event([&](UInt32) -> void { fired++; });
+
+    std::thread subscriber([&]() -> void {
+        for (Int32 i = 0; i < 1000; i++) {
+            auto other = event([](UInt32) -> void { });
+        }
+    });
+
+    for (Int32 i = 0; i < 1000; i++) {
+        emitter.Fire(0);
+    }
+
+    subscriber.join();
+    ASSERT_EQ(fired.load(), 1000);
+}
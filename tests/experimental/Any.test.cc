@@ -260,4 +260,73 @@ TEST(Any, MoveDoesNotIncrementLifecycleCount)
     EXPECT_EQ(LifecycleTracker::alive, 0);
 }
 
+namespace {
+
+struct alignas(64) OverAligned {
+    Int32 Value = 0;
+
+    friend auto operator<<(std::ostream& os, const OverAligned& self) -> std::ostream&
+    {
+        return os << self.Value;
+    }
+};
+
+struct Large {
+    char Bytes[VIOLET_EXPERIMENTAL_ANY_INLINE_CAPACITY + 1] = { };
+};
+
+} // namespace
+
+TEST(Any, SmallValuesAreStoredInline)
+{
+    static_assert(any_stores_inline_v<Int32>);
+    static_assert(any_stores_inline_v<void*>);
+    static_assert(!any_stores_inline_v<Large>);
+    static_assert(!any_stores_inline_v<OverAligned>);
+
+    auto value = Any::New<Int32>(42);
+    EXPECT_TRUE(value.IsInline());
+
+    auto copy = value;
+    EXPECT_TRUE(copy.IsInline());
+    EXPECT_EQ(copy.Downcast<Int32>(), 42);
+
+    auto moved = VIOLET_MOVE(value);
+    EXPECT_TRUE(moved.IsInline());
+    EXPECT_EQ(moved.Downcast<Int32>(), 42);
+}
+
+TEST(Any, LargeValuesSpillToHeap)
+{
+    auto value = Any::New<Large>();
+    EXPECT_FALSE(value.IsInline());
+
+    auto copy = value;
+    EXPECT_FALSE(copy.IsInline());
+    EXPECT_TRUE(copy.Downcast<Large>());
+}
+
+TEST(Any, OverAlignedValuesRespectAlignment)
+{
+    auto value = Any::New<OverAligned>(OverAligned{ .Value = 7 });
+    EXPECT_FALSE(value.IsInline());
+
+    auto copy = value;
+    auto result = copy.Downcast<OverAligned>();
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->Value, 7);
+    EXPECT_EQ(copy.ToString(), "7");
+}
+
+TEST(Any, InlineMoveAssignRelocatesValue)
+{
+    auto a = Any::New<String>("a");
+    auto b = Any::New<Int32>(20);
+
+    a = VIOLET_MOVE(b);
+    EXPECT_TRUE(a.IsInline());
+    EXPECT_EQ(a.Downcast<Int32>(), 20);
+}
+
 // NOLINTEND(readability-identifier-length,google-build-using-namespace,performance-unnecessary-copy-initialization)
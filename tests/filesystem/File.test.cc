@@ -202,3 +202,95 @@ TEST_F(FileTest, MetadataMatchesPathBasedQuery)
     EXPECT_EQ(viaFile->Device, viaPath->Device);
 #endif
 }
+
+TEST_F(FileTest, ReadAtDoesNotMoveTheCursor)
+{
+    auto opened = OpenOptions{ }.Read().Open(Layout->A);
+    ASSERT_TRUE(opened) << "failed to open file [" << Layout->A << "]: " << opened.Error();
+
+    Array<UInt8, 3> tail{ };
+    auto bytes = opened->ReadAt(tail, 2);
+    ASSERT_TRUE(bytes) << bytes.Error();
+    ASSERT_EQ(*bytes, 3U);
+    EXPECT_EQ(std::memcmp(tail.data(), "llo", 3), 0);
+
+    Array<UInt8, 5> whole{ };
+    auto read = opened->Read(whole);
+    ASSERT_TRUE(read) << read.Error();
+    ASSERT_EQ(*read, 5U) << "`ReadAt' must leave the file offset at the start";
+    EXPECT_EQ(std::memcmp(whole.data(), "hello", 5), 0);
+}
+
+TEST_F(FileTest, WriteAtPatchesInPlace)
+{
+    {
+        auto opened = OpenOptions{ }.Read().Write().Open(Layout->A);
+        ASSERT_TRUE(opened) << opened.Error();
+
+        Array<UInt8, 2> patch({ 'E', 'L' });
+        auto written = opened->WriteAt(patch, 1);
+        ASSERT_TRUE(written) << written.Error();
+        EXPECT_EQ(*written, 2U);
+
+        Array<UInt8, 1> first{ };
+        ASSERT_TRUE(opened->Read(first));
+        EXPECT_EQ(first[0], 'h') << "`WriteAt' must leave the file offset at the start";
+    }
+
+    auto reopened = OpenOptions{ }.Read().Open(Layout->A);
+    ASSERT_TRUE(reopened);
+
+    auto bytes = io::ReadToBytes(*reopened);
+    ASSERT_TRUE(bytes);
+    ASSERT_EQ(bytes->size(), 5U);
+    EXPECT_EQ(std::memcmp(bytes->data(), "hELlo", 5), 0);
+}
+
+TEST_F(FileTest, VectoredRoundTrip)
+{
+    const Path fresh = Layout->Root.Path().Join("vectored.bin");
+    auto opened = OpenOptions{ }.CreateNew().Read().Write().Open(fresh);
+    ASSERT_TRUE(opened) << opened.Error();
+
+    // More buffers than fit in the inline `iovec` storage.
+    Vec<Vec<UInt8>> chunks;
+    Vec<Span<const UInt8>> outgoing;
+    for (UInt8 i = 0; i < 20; i++) {
+        chunks.emplace_back(static_cast<UInt>(i) + 1, i);
+    }
+
+    for (const auto& chunk: chunks) {
+        outgoing.emplace_back(chunk);
+    }
+
+    auto written = opened->WriteVectored(outgoing);
+    ASSERT_TRUE(written) << written.Error();
+    ASSERT_EQ(*written, 210U);
+
+    Array<UInt8, 1> head{ };
+    Vec<UInt8> rest(209);
+    Array<Span<UInt8>, 2> incoming({ Span<UInt8>(head), Span<UInt8>(rest) });
+
+    auto read = opened->ReadVectoredAt(incoming, 0);
+    ASSERT_TRUE(read) << read.Error();
+    ASSERT_EQ(*read, 210U);
+    EXPECT_EQ(head[0], 0);
+    EXPECT_EQ(rest[0], 1);
+    EXPECT_EQ(rest[2], 2);
+    EXPECT_EQ(rest.back(), 19);
+
+    auto past = opened->ReadVectoredAt(incoming, 210);
+    ASSERT_TRUE(past) << past.Error();
+    EXPECT_EQ(*past, 0U) << "reading past the end must report EOF";
+}
+
+TEST_F(FileTest, WriteAtWithDataSync)
+{
+    auto opened = OpenOptions{ }.Write().Open(Layout->A);
+    ASSERT_TRUE(opened) << opened.Error();
+
+    Array<UInt8, 1> patch({ 'j' });
+    auto written = opened->WriteAt(patch, 0, io::IOFlag::DataSync);
+    ASSERT_TRUE(written) << written.Error();
+    EXPECT_EQ(*written, 1U);
+}
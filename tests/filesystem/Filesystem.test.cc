@@ -45,7 +45,7 @@ auto collectNames(Iter& it) -> std::unordered_set<String>
             continue;
         }
 
-        names.insert(ret->Path.Filename());
+        names.insert(String(ret->Name()));
     }
 
     return names;
@@ -204,4 +204,122 @@ TEST_F(FilesystemTest, WalkDirOnEmptyDirYieldsNothing)
     EXPECT_FALSE(walk->Next());
 }
 
+TEST_F(FilesystemTest, DirEntryTypeMatchesMetadata)
+{
+    auto dirs = ReadDir(Layout->Root.Path());
+    ASSERT_TRUE(dirs) << dirs.Error();
+
+    for (auto entry: *dirs) {
+        ASSERT_TRUE(entry) << entry.Error();
+
+        auto metadata = entry->Metadata();
+        ASSERT_TRUE(metadata) << "failed to query metadata for [" << entry->Path() << "]: " << metadata.Error();
+        EXPECT_EQ(entry->Type.File(), metadata->Type.File()) << entry->Path();
+        EXPECT_EQ(entry->Type.Dir(), metadata->Type.Dir()) << entry->Path();
+        EXPECT_EQ(entry->Type.Symlink(), metadata->Type.Symlink()) << entry->Path();
+    }
+}
+
+TEST_F(FilesystemTest, DirEntryReportsSymlinksWithoutFollowing)
+{
+    auto dirs = ReadDir(Layout->Root.Path());
+    ASSERT_TRUE(dirs) << dirs.Error();
+
+    UInt symlinks = 0;
+    for (auto entry: *dirs) {
+        ASSERT_TRUE(entry) << entry.Error();
+        if (entry->Name() == "link-to-a" || entry->Name() == "dangling") {
+            EXPECT_TRUE(entry->Type.Symlink()) << entry->Path();
+            symlinks++;
+        }
+    }
+
+    EXPECT_EQ(symlinks, 2U);
+}
+
+TEST_F(FilesystemTest, DirEntryMetadataOutlivesIterator)
+{
+    Vec<DirEntry> entries;
+    {
+        auto dirs = ReadDir(Layout->Nested.Path);
+        ASSERT_TRUE(dirs) << dirs.Error();
+
+        for (auto entry: *dirs) {
+            ASSERT_TRUE(entry) << entry.Error();
+            entries.push_back(VIOLET_MOVE(entry.Value()));
+        }
+    }
+
+    ASSERT_EQ(entries.size(), 3U);
+    for (auto& entry: entries) {
+        auto metadata = entry.Metadata();
+        ASSERT_TRUE(metadata) << "failed to query metadata for [" << entry.Path() << "]: " << metadata.Error();
+        EXPECT_EQ(entry.Type.Dir(), metadata->Type.Dir());
+        if (entry.Name() == "c.txt") {
+            EXPECT_EQ(metadata->Size, 3U);
+        }
+    }
+}
+
+TEST_F(FilesystemTest, DirEntryMetadataHonoursMask)
+{
+    auto walk = WalkDir(Layout->Nested.Path);
+    ASSERT_TRUE(walk) << walk.Error();
+
+    for (auto entry: *walk) {
+        ASSERT_TRUE(entry) << entry.Error();
+        if (entry->Name() != "c.txt") {
+            continue;
+        }
+
+        auto sized = entry->Metadata(MetadataField::Type | MetadataField::Size);
+        ASSERT_TRUE(sized) << sized.Error();
+        EXPECT_TRUE(sized->Type.File());
+        EXPECT_EQ(sized->Size, 3U);
+
+        // asking for more than what was cached has to query again
+        auto full = entry->Metadata();
+        ASSERT_TRUE(full) << full.Error();
+        EXPECT_EQ(full->Size, 3U);
+        EXPECT_NE(full->ModifiedAt, 0U);
+    }
+}
+
+TEST_F(FilesystemTest, WalkDirEntriesJoinOntoTheRoot)
+{
+    auto walk = WalkDir(Layout->Nested.Path);
+    ASSERT_TRUE(walk) << walk.Error();
+
+    bool found = false;
+    for (auto entry: *walk) {
+        ASSERT_TRUE(entry) << entry.Error();
+        if (entry->Name() == "d.txt") {
+            EXPECT_EQ(entry->Path(), Layout->Nested.Deeper.D);
+            found = true;
+        }
+    }
+
+    EXPECT_TRUE(found) << "WalkDir must descend into deeper/";
+}
+
+TEST_F(FilesystemTest, ReadDirYieldsEveryEntryOfALargeDirectory)
+{
+    // enough entries that a single `getdents64(2)` batch can't hold all of them
+    constexpr UInt kEntries = 12'000;
+
+    const Path large = Layout->Root.Path().Join("large");
+    ASSERT_TRUE(CreateDirectory(large));
+    for (UInt i = 0; i < kEntries; i++) {
+        ASSERT_TRUE(CreateFile(large.Join(violet::ToString(i))));
+    }
+
+    auto dirs = ReadDir(large);
+    ASSERT_TRUE(dirs) << dirs.Error();
+
+    auto names = collectNames(*dirs);
+    EXPECT_EQ(names.size(), kEntries);
+    EXPECT_NE(names.find("0"), names.end());
+    EXPECT_NE(names.find(violet::ToString(kEntries - 1)), names.end());
+}
+
 // NOLINTEND(google-build-using-namespace)
@@ -118,4 +118,75 @@ TEST_F(MetadataTest, FromFileDescriptorMatchesPathQuery)
 #endif
 }
 
+TEST_F(MetadataTest, ForManyReturnsResultsInOrder)
+{
+    const Path missing = Layout->Root.Path().Join("does-not-exist");
+
+    Vec<PathRef> paths;
+    for (UInt i = 0; i < 100; i++) {
+        // more than a single batch, with the odd missing path in between
+        switch (i % 4) {
+        case 0:
+            paths.emplace_back(Layout->A);
+            break;
+
+        case 1:
+            paths.emplace_back(Layout->B);
+            break;
+
+        case 2:
+            paths.emplace_back(Layout->Nested.Path);
+            break;
+
+        default:
+            paths.emplace_back(missing);
+            break;
+        }
+    }
+
+    auto results = Metadata::ForMany(paths);
+    ASSERT_EQ(results.size(), paths.size());
+
+    for (UInt i = 0; i < results.size(); i++) {
+        switch (i % 4) {
+        case 0:
+            ASSERT_TRUE(results[i]) << results[i].Error();
+            EXPECT_TRUE(results[i]->Type.File());
+            EXPECT_EQ(results[i]->Size, 5);
+            break;
+
+        case 1:
+            ASSERT_TRUE(results[i]) << results[i].Error();
+            EXPECT_EQ(results[i]->Size, 1024);
+            break;
+
+        case 2:
+            ASSERT_TRUE(results[i]) << results[i].Error();
+            EXPECT_TRUE(results[i]->Type.Dir());
+            break;
+
+        default:
+            EXPECT_FALSE(results[i]) << "expected [" << missing << "] to not exist";
+            break;
+        }
+    }
+}
+
+TEST_F(MetadataTest, ForManyHonorsResolutionAndMask)
+{
+    const Vec<PathRef> paths = { Layout->LinkToA, Layout->Dangling, "" };
+
+    auto results = Metadata::ForMany(paths, MetadataField::Type | MetadataField::Size, SymlinkResolution::NoFollow);
+    ASSERT_EQ(results.size(), 3);
+
+    ASSERT_TRUE(results[0]) << results[0].Error();
+    EXPECT_TRUE(results[0]->Type.Symlink());
+
+    ASSERT_TRUE(results[1]) << results[1].Error();
+    EXPECT_TRUE(results[1]->Type.Symlink());
+
+    // like `Metadata::For`, an empty path doesn't exist rather than being the working directory
+    EXPECT_FALSE(results[2]);
+}
+
 // NOLINTEND(google-build-using-namespace)
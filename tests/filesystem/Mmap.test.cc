@@ -0,0 +1,126 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "tests/filesystem/support/Layout.h"
+
+#include <violet/Filesystem/Mmap.h>
+#include <violet/IO/Read.h>
+
+#include <cstring>
+
+using namespace violet;
+using namespace violet::filesystem;
+using namespace violet::filesystem::testing;
+
+namespace {
+struct MmapTest: public LayoutFixture { };
+} // namespace
+
+TEST_F(MmapTest, DefaultConstructIsEmpty)
+{
+    Mmap map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Size(), 0U);
+    EXPECT_FALSE(map.Writable());
+    EXPECT_TRUE(map.Unmap());
+}
+
+TEST_F(MmapTest, MapsTheWholeFile)
+{
+    auto opened = OpenOptions{ }.Read().Open(Layout->B);
+    ASSERT_TRUE(opened) << "failed to open file [" << Layout->B << "]: " << opened.Error();
+
+    auto map = Mmap::Map(*opened);
+    ASSERT_TRUE(map) << "failed to map file: " << map.Error();
+    ASSERT_TRUE(opened->Close()) << "the mapping must outlive the file";
+
+    ASSERT_EQ(map->Size(), 1024U);
+    EXPECT_FALSE(map->Writable());
+    for (UInt8 byte: map->Data()) {
+        ASSERT_EQ(byte, 0xAB);
+    }
+
+    EXPECT_TRUE(map->Advise(MmapAdvice::Random));
+    EXPECT_TRUE(map->Advise(MmapAdvice::WillNeed, 100, 10));
+    EXPECT_FALSE(map->Advise(MmapAdvice::WillNeed, 1000, 100)) << "advice past the end must be rejected";
+}
+
+TEST_F(MmapTest, EmptyFileProducesAnEmptyMapping)
+{
+    auto opened = OpenOptions{ }.Read().Open(Layout->Nested.Deeper.D);
+    ASSERT_TRUE(opened) << opened.Error();
+
+    auto map = Mmap::Map(*opened);
+    ASSERT_TRUE(map) << map.Error();
+    EXPECT_TRUE(map->Empty());
+}
+
+TEST_F(MmapTest, UnalignedOffsetAndLength)
+{
+    auto opened = OpenOptions{ }.Read().Open(Layout->A);
+    ASSERT_TRUE(opened) << opened.Error();
+
+    auto map = MmapOptions{ }.Offset(1).Length(3).Populate().HugePages().Map(*opened);
+    ASSERT_TRUE(map) << map.Error();
+    ASSERT_EQ(map->Size(), 3U);
+    EXPECT_EQ(std::memcmp(map->Data().data(), "ell", 3), 0);
+
+    auto past = MmapOptions{ }.Offset(6).Map(*opened);
+    EXPECT_FALSE(past) << "an offset past the end of the file must be rejected";
+}
+
+TEST_F(MmapTest, WritableMappingWritesThrough)
+{
+    {
+        auto opened = OpenOptions{ }.Read().Write().Open(Layout->A);
+        ASSERT_TRUE(opened) << opened.Error();
+
+        auto map = Mmap::MapMut(*opened);
+        ASSERT_TRUE(map) << map.Error();
+        ASSERT_TRUE(map->Writable());
+
+        map->DataMut()[0] = 'j';
+        ASSERT_TRUE(map->Flush()) << "failed to flush the mapping";
+    }
+
+    auto reopened = OpenOptions{ }.Read().Open(Layout->A);
+    ASSERT_TRUE(reopened);
+
+    auto bytes = io::ReadToBytes(*reopened);
+    ASSERT_TRUE(bytes);
+    ASSERT_EQ(bytes->size(), 5U);
+    EXPECT_EQ(std::memcmp(bytes->data(), "jello", 5), 0);
+}
+
+TEST_F(MmapTest, MoveTransfersOwnership)
+{
+    auto opened = OpenOptions{ }.Read().Open(Layout->A);
+    ASSERT_TRUE(opened) << opened.Error();
+
+    auto map = Mmap::Map(*opened);
+    ASSERT_TRUE(map) << map.Error();
+
+    Mmap moved = VIOLET_MOVE(map.Value());
+    EXPECT_TRUE(map->Empty()); // NOLINT(bugprone-use-after-move)
+    ASSERT_EQ(moved.Size(), 5U);
+    EXPECT_EQ(std::memcmp(moved.Data().data(), "hello", 5), 0);
+}
@@ -48,7 +48,7 @@ auto collectNames(Iter& it) -> std::unordered_set<String>
             continue;
         }
 
-        names.insert(ret->Path.Filename());
+        names.insert(String(ret->Name()));
     }
 
     return names;
@@ -0,0 +1,150 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "tests/filesystem/support/Layout.h"
+
+#include <violet/Experimental/Threading/CancellationToken.h>
+#include <violet/Filesystem.h>
+#include <violet/Filesystem/Experimental/ParallelWalkDir.h>
+
+#include <algorithm>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet;
+using namespace violet::filesystem;
+using namespace violet::filesystem::experimental;
+using namespace violet::filesystem::testing;
+
+using violet::experimental::threading::CancellationTokenSource;
+
+namespace {
+
+struct ParallelWalkDirTest: public LayoutFixture {
+protected:
+    /// Builds `width` directories under `<root>/wide`, each holding `width` files and one more
+    /// directory level, so that there's plenty of work to spread across the workers.
+    auto Wide(UInt width) -> Path
+    {
+        const Path wide = Layout->Root.Path().Join("wide");
+        EXPECT_TRUE(CreateDirectory(wide));
+
+        for (UInt i = 0; i < width; i++) {
+            const Path dir = wide.Join(violet::ToString(i));
+            EXPECT_TRUE(CreateDirectories(dir.Join("inner")));
+
+            for (UInt j = 0; j < width; j++) {
+                EXPECT_TRUE(CreateFile(dir.Join(violet::ToString(j))));
+            }
+        }
+
+        return wide;
+    }
+};
+
+template<typename Iter>
+auto collectPaths(Iter& it) -> Vec<String>
+{
+    Vec<String> paths;
+    for (io::Result<DirEntry> ret: it) {
+        EXPECT_TRUE(ret) << ret.Error();
+        if (ret.Ok()) {
+            paths.push_back(String(ret->Path()));
+        }
+    }
+
+    return paths;
+}
+
+} // namespace
+
+TEST_F(ParallelWalkDirTest, YieldsTheSameEntriesAsWalkDir)
+{
+    const Path wide = this->Wide(32);
+
+    auto walk = WalkDir(wide);
+    ASSERT_TRUE(walk) << walk.Error();
+
+    auto parallel = ParallelWalkDir(wide, 4);
+    ASSERT_TRUE(parallel) << parallel.Error();
+
+    auto expected = collectPaths(*walk);
+    auto actual = collectPaths(*parallel);
+
+    std::ranges::sort(expected);
+    std::ranges::sort(actual);
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(ParallelWalkDirTest, OrderedWalkMatchesWalkDir)
+{
+    const Path wide = this->Wide(32);
+
+    auto walk = WalkDir(wide);
+    ASSERT_TRUE(walk) << walk.Error();
+
+    auto parallel = ParallelWalkDir(wide, 4, { .Order = WalkOrder::Ordered });
+    ASSERT_TRUE(parallel) << parallel.Error();
+
+    EXPECT_EQ(collectPaths(*parallel), collectPaths(*walk));
+}
+
+TEST_F(ParallelWalkDirTest, DefaultsToHardwareThreads)
+{
+    auto parallel = ParallelWalkDir(Layout->Root.Path());
+    ASSERT_TRUE(parallel) << parallel.Error();
+
+    auto paths = collectPaths(*parallel);
+    EXPECT_NE(std::ranges::find(paths, String(Layout->Nested.Deeper.D)), paths.end());
+
+    // symbolic links are reported, but never descended into
+    EXPECT_NE(std::ranges::find(paths, String(Layout->LinkToA)), paths.end());
+}
+
+TEST_F(ParallelWalkDirTest, FailsForMissingDirectory)
+{
+    auto parallel = ParallelWalkDir(Layout->Root.Path().Join("does-not-exist"), 2);
+    EXPECT_FALSE(parallel) << "walking a non-existent directory must fail";
+}
+
+TEST_F(ParallelWalkDirTest, StopTraversingHalts)
+{
+    auto parallel = ParallelWalkDir(this->Wide(16), 2);
+    ASSERT_TRUE(parallel) << parallel.Error();
+
+    ASSERT_TRUE(parallel->Next().HasValue());
+    parallel->StopTraversing();
+
+    EXPECT_FALSE(parallel->Next().HasValue());
+}
+
+TEST_F(ParallelWalkDirTest, CancellationStopsTheWalk)
+{
+    CancellationTokenSource cts;
+    cts.Cancel();
+
+    auto parallel = ParallelWalkDir(this->Wide(16), 2, { .Cancellation = cts.Token() });
+    ASSERT_TRUE(parallel) << parallel.Error();
+
+    EXPECT_FALSE(parallel->Next().HasValue()) << "a cancelled walk must not yield anything";
+}
+
+// NOLINTEND(google-build-using-namespace)
@@ -0,0 +1,228 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "tests/filesystem/support/Layout.h"
+
+#include <violet/Experimental/Threading/CancellationToken.h>
+#include <violet/Filesystem.h>
+#include <violet/Filesystem/Experimental/Tree.h>
+#include <violet/Filesystem/Extensions/XAttr.h>
+#include <violet/Filesystem/File.h>
+
+#include <atomic>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet;
+using namespace violet::filesystem;
+using namespace violet::filesystem::experimental;
+using namespace violet::filesystem::testing;
+
+using violet::experimental::threading::CancellationTokenSource;
+
+namespace {
+
+struct TreeTest: public LayoutFixture {
+protected:
+    /// Builds `width` directories under `<root>/wide`, each holding `width` files and one more
+    /// directory level.
+    auto Wide(UInt width) -> Path
+    {
+        const Path wide = Layout->Root.Path().Join("wide");
+        EXPECT_TRUE(CreateDirectory(wide));
+
+        for (UInt i = 0; i < width; i++) {
+            const Path dir = wide.Join(violet::ToString(i));
+            EXPECT_TRUE(CreateDirectories(dir.Join("inner")));
+
+            for (UInt j = 0; j < width; j++) {
+                EXPECT_TRUE(CreateFile(dir.Join(violet::ToString(j))));
+            }
+        }
+
+        return wide;
+    }
+};
+
+auto readAll(PathRef path) -> String
+{
+    auto file = File::Open(path, OpenOptions{ }.Read());
+    EXPECT_TRUE(file) << file.Error();
+    if (file.Err()) {
+        return { };
+    }
+
+    String contents;
+    Array<UInt8, 4096> buf{ };
+    while (true) {
+        auto read = file->Read(buf);
+        EXPECT_TRUE(read) << read.Error();
+        if (read.Err() || *read == 0) {
+            break;
+        }
+
+        contents.append(reinterpret_cast<const char*>(buf.data()), *read);
+    }
+
+    return contents;
+}
+
+auto statOf(PathRef path) -> struct stat
+{
+    struct stat st{ };
+    EXPECT_TRUE(path.WithCStr([&](CStr path) -> bool { return ::lstat(path, &st) == 0; }));
+
+    return st;
+}
+
+} // namespace
+
+TEST_F(TreeTest, CopyTreeCopiesTheLayout)
+{
+    const Path dst = Layout->Root.Path().Join("copy");
+    auto copied = CopyTree(Layout->Root.Path(), dst, { .Threads = 4 });
+
+    // copying the root into itself must skip the copy we're creating
+    ASSERT_TRUE(copied) << copied.Error();
+    EXPECT_EQ(copied->Directories, 4);
+    EXPECT_EQ(copied->Files, 8);
+    EXPECT_EQ(readAll(dst.Join("a.txt")), "hello");
+    EXPECT_EQ(readAll(dst.Join("nested/c.txt")), "cee");
+    EXPECT_EQ(readAll(dst.Join("nested/loveletter.txt")), readAll(Layout->Nested.LoveLetter));
+    EXPECT_EQ(readAll(dst.Join("hardlink-to-a")), "hello");
+    EXPECT_TRUE(Exists(dst.Join("nested/deeper/d.txt")));
+    EXPECT_TRUE(Exists(dst.Join("empty")));
+    EXPECT_FALSE(Exists(dst.Join("copy")));
+
+    auto link = statOf(dst.Join("link-to-a"));
+    EXPECT_TRUE(S_ISLNK(link.st_mode));
+
+    auto dangling = statOf(dst.Join("dangling"));
+    EXPECT_TRUE(S_ISLNK(dangling.st_mode));
+
+    // hard links become separate files
+    EXPECT_NE(statOf(dst.Join("a.txt")).st_ino, statOf(dst.Join("hardlink-to-a")).st_ino);
+}
+
+TEST_F(TreeTest, CopyTreePreservesMetadata)
+{
+    ASSERT_TRUE(Layout->A.WithCStr([](CStr path) -> bool {
+        const Array<struct timespec, 2> times = { { { .tv_sec = 1000000000, .tv_nsec = 0 },
+            { .tv_sec = 1000000000, .tv_nsec = 0 } } };
+
+        return ::chmod(path, 0640) == 0 && ::utimensat(AT_FDCWD, path, times.data(), 0) == 0;
+    }));
+
+    ASSERT_TRUE(Layout->Nested.Deeper.Path.WithCStr([](CStr path) -> bool { return ::chmod(path, 0555) == 0; }));
+
+    const Path dst = Layout->Root.Path().Join("copy");
+    auto copied = CopyTree(Layout->Root.Path(), dst, { .PreserveMetadata = true });
+    ASSERT_TRUE(copied) << copied.Error();
+
+    auto a = statOf(dst.Join("a.txt"));
+    EXPECT_EQ(a.st_mode & 07777, 0640);
+    EXPECT_EQ(a.st_mtime, 1000000000);
+
+    // read-only directories are only made read-only after they were filled in
+    EXPECT_EQ(statOf(dst.Join("nested/deeper")).st_mode & 07777, 0555);
+    EXPECT_TRUE(Exists(dst.Join("nested/deeper/d.txt")));
+
+    for (const Path& dir: { Layout->Nested.Deeper.Path, dst.Join("nested/deeper") }) {
+        EXPECT_TRUE(dir.WithCStr([](CStr path) -> bool { return ::chmod(path, 0755) == 0; }));
+    }
+}
+
+TEST_F(TreeTest, CopyTreePreservesXAttrs)
+{
+    const Array<UInt8, 3> value = { 'v', 'i', 'o' };
+    {
+        auto file = File::Open(Layout->A, OpenOptions{ }.Read());
+        ASSERT_TRUE(file) << file.Error();
+        if (auto res = xattr::Set(file->Descriptor(), "user.violet", value); res.Err()) {
+            GTEST_SKIP() << "filesystem doesn't support user xattrs: " << res.Error();
+        }
+    }
+
+    const Path dst = Layout->Root.Path().Join("copy");
+    auto copied = CopyTree(Layout->Root.Path(), dst, { .PreserveXAttrs = true });
+    ASSERT_TRUE(copied) << copied.Error();
+
+    auto file = File::Open(dst.Join("a.txt"), OpenOptions{ }.Read());
+    ASSERT_TRUE(file) << file.Error();
+
+    auto got = xattr::Get(file->Descriptor(), "user.violet");
+    ASSERT_TRUE(got) << got.Error();
+    ASSERT_TRUE(got->HasValue());
+    EXPECT_EQ(got->Value(), Vec<UInt8>(value.begin(), value.end()));
+}
+
+TEST_F(TreeTest, CopyTreeFailsIfTheDestinationExists)
+{
+    auto copied = CopyTree(Layout->Nested.Path, Layout->Empty);
+    ASSERT_FALSE(copied);
+    EXPECT_EQ(copied.Error().Kind(), io::ErrorKind::AlreadyExists);
+}
+
+TEST_F(TreeTest, RemoveAllDirsRemovesAWideTree)
+{
+    const Path wide = this->Wide(32);
+
+    std::atomic<UInt> calls = 0;
+    auto removed = RemoveAllDirs(wide, {
+        .Threads = 4,
+        .Progress = [&](const TreeProgress&) -> void { calls++; },
+    });
+
+    ASSERT_TRUE(removed) << removed.Error();
+    EXPECT_EQ(removed->Files, 32 * 32);
+    EXPECT_EQ(removed->Directories, 1 + (32 * 2));
+    EXPECT_EQ(removed->Bytes, 0);
+    EXPECT_GE(calls.load(), 1);
+    EXPECT_FALSE(Exists(wide));
+}
+
+TEST_F(TreeTest, RemoveAllDirsDoesNotFollowSymlinks)
+{
+    auto removed = RemoveAllDirs(Layout->LinkToA, { });
+    ASSERT_FALSE(removed);
+    EXPECT_TRUE(Exists(Layout->A));
+}
+
+TEST_F(TreeTest, StopsOnCancellation)
+{
+    CancellationTokenSource cts;
+    cts.Cancel();
+
+    const Path wide = this->Wide(8);
+    auto removed = RemoveAllDirs(wide, { .Cancellation = cts.Token() });
+    ASSERT_FALSE(removed);
+    EXPECT_EQ(removed.Error().Kind(), io::ErrorKind::Interrupted);
+    EXPECT_TRUE(Exists(wide));
+
+    auto copied = CopyTree(wide, Layout->Root.Path().Join("copy"), { .Cancellation = cts.Token() });
+    ASSERT_FALSE(copied);
+    EXPECT_EQ(copied.Error().Kind(), io::ErrorKind::Interrupted);
+}
+
+// NOLINTEND(google-build-using-namespace)
@@ -22,6 +22,10 @@
 #include "tests/filesystem/support/Layout.h"
 
 #include <violet/Filesystem.h>
+#include <violet/Filesystem/File.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
 
 // NOLINTBEGIN(google-build-using-namespace)
 using namespace violet;
@@ -42,6 +46,51 @@ TEST_F(FilesystemUnixTest, CopyMissingSourceErrors)
     EXPECT_EQ(raw.Value(), ENOENT);
 }
 
+TEST_F(FilesystemUnixTest, CopyKeepsSparseFilesSparse)
+{
+    constexpr UInt64 kSize = 16 * 1024 * 1024;
+    const Path source = Layout->Root.Path().Join("sparse");
+    const Path destination = Layout->Root.Path().Join("sparse.copy");
+
+    {
+        auto file = OpenOptions{ }.Create().Write().Open(source);
+        ASSERT_TRUE(file) << file.Error();
+
+        const Array<UInt8, 4> head = { 'h', 'e', 'a', 'd' };
+        const Array<UInt8, 4> tail = { 't', 'a', 'i', 'l' };
+        ASSERT_TRUE(file->WriteAt(head, 0));
+        ASSERT_TRUE(file->WriteAt(tail, kSize / 2));
+        ASSERT_EQ(::ftruncate(file->Descriptor(), kSize), 0) << "the file should end with a hole";
+    }
+
+    auto bytes = Copy(source, destination);
+    ASSERT_TRUE(bytes) << bytes.Error();
+    EXPECT_EQ(*bytes, kSize);
+
+    auto copy = OpenOptions{ }.Read().Open(destination);
+    ASSERT_TRUE(copy) << copy.Error();
+
+    Array<UInt8, 4> buf{ };
+    ASSERT_TRUE(copy->ReadAt(buf, 0));
+    EXPECT_EQ(String(buf.begin(), buf.end()), "head");
+    ASSERT_TRUE(copy->ReadAt(buf, kSize / 2));
+    EXPECT_EQ(String(buf.begin(), buf.end()), "tail");
+    ASSERT_TRUE(copy->ReadAt(buf, kSize / 4));
+    EXPECT_EQ(buf, (Array<UInt8, 4>{ }));
+
+    struct stat original{};
+    struct stat copied{};
+    source.WithCStr([&](CStr path) -> void { ::stat(path, &original); });
+    destination.WithCStr([&](CStr path) -> void { ::stat(path, &copied); });
+
+    EXPECT_EQ(copied.st_size, static_cast<off_t>(kSize));
+#if VIOLET_PLATFORM(LINUX)
+    if (original.st_blocks * 512 < static_cast<off_t>(kSize)) {
+        EXPECT_LT(copied.st_blocks * 512, static_cast<off_t>(kSize)) << "the holes of the source were filled in";
+    }
+#endif
+}
+
 TEST_F(FilesystemUnixTest, CreateDirectoryOnExistingPathReturnsEEXIST)
 {
     auto result = CreateDirectory(Layout->Empty);
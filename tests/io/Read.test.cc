@@ -59,3 +59,76 @@ TEST(Reads, ReadToString)
     ASSERT_TRUE(result);
     EXPECT_EQ(result.Value(), "Hello");
 }
+
+TEST(Reads, VecIsShiftedDown)
+{
+    Vec<UInt8> data = { 'A', 'B', 'C' };
+    Array<UInt8, 2> buf;
+
+    auto result = io::Read(data, buf);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.Value(), 2);
+    EXPECT_EQ(data, Vec<UInt8>({ 'C' }));
+
+    result = io::Read(data, buf);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.Value(), 1);
+    EXPECT_TRUE(data.empty());
+}
+
+TEST(ByteCursor, ReadsFrontToBack)
+{
+    const Vec<UInt8> data = { 'H', 'e', 'l', 'l', 'o' };
+    ByteCursor cursor(data);
+
+    Array<UInt8, 2> buf;
+    auto result = io::Read(cursor, buf);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.Value(), 2);
+    EXPECT_EQ(buf[0], 'H');
+    EXPECT_EQ(cursor.Position(), 2);
+
+    cursor.Consume(1);
+    EXPECT_EQ(cursor.Remaining().size(), 2);
+    EXPECT_EQ(cursor.Remaining()[0], 'l');
+
+    auto rest = io::ReadToString(cursor);
+    ASSERT_TRUE(rest);
+    EXPECT_EQ(rest.Value(), "lo");
+    EXPECT_TRUE(cursor.EOS());
+
+    cursor.SetPosition(100);
+    EXPECT_EQ(cursor.Position(), data.size());
+
+    result = cursor.Read(buf);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.Value(), 0);
+}
+
+TEST(ByteQueue, ReadsAcrossChunks)
+{
+    ByteQueue queue;
+    queue.Push(Vec<UInt8>{ 'a', 'b', 'c' });
+    queue.Push(Vec<UInt8>{ });
+    queue.Push(Vec<UInt8>{ 'd', 'e' });
+    EXPECT_EQ(queue.Size(), 5);
+
+    Array<UInt8, 4> buf;
+    auto result = io::Read(queue, buf);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result.Value(), 4);
+    EXPECT_EQ(String(buf.begin(), buf.end()), "abcd");
+    EXPECT_EQ(queue.Size(), 1);
+    EXPECT_EQ(queue.Front().size(), 1);
+    EXPECT_EQ(queue.Front()[0], 'e');
+
+    const UInt8 more[] = { 'f', 'g' }; // NOLINT(modernize-avoid-c-arrays)
+    queue.Push(more);
+    queue.Consume(2);
+    EXPECT_EQ(queue.Size(), 1);
+
+    auto rest = io::ReadToBytes(queue);
+    ASSERT_TRUE(rest);
+    EXPECT_EQ(rest.Value(), Vec<UInt8>({ 'g' }));
+    EXPECT_TRUE(queue.Empty());
+}
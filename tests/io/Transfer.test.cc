@@ -0,0 +1,153 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <gtest/gtest.h>
+#include <violet/Filesystem/File.h>
+#include <violet/Filesystem/Temporary.h>
+#include <violet/IO/Transfer.h>
+
+#include <thread>
+#include <unistd.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet;
+using namespace violet::filesystem;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+auto pattern(UInt size) -> Vec<UInt8>
+{
+    Vec<UInt8> data(size);
+    for (UInt i = 0; i < size; i++) {
+        data[i] = static_cast<UInt8>(i % 251);
+    }
+
+    return data;
+}
+
+auto contentsOf(const File& file, UInt size) -> Vec<UInt8>
+{
+    Vec<UInt8> data(size + 1);
+    auto read = file.ReadAt(data, 0);
+    EXPECT_TRUE(read) << read.Error();
+
+    data.resize(read.Ok() ? read.Value() : 0);
+    return data;
+}
+
+} // namespace
+
+TEST(Transfer, FileToFile)
+{
+    auto src = TempBuilder{ }.MkFile();
+    auto dst = TempBuilder{ }.MkFile();
+    ASSERT_TRUE(src && dst);
+
+    auto data = pattern(300 * 1024);
+    ASSERT_TRUE(src->File().Write(data));
+
+    auto reader = OpenOptions{ }.Read().Open(src->Path().Unwrap());
+    ASSERT_TRUE(reader) << reader.Error();
+
+    auto moved = io::Transfer(reader->Descriptor(), dst->File().Descriptor(), 1000);
+    ASSERT_TRUE(moved) << moved.Error();
+    EXPECT_EQ(*moved, 1000U);
+
+    moved = io::Transfer(reader->Descriptor(), dst->File().Descriptor());
+    ASSERT_TRUE(moved) << moved.Error();
+    EXPECT_EQ(*moved, data.size() - 1000) << "the rest must be moved once `src` runs dry";
+    EXPECT_EQ(contentsOf(dst->File(), data.size()), data);
+
+    moved = io::Transfer(reader->Descriptor(), dst->File().Descriptor());
+    ASSERT_TRUE(moved) << moved.Error();
+    EXPECT_EQ(*moved, 0U);
+}
+
+TEST(Transfer, PipeToAppendOnlyFile)
+{
+    auto dst = TempBuilder{ }.MkFile();
+    ASSERT_TRUE(dst);
+
+    // `splice(2)` refuses `O_APPEND` descriptors, so this exercises the fallback as well
+    auto appender = OpenOptions{ }.Write().Append().Open(dst->Path().Unwrap());
+    ASSERT_TRUE(appender) << appender.Error();
+
+    Int32 fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    io::FileDescriptor reader(fds[0]);
+    io::FileDescriptor writer(fds[1]);
+
+    auto data = pattern(512 * 1024);
+    std::thread producer([&]() -> void {
+        EXPECT_TRUE(writer.Write(data));
+        writer.Close();
+    });
+
+    auto moved = io::Transfer(reader.Get(), appender->Descriptor());
+    producer.join();
+
+    ASSERT_TRUE(moved) << moved.Error();
+    EXPECT_EQ(*moved, data.size());
+    EXPECT_EQ(contentsOf(dst->File(), data.size()), data);
+}
+
+TEST(Transfer, InvalidDescriptorFails)
+{
+    auto dst = TempBuilder{ }.MkFile();
+    ASSERT_TRUE(dst);
+
+    EXPECT_FALSE(io::Transfer(-1, dst->File().Descriptor()));
+}
+
+TEST(Tee, DuplicatesWithoutConsuming)
+{
+#if !VIOLET_PLATFORM(LINUX)
+    GTEST_SKIP() << "`tee(2)` is only available on Linux";
+#endif
+
+    Int32 first[2];
+    Int32 second[2];
+    ASSERT_EQ(::pipe(first), 0);
+    ASSERT_EQ(::pipe(second), 0);
+
+    io::FileDescriptor firstReader(first[0]);
+    io::FileDescriptor firstWriter(first[1]);
+    io::FileDescriptor secondReader(second[0]);
+    io::FileDescriptor secondWriter(second[1]);
+
+    const Array<UInt8, 5> hello = { 'h', 'e', 'l', 'l', 'o' };
+    ASSERT_TRUE(firstWriter.Write(hello));
+
+    auto duplicated = io::Tee(firstReader, secondWriter);
+    ASSERT_TRUE(duplicated) << duplicated.Error();
+    EXPECT_EQ(*duplicated, hello.size());
+
+    Array<UInt8, 5> buf{ };
+    ASSERT_TRUE(secondReader.Read(buf));
+    EXPECT_EQ(buf, hello);
+
+    buf = { };
+    ASSERT_TRUE(firstReader.Read(buf));
+    EXPECT_EQ(buf, hello) << "the source pipe must still hold the data";
+}
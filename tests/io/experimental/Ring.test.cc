@@ -0,0 +1,179 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <gtest/gtest.h>
+#include <violet/Filesystem/Temporary.h>
+#include <violet/IO/Experimental/Ring.h>
+
+#include <unordered_set>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::io::experimental;
+using namespace violet::filesystem;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+namespace {
+
+constexpr UInt kBlockSize = 4096;
+
+/// Waits until `count` completions were reaped, asserting that every one of them succeeded.
+void drain(Ring& ring, UInt count, std::unordered_set<UInt64>* seen = nullptr)
+{
+    Array<Completion, 8> done;
+    while (count > 0) {
+        auto reaped = ring.Wait(done);
+        ASSERT_TRUE(reaped) << "failed to wait on completions: " << reaped.Error();
+        ASSERT_GT(reaped.Value(), 0U);
+
+        for (UInt i = 0; i < reaped.Value(); i++) {
+            auto result = done[i].Result();
+            ASSERT_TRUE(result) << "operation " << done[i].UserData << " failed: " << result.Error();
+            EXPECT_EQ(result.Value(), kBlockSize);
+
+            if (seen != nullptr) {
+                seen->insert(done[i].UserData);
+            }
+        }
+
+        count -= reaped.Value();
+    }
+}
+
+auto openScratch(const TempDir& dir) -> io::Result<File>
+{
+    return OpenOptions{ }.Read().Write().Create().Truncate().Open(dir.Path().Join("shard.bin"));
+}
+
+} // namespace
+
+TEST(Ring, WritesAndReadsBackAtOffsets)
+{
+    auto tempdir = TempBuilder{ }.MkDir();
+    ASSERT_TRUE(tempdir) << "failed to create temporary directory: " << tempdir.Error();
+
+    auto file = openScratch(*tempdir);
+    ASSERT_TRUE(file) << file.Error();
+
+    auto ring = Ring::New({ .Entries = 8 });
+    ASSERT_TRUE(ring) << "failed to create ring: " << ring.Error();
+
+    constexpr UInt kBlocks = 16;
+
+    // queued in reverse, so that the offsets (not the order) decide where every block ends up
+    Vec<Vec<UInt8>> blocks;
+    for (UInt i = 0; i < kBlocks; i++) {
+        blocks.emplace_back(kBlockSize, static_cast<UInt8>(i + 1));
+    }
+
+    for (UInt i = kBlocks; i-- > 0;) {
+        ASSERT_TRUE(ring->WriteAt(*file, blocks[i], i * kBlockSize, i));
+    }
+
+    std::unordered_set<UInt64> seen;
+    drain(*ring, kBlocks, &seen);
+    EXPECT_EQ(seen.size(), kBlocks);
+    EXPECT_EQ(ring->InFlight(), 0U);
+
+    Vec<Vec<UInt8>> readback(kBlocks, Vec<UInt8>(kBlockSize));
+    for (UInt i = 0; i < kBlocks; i++) {
+        ASSERT_TRUE(ring->ReadAt(*file, readback[i], i * kBlockSize, i));
+    }
+
+    EXPECT_EQ(ring->Queued(), kBlocks - 8) << "the first 8 reads had to be submitted to make room";
+    drain(*ring, kBlocks);
+
+    for (UInt i = 0; i < kBlocks; i++) {
+        EXPECT_EQ(readback[i], blocks[i]) << "block " << i << " doesn't match";
+    }
+}
+
+TEST(Ring, RegisteredFilesAndBuffers)
+{
+    auto tempdir = TempBuilder{ }.MkDir();
+    ASSERT_TRUE(tempdir) << "failed to create temporary directory: " << tempdir.Error();
+
+    auto file = openScratch(*tempdir);
+    ASSERT_TRUE(file) << file.Error();
+
+    auto ring = Ring::New();
+    ASSERT_TRUE(ring) << "failed to create ring: " << ring.Error();
+
+    Vec<UInt8> arena(2 * kBlockSize, 0);
+    std::fill_n(arena.begin(), kBlockSize, 0x7F);
+
+    const Array<Span<UInt8>, 1> buffers{ Span<UInt8>(arena) };
+    ASSERT_TRUE(ring->RegisterBuffers(buffers));
+
+    const Array<io::FileDescriptor::value_type, 1> files{ file->Descriptor() };
+    ASSERT_TRUE(ring->RegisterFiles(files));
+
+    auto first = Span<UInt8>(arena).first(kBlockSize);
+    auto second = Span<UInt8>(arena).subspan(kBlockSize);
+
+    ASSERT_TRUE(ring->WriteFixed(RingFile::Fixed(0), first, 0, /*index=*/0, /*userData=*/1));
+    drain(*ring, 1);
+
+    ASSERT_TRUE(ring->ReadFixed(RingFile::Fixed(0), second, 0, /*index=*/0, /*userData=*/2));
+    drain(*ring, 1);
+
+    EXPECT_TRUE(std::ranges::equal(first, second));
+
+    // memory outside of the registered buffer can't be used with the fixed operations
+    Vec<UInt8> foreign(kBlockSize);
+    auto rejected = ring->ReadFixed(RingFile::Fixed(0), foreign, 0, 0, 3);
+    ASSERT_FALSE(rejected);
+    EXPECT_EQ(rejected.Error().Kind(), io::ErrorKind::InvalidInput);
+
+    EXPECT_TRUE(ring->UnregisterFiles());
+    EXPECT_TRUE(ring->UnregisterBuffers());
+}
+
+TEST(Ring, FailedOperationsReportTheirError)
+{
+    auto ring = Ring::New();
+    ASSERT_TRUE(ring) << "failed to create ring: " << ring.Error();
+
+    Vec<UInt8> buf(kBlockSize);
+    ASSERT_TRUE(ring->ReadAt(/*fd=*/-1, buf, 0, 42));
+
+    Array<Completion, 1> done;
+    auto reaped = ring->Wait(done);
+    ASSERT_TRUE(reaped) << reaped.Error();
+    ASSERT_EQ(reaped.Value(), 1U);
+
+    EXPECT_EQ(done[0].UserData, 42U);
+    EXPECT_FALSE(done[0].Result()) << "reading from an invalid descriptor must fail";
+}
+
+TEST(Ring, WaitReturnsWithNothingInFlight)
+{
+    auto ring = Ring::New();
+    ASSERT_TRUE(ring) << "failed to create ring: " << ring.Error();
+
+    Array<Completion, 4> done;
+    EXPECT_EQ(ring->Poll(done), 0U);
+
+    auto reaped = ring->Wait(done, 1, std::chrono::milliseconds(10));
+    ASSERT_TRUE(reaped) << reaped.Error();
+    EXPECT_EQ(reaped.Value(), 0U);
+}
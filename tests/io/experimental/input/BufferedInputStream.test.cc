@@ -45,4 +45,167 @@ TEST(BufferedInputStream, ItWorks)
     EXPECT_EQ(out, buf);
 }
 
-// TODO(@auguwu/Noel): add more tests here for correctness
+namespace {
+
+/// Serves `Size` zero bytes and records the size of every read it sees; fails every read
+/// once `FailAfter` reads were served.
+struct RecordingInputStream final: public InputStream {
+    UInt Size = 0;
+    UInt FailAfter = static_cast<UInt>(-1);
+    SharedPtr<Vec<UInt>> Reads = std::make_shared<Vec<UInt>>();
+
+    auto Read(Span<UInt8> buf) noexcept -> io::Result<UInt> override
+    {
+        if (this->Reads->size() >= this->FailAfter) {
+            return Err(VIOLET_IO_ERROR(Other, String, "injected failure"));
+        }
+
+        this->Reads->push_back(buf.size());
+
+        const UInt bytes = std::min(buf.size(), this->Size - this->n_pos);
+        std::fill_n(buf.data(), bytes, 0);
+        this->n_pos += bytes;
+
+        return bytes;
+    }
+
+    [[nodiscard]] auto Available() const noexcept -> io::Result<UInt> override
+    {
+        return this->Size - this->n_pos;
+    }
+
+    auto Skip(UInt) noexcept -> io::Result<void> override
+    {
+        return {};
+    }
+
+private:
+    UInt n_pos = 0;
+};
+
+} // namespace
+
+TEST(BufferedInputStream, LargeReadsBypassTheBuffer)
+{
+    RecordingInputStream src;
+    src.Size = 4096;
+    auto reads = src.Reads;
+
+    BufferedInputStream stream(src, 128);
+
+    Vec<UInt8> out(1024);
+    auto res = stream.Read(out);
+    ASSERT_TRUE(res) << "failed to call 'stream.Read()': " << VIOLET_MOVE(res.Error()).ToString();
+    EXPECT_EQ(res.Value(), 1024);
+
+    ASSERT_EQ(reads->size(), 1) << "a read larger than the buffer must go straight to the source";
+    EXPECT_EQ((*reads)[0], 1024);
+}
+
+TEST(BufferedInputStream, GrowsUnderSequentialReads)
+{
+    RecordingInputStream src;
+    src.Size = 64 * 1024;
+    auto reads = src.Reads;
+
+    BufferedInputStream stream(src, 128);
+
+    Array<UInt8, 16> out{ };
+    while (stream.Read(out).UnwrapOr(0) > 0) { }
+
+    ASSERT_FALSE(reads->empty());
+    EXPECT_EQ(reads->front(), 128);
+    EXPECT_GT(reads->back(), 128) << "the buffer must grow when the source keeps filling it";
+}
+
+TEST(BufferedInputStream, PropagatesSourceErrors)
+{
+    RecordingInputStream src;
+    src.Size = 4096;
+    src.FailAfter = 1;
+
+    BufferedInputStream stream(src, 128);
+
+    Array<UInt8, 16> out{ };
+    for (UInt i = 0; i < 8; i++) {
+        auto res = stream.Read(out);
+        ASSERT_TRUE(res) << "the first buffer's worth must still be served";
+        ASSERT_EQ(res.Value(), out.size());
+    }
+
+    auto res = stream.Read(out);
+    EXPECT_FALSE(res) << "a failing source must not look like end-of-stream";
+
+    auto buf = stream.FillBuf();
+    EXPECT_FALSE(buf);
+}
+
+TEST(BufferedInputStream, FillBufAndConsume)
+{
+    const Str data = "hello, world";
+    ByteArrayInputStream bas(Span<const UInt8>(reinterpret_cast<const UInt8*>(data.data()), data.size()));
+    BufferedInputStream stream(bas, 8);
+
+    auto buf = stream.FillBuf();
+    ASSERT_TRUE(buf) << "failed to call 'stream.FillBuf()': " << VIOLET_MOVE(buf.Error()).ToString();
+    ASSERT_EQ(buf->size(), 8);
+    EXPECT_EQ(Str(reinterpret_cast<const char*>(buf->data()), buf->size()), "hello, w");
+
+    // Nothing was consumed, so the same bytes come back.
+    auto again = stream.FillBuf();
+    ASSERT_TRUE(again);
+    EXPECT_EQ(again->data(), buf->data());
+
+    stream.Consume(7);
+
+    Array<UInt8, 5> out{ };
+    auto res = stream.Read(out);
+    ASSERT_TRUE(res);
+    ASSERT_EQ(res.Value(), 5);
+    EXPECT_EQ(Str(reinterpret_cast<const char*>(out.data()), out.size()), "world");
+
+    auto eof = stream.FillBuf();
+    ASSERT_TRUE(eof);
+    EXPECT_TRUE(eof->empty());
+}
+
+TEST(BufferedInputStream, ReadLineAcrossBufferBoundaries)
+{
+    // A tiny buffer, so that lines straddle refills and the long one has to grow it.
+    const Str data = "one\ntwo\r\n\nthis line is longer than the buffer\nlast";
+    ByteArrayInputStream bas(Span<const UInt8>(reinterpret_cast<const UInt8*>(data.data()), data.size()));
+    BufferedInputStream stream(bas, 5);
+
+    Vec<String> lines;
+    while (true) {
+        auto line = stream.ReadLine();
+        ASSERT_TRUE(line) << "failed to call 'stream.ReadLine()': " << VIOLET_MOVE(line.Error()).ToString();
+        if (!line->HasValue()) {
+            break;
+        }
+
+        lines.emplace_back(line->Value());
+    }
+
+    const Vec<String> expected = { "one", "two", "", "this line is longer than the buffer", "last" };
+    EXPECT_EQ(lines, expected);
+}
+
+TEST(BufferedInputStream, ReadUntilKeepsTheDelimiter)
+{
+    const Str data = "a,bc,";
+    ByteArrayInputStream bas(Span<const UInt8>(reinterpret_cast<const UInt8*>(data.data()), data.size()));
+    BufferedInputStream stream(bas, 2);
+
+    auto first = stream.ReadUntil(',');
+    ASSERT_TRUE(first);
+    EXPECT_EQ(Str(reinterpret_cast<const char*>(first->data()), first->size()), "a,");
+
+    auto second = stream.ReadUntil(',');
+    ASSERT_TRUE(second);
+    EXPECT_EQ(Str(reinterpret_cast<const char*>(second->data()), second->size()), "bc,");
+
+    auto eof = stream.ReadUntil(',');
+    ASSERT_TRUE(eof);
+    EXPECT_TRUE(eof->empty());
+}
@@ -0,0 +1,90 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <gtest/gtest.h>
+#include <violet/IO/Experimental/Input/MmapInputStream.h>
+#include <violet/Testing/Runfiles.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::testing;
+using namespace violet::io::experimental;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+constexpr static auto kLoveLetterFile = "tests/io/experimental/input/runfiles/loveletter.txt";
+
+TEST(MmapInputStream, ItWorks)
+{
+    auto runfile = runfiles::Get(kLoveLetterFile);
+    ASSERT_TRUE(runfile) << "runfile '" << kLoveLetterFile << "' was not avaliable";
+
+    auto stream = MmapInputStream::Open(Str(*runfile));
+    ASSERT_TRUE(stream) << "failed to map file [" << *runfile << "]: " << VIOLET_MOVE(stream.Error()).ToString();
+
+    Vec<UInt8> buf(12);
+    auto res = stream->Read(buf);
+    ASSERT_TRUE(res) << "failed to read 12 bytes in file [" << *runfile << "]: " << VIOLET_MOVE(res.Error()).ToString();
+    ASSERT_EQ(res.Value(), 12);
+    ASSERT_EQ(String(buf.begin(), buf.end()), "I love a Fox");
+    ASSERT_EQ(stream->Position(), 12);
+}
+
+TEST(MmapInputStream, ExposesTheWholeFile)
+{
+    auto runfile = runfiles::Get(kLoveLetterFile);
+    ASSERT_TRUE(runfile) << "runfile '" << kLoveLetterFile << "' was not avaliable";
+
+    auto stream = MmapInputStream::Open(Str(*runfile));
+    ASSERT_TRUE(stream) << "failed to map file [" << *runfile << "]: " << VIOLET_MOVE(stream.Error()).ToString();
+
+    const UInt size = stream->Data().size();
+    ASSERT_GT(size, 12);
+    ASSERT_EQ(stream->Available().Value(), size);
+
+    ASSERT_TRUE(stream->Skip(9));
+    ASSERT_EQ(stream->Remaining().size(), size - 9);
+    ASSERT_EQ(stream->Remaining()[0], 'F');
+    ASSERT_EQ(stream->Data().size(), size) << "`Data' must not shrink as the stream is read";
+
+    ASSERT_TRUE(stream->Skip(size));
+    ASSERT_TRUE(stream->EOS());
+
+    Array<UInt8, 4> buf{ };
+    auto res = stream->Read(buf);
+    ASSERT_TRUE(res);
+    ASSERT_EQ(res.Value(), 0);
+}
+
+TEST(MmapInputStream, ReadToStringTakesTheRemainingBytes)
+{
+    auto runfile = runfiles::Get(kLoveLetterFile);
+    ASSERT_TRUE(runfile) << "runfile '" << kLoveLetterFile << "' was not avaliable";
+
+    auto stream = MmapInputStream::Open(Str(*runfile));
+    ASSERT_TRUE(stream) << "failed to map file [" << *runfile << "]: " << VIOLET_MOVE(stream.Error()).ToString();
+    ASSERT_TRUE(stream->Skip(2));
+
+    auto contents = ReadToString(*stream);
+    ASSERT_TRUE(contents);
+    ASSERT_TRUE(contents->starts_with("love a Fox"));
+    ASSERT_TRUE(stream->EOS());
+}
@@ -23,6 +23,9 @@
 #include <violet/IO/Experimental/BufferedOutputStream.h>
 #include <violet/IO/Experimental/Output/ByteArrayOutputStream.h>
 
+#include <algorithm>
+#include <cerrno>
+
 // NOLINTBEGIN(google-build-using-namespace)
 using namespace violet::io::experimental;
 using namespace violet;
@@ -91,3 +94,204 @@ TEST(BufferedOutputStream, MultipleWrites)
     EXPECT_EQ(baos->Get().size(), 8);
     EXPECT_EQ(std::string(baos->Get().begin(), baos->Get().end()), "abcdefgh");
 }
+
+namespace {
+
+struct CountingOutputStream final: public OutputStream {
+    Vec<UInt8> Data;
+    UInt Flushes = 0;
+    UInt Syncs = 0;
+    UInt Writes = 0;
+
+    /// Accept at most this many bytes per write, to exercise short writes.
+    UInt MaxPerWrite = static_cast<UInt>(-1);
+
+    /// Fail every write once this many bytes were accepted in total.
+    UInt Capacity = static_cast<UInt>(-1);
+
+    auto Write(Span<const UInt8> data) noexcept -> io::Result<UInt> override
+    {
+        if (this->Data.size() >= this->Capacity) {
+            return Err(io::Error::FromOSError(ENOSPC));
+        }
+
+        const UInt bytes = std::min({ data.size(), this->MaxPerWrite, this->Capacity - this->Data.size() });
+
+        this->Writes++;
+        this->Data.insert(this->Data.end(), data.begin(), data.begin() + static_cast<Int>(bytes));
+        return bytes;
+    }
+
+    auto WriteVectored(Span<const Span<const UInt8>> bufs) noexcept -> io::Result<UInt> override
+    {
+        if (this->Data.size() >= this->Capacity) {
+            return Err(io::Error::FromOSError(ENOSPC));
+        }
+
+        UInt written = 0;
+        for (const auto& buf: bufs) {
+            const UInt bytes
+                = std::min({ buf.size(), this->MaxPerWrite - written, this->Capacity - this->Data.size() });
+            this->Data.insert(this->Data.end(), buf.begin(), buf.begin() + static_cast<Int>(bytes));
+            written += bytes;
+        }
+
+        this->Writes++;
+        return written;
+    }
+
+    auto Flush() noexcept -> io::Result<void> override
+    {
+        this->Flushes++;
+        return { };
+    }
+
+    auto Sync() noexcept -> io::Result<void> override
+    {
+        this->Syncs++;
+        return { };
+    }
+};
+
+} // namespace
+
+TEST(BufferedOutputStream, FullBufferDoesNotFlushSource)
+{
+    auto counter = std::make_shared<CountingOutputStream>();
+    BufferedOutputStream bos(counter, 4);
+
+    Span<const UInt8> data(reinterpret_cast<const UInt8*>("abcdefghijkl"), 12);
+    ASSERT_TRUE(bos.Write(data));
+
+    EXPECT_EQ(counter->Data.size(), 12);
+    EXPECT_EQ(counter->Flushes, 0);
+    EXPECT_EQ(counter->Syncs, 0);
+
+    ASSERT_TRUE(bos.Flush());
+    EXPECT_EQ(counter->Flushes, 1);
+    EXPECT_EQ(counter->Syncs, 0);
+}
+
+TEST(BufferedOutputStream, SyncDrainsAndSyncsSource)
+{
+    auto counter = std::make_shared<CountingOutputStream>();
+    BufferedOutputStream bos(counter, 16);
+
+    Span<const UInt8> data(reinterpret_cast<const UInt8*>("abcd"), 4);
+    ASSERT_TRUE(bos.Write(data));
+    EXPECT_TRUE(counter->Data.empty());
+
+    ASSERT_TRUE(bos.Sync());
+    EXPECT_EQ(String(counter->Data.begin(), counter->Data.end()), "abcd");
+    EXPECT_EQ(counter->Syncs, 1);
+
+    // `SyncData` falls back to `Sync` for sinks that don't distinguish the two.
+    ASSERT_TRUE(bos.SyncData());
+    EXPECT_EQ(counter->Syncs, 2);
+}
+
+TEST(BufferedOutputStream, LargeWriteGoesStraightToTheSource)
+{
+    auto counter = std::make_shared<CountingOutputStream>();
+    BufferedOutputStream bos(counter, 4);
+
+    Span<const UInt8> small(reinterpret_cast<const UInt8*>("ab"), 2);
+    Span<const UInt8> large(reinterpret_cast<const UInt8*>("cdefghij"), 8);
+
+    ASSERT_TRUE(bos.Write(small));
+    EXPECT_EQ(counter->Writes, 0);
+
+    auto written = bos.Write(large);
+    ASSERT_TRUE(written) << "failed to write: " << written.Error();
+    EXPECT_EQ(written.Value(), 8);
+
+    EXPECT_EQ(counter->Writes, 1) << "the buffered and new bytes must reach the source in one vectored write";
+    EXPECT_EQ(String(counter->Data.begin(), counter->Data.end()), "abcdefghij");
+}
+
+TEST(BufferedOutputStream, ShortWritesAreRetried)
+{
+    auto counter = std::make_shared<CountingOutputStream>();
+    counter->MaxPerWrite = 3;
+
+    BufferedOutputStream bos(counter, 4);
+
+    Span<const UInt8> first(reinterpret_cast<const UInt8*>("abc"), 3);
+    Span<const UInt8> second(reinterpret_cast<const UInt8*>("defghijk"), 8);
+    Span<const UInt8> third(reinterpret_cast<const UInt8*>("lm"), 2);
+
+    ASSERT_TRUE(bos.Write(first));
+    ASSERT_TRUE(bos.Write(second));
+    ASSERT_TRUE(bos.Write(third));
+    ASSERT_TRUE(bos.Flush());
+
+    EXPECT_EQ(String(counter->Data.begin(), counter->Data.end()), "abcdefghijklm");
+}
+
+TEST(BufferedOutputStream, WriteVectored)
+{
+    auto counter = std::make_shared<CountingOutputStream>();
+    BufferedOutputStream bos(counter, 8);
+
+    Span<const UInt8> a(reinterpret_cast<const UInt8*>("ab"), 2);
+    Span<const UInt8> b(reinterpret_cast<const UInt8*>("cde"), 3);
+    Array<Span<const UInt8>, 2> small = { a, b };
+
+    auto written = bos.WriteVectored(small);
+    ASSERT_TRUE(written) << "failed to write: " << written.Error();
+    EXPECT_EQ(written.Value(), 5);
+    EXPECT_EQ(counter->Writes, 0) << "small vectored writes must be buffered";
+
+    Array<Span<const UInt8>, 3> large = { b, a, b };
+    ASSERT_TRUE(bos.WriteVectored(large));
+    EXPECT_EQ(counter->Writes, 1);
+
+    ASSERT_TRUE(bos.Flush());
+    EXPECT_EQ(String(counter->Data.begin(), counter->Data.end()), "abcdecdeabcde");
+}
+
+TEST(BufferedOutputStream, FailedWriteThroughReportsWhatWasWritten)
+{
+    auto counter = std::make_shared<CountingOutputStream>();
+    counter->MaxPerWrite = 3;
+    counter->Capacity = 6;
+
+    BufferedOutputStream bos(counter, 4);
+
+    Span<const UInt8> small(reinterpret_cast<const UInt8*>("ab"), 2);
+    Span<const UInt8> large(reinterpret_cast<const UInt8*>("cdefghij"), 8);
+
+    ASSERT_TRUE(bos.Write(small));
+
+    // `ab` and `cdef` make it before the source fills up, so only the error is deferred
+    auto written = bos.Write(large);
+    ASSERT_TRUE(written) << "failed to write: " << written.Error();
+    EXPECT_EQ(written.Value(), 4);
+    EXPECT_EQ(String(counter->Data.begin(), counter->Data.end()), "abcdef");
+
+    auto next = bos.Write(small);
+    ASSERT_FALSE(next) << "the deferred error should be returned by the next call";
+
+    auto code = next.Error().RawOSError();
+    ASSERT_TRUE(code);
+    EXPECT_EQ(*code, ENOSPC);
+    EXPECT_EQ(String(counter->Data.begin(), counter->Data.end()), "abcdef");
+}
+
+TEST(BufferedOutputStream, FailedWriteThroughWithoutProgressFails)
+{
+    auto counter = std::make_shared<CountingOutputStream>();
+    counter->Capacity = 0;
+
+    BufferedOutputStream bos(counter, 4);
+
+    Span<const UInt8> large(reinterpret_cast<const UInt8*>("abcdefgh"), 8);
+    auto written = bos.Write(large);
+    ASSERT_FALSE(written) << "nothing was written, so the error must not be deferred";
+
+    auto code = written.Error().RawOSError();
+    ASSERT_TRUE(code);
+    EXPECT_EQ(*code, ENOSPC);
+
+    ASSERT_TRUE(bos.Flush());
+}
@@ -0,0 +1,83 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <gtest/gtest.h>
+#include <violet/IO/Experimental/Output/ByteArrayOutputStream.h>
+#include <violet/IO/Experimental/Output/ChunkedOutputStream.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet::io::experimental;
+using namespace violet;
+// NOLINTEND(google-build-using-namespace)
+
+TEST(ChunkedOutputStream, SpillsIntoNewChunks)
+{
+    ChunkedOutputStream stream(4);
+
+    Span<const UInt8> data(reinterpret_cast<const UInt8*>("abcdefghij"), 10);
+    auto written = stream.Write(data);
+    ASSERT_TRUE(written) << "failed to write: " << written.Error();
+    EXPECT_EQ(written.Value(), 10);
+    EXPECT_EQ(stream.Size(), 10);
+
+    auto chunks = stream.Chunks();
+    ASSERT_EQ(chunks.size(), 3);
+    EXPECT_EQ(chunks[0].size(), 4);
+    EXPECT_EQ(chunks[1].size(), 4);
+    EXPECT_EQ(chunks[2].size(), 2);
+
+    auto flat = stream.Flatten();
+    EXPECT_EQ(String(flat.begin(), flat.end()), "abcdefghij");
+}
+
+TEST(ChunkedOutputStream, WriteVectoredFillsTheLastChunk)
+{
+    ChunkedOutputStream stream(8);
+
+    Span<const UInt8> a(reinterpret_cast<const UInt8*>("abc"), 3);
+    Span<const UInt8> b(reinterpret_cast<const UInt8*>("defg"), 4);
+    Array<Span<const UInt8>, 3> bufs = { a, b, a };
+
+    auto written = stream.WriteVectored(bufs);
+    ASSERT_TRUE(written) << "failed to write: " << written.Error();
+    EXPECT_EQ(written.Value(), 10);
+    EXPECT_EQ(stream.Chunks().size(), 2);
+
+    auto flat = stream.Flatten();
+    EXPECT_EQ(String(flat.begin(), flat.end()), "abcdefgabc");
+}
+
+TEST(ChunkedOutputStream, WriteToAnotherStream)
+{
+    ChunkedOutputStream stream(3);
+
+    Span<const UInt8> data(reinterpret_cast<const UInt8*>("hello, world"), 12);
+    ASSERT_TRUE(stream.Write(data));
+
+    ByteArrayOutputStream out;
+    ASSERT_TRUE(stream.WriteTo(out));
+    EXPECT_EQ(String(out.Get().begin(), out.Get().end()), "hello, world");
+
+    stream.Clear();
+    EXPECT_TRUE(stream.Empty());
+    EXPECT_TRUE(stream.Chunks().empty());
+}
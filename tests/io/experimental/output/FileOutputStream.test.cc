@@ -66,3 +66,30 @@ TEST(FileOutputStream, WriteAndFlush)
     String str(buf.begin(), buf.end());
     EXPECT_EQ(str, "filedata");
 }
+
+TEST(FileOutputStream, SyncAndWriteBehind)
+{
+    auto tempdir = TempBuilder{}.MkDir();
+    ASSERT_TRUE(tempdir) << "failed to create temporary directory: " << tempdir.Error();
+
+    auto path = tempdir->Path().Join("write-behind.bin");
+    auto fos = FileOutputStream::Open(path, WriteBehind{ .Window = 4096 });
+    ASSERT_TRUE(fos) << "failed to create tempfile [" << path << "]: " << fos.Error();
+
+    Vec<UInt8> chunk(1024, 0x5A);
+    for (Int32 i = 0; i < 32; i++) {
+        auto written = fos->Write(chunk);
+        ASSERT_TRUE(written) << "failed to write: " << written.Error();
+        EXPECT_EQ(written.Value(), chunk.size());
+    }
+
+    ASSERT_TRUE(fos->SyncData());
+    ASSERT_TRUE(fos->Sync());
+
+    auto file = File::Open(path, OpenOptions{}.Read());
+    ASSERT_TRUE(file) << "failed to open file [" << path << "]: " << file.Error();
+
+    auto metadata = file->Metadata();
+    ASSERT_TRUE(metadata) << "failed to get metadata of [" << path << "]: " << metadata.Error();
+    EXPECT_EQ(metadata->Size, 32 * 1024);
+}
@@ -0,0 +1,200 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Subprocess.h>
+
+#include <algorithm>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet;
+using namespace violet::subprocess;
+
+namespace {
+
+auto collect(ChildLines lines) -> Vec<Pair<ChildStream, String>>
+{
+    Vec<Pair<ChildStream, String>> out;
+    for (auto line: lines) {
+        EXPECT_TRUE(line) << "reading a line failed: " << line.Error();
+        if (line.Err()) {
+            break;
+        }
+
+        out.emplace_back(line->Stream, String(line->Data));
+    }
+
+    return out;
+}
+
+} // namespace
+
+TEST(ChildLines, YieldsEveryLineOfStdout)
+{
+    auto child = Command("printf").WithArg("one\\ntwo\\r\\n\\nthree").WithStdout(Stdio::Pipe()).Spawn();
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    auto lines = collect(child->StdoutLines());
+    EXPECT_FALSE(child->Stdout.HasValue()) << "the iterator should have taken over stdout";
+
+    ASSERT_EQ(lines.size(), 4);
+    EXPECT_EQ(lines[0].second, "one");
+    EXPECT_EQ(lines[1].second, "two");
+    EXPECT_EQ(lines[2].second, "");
+    EXPECT_EQ(lines[3].second, "three");
+
+    for (const auto& [stream, _]: lines) {
+        EXPECT_EQ(stream, ChildStream::Stdout);
+    }
+
+    auto status = child->Wait();
+    ASSERT_TRUE(status);
+    EXPECT_EQ(status->Code(), 0);
+}
+
+TEST(ChildLines, IsEmptyWhenTheStreamWasNotPiped)
+{
+    auto child = Command("true").Spawn();
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    EXPECT_TRUE(collect(child->StderrLines()).empty());
+    ASSERT_TRUE(child->Wait());
+}
+
+TEST(ChildLines, TakesTurnsBetweenStreams)
+{
+    auto child = Command("sh")
+                     .WithArgs({ "-c", "seq 1 50; seq 1 50 >&2" })
+                     .WithStdout(Stdio::Pipe())
+                     .WithStderr(Stdio::Pipe())
+                     .Spawn();
+
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    // everything fits into the pipes, so both streams have lines ready from the start
+    auto status = child->Wait();
+    ASSERT_TRUE(status);
+
+    auto lines = collect(child->Lines());
+    ASSERT_EQ(lines.size(), 100);
+
+    for (UInt i = 0; i < lines.size(); i++) {
+        EXPECT_EQ(lines[i].first, i % 2 == 0 ? ChildStream::Stdout : ChildStream::Stderr) << "line #" << i;
+        EXPECT_EQ(lines[i].second, violet::ToString((i / 2) + 1)) << "line #" << i;
+    }
+}
+
+TEST(ChildLines, DrainsBothStreamsWithoutStalling)
+{
+    // far more than a pipe holds, written to one stream after the other
+    auto child = Command("sh")
+                     .WithArgs({ "-c", "seq 1 50000 >&2; seq 1 50000" })
+                     .WithStdout(Stdio::Pipe())
+                     .WithStderr(Stdio::Pipe())
+                     .Spawn();
+
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    Array<UInt, 2> seen{ };
+    for (auto line: child->Lines()) {
+        ASSERT_TRUE(line) << "reading a line failed: " << line.Error();
+
+        auto& count = seen[line->Stream == ChildStream::Stdout ? 0 : 1];
+        ASSERT_EQ(line->Data, violet::ToString(++count));
+    }
+
+    EXPECT_EQ(seen[0], 50000);
+    EXPECT_EQ(seen[1], 50000);
+
+    auto status = child->Wait();
+    ASSERT_TRUE(status);
+    EXPECT_EQ(status->Code(), 0);
+}
+
+TEST(ChildLines, SplitsLinesLongerThanTheLimit)
+{
+    auto child = Command("sh")
+                     .WithArgs({ "-c", "head -c 10000 /dev/zero | tr '\\0' x; echo; echo done" })
+                     .WithStdout(Stdio::Pipe())
+                     .Spawn();
+
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    auto lines = collect(child->StdoutLines({ .MaxLineLength = 4096 }));
+    ASSERT_EQ(lines.size(), 4);
+    EXPECT_EQ(lines[0].second, String(4096, 'x'));
+    EXPECT_EQ(lines[1].second, String(4096, 'x'));
+    EXPECT_EQ(lines[2].second, String(1808, 'x'));
+    EXPECT_EQ(lines[3].second, "done");
+
+    ASSERT_TRUE(child->Wait());
+}
+
+TEST(ChildLines, TailKeepsOnlyTheLastLines)
+{
+    auto child = Command("seq").WithArgs({ "1", "100000" }).WithStdout(Stdio::Pipe()).Spawn();
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    // the last 20 bytes are "\n99998\n99999\n100000\n", which starts halfway into "99997"
+    auto lines = collect(child->StdoutLines({ .Tail = 20 }));
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_EQ(lines[0].second, "99998");
+    EXPECT_EQ(lines[1].second, "99999");
+    EXPECT_EQ(lines[2].second, "100000");
+
+    ASSERT_TRUE(child->Wait());
+}
+
+TEST(ChildLines, TailKeepsALineThatStartsTheWindow)
+{
+    auto child = Command("seq").WithArgs({ "1", "100000" }).WithStdout(Stdio::Pipe()).Spawn();
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    auto lines = collect(child->StdoutLines({ .Tail = 13 }));
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0].second, "99999");
+    EXPECT_EQ(lines[1].second, "100000");
+
+    ASSERT_TRUE(child->Wait());
+}
+
+TEST(ChildLines, TailsEachStreamOnItsOwn)
+{
+    auto child = Command("sh")
+                     .WithArgs({ "-c", "seq 1 1000; seq 1001 2000 >&2" })
+                     .WithStdout(Stdio::Pipe())
+                     .WithStderr(Stdio::Pipe())
+                     .Spawn();
+
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    // a stream's tail is yielded as soon as that stream is closed, whichever that is first
+    auto lines = collect(child->Lines({ .Tail = 5 }));
+    std::ranges::sort(lines);
+
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0], (Pair<ChildStream, String>{ ChildStream::Stdout, "1000" }));
+    EXPECT_EQ(lines[1], (Pair<ChildStream, String>{ ChildStream::Stderr, "2000" }));
+
+    ASSERT_TRUE(child->Wait());
+}
+
+// NOLINTEND(google-build-using-namespace)
@@ -0,0 +1,157 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Subprocess/PreparedCommand.h>
+#include <violet/Testing/Runfiles.h>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet;
+using namespace violet::subprocess;
+using namespace violet::testing;
+
+TEST(PreparedCommand, SubstitutesArgumentsBetweenSpawns)
+{
+    auto program = runfiles::Get("tests/subprocess/runfiles/print_args");
+    ASSERT_TRUE(program) << "runfile fetch for `tests/subprocess/runfiles/print_args` failed?!";
+
+    auto command = Command(*program).WithArgs({ "--input", "<input>", "--verbose" }).WithStdout(Stdio::Pipe());
+    auto prepared = PreparedCommand::New(command);
+    ASSERT_TRUE(prepared) << "failed to prepare command: " << prepared.Error();
+    EXPECT_EQ(prepared->Args(), 3);
+
+    // grows the argument past any small-string buffer, so it has to move between spawns
+    for (UInt i = 0; i < 8; i++) {
+        String input(i * 16, static_cast<char>('a' + i));
+        prepared->WithArg(1, input);
+        EXPECT_EQ(prepared->Arg(1), input);
+
+        auto output = prepared->Output();
+        ASSERT_TRUE(output) << "spawn #" << i << " failed: " << output.Error();
+        EXPECT_EQ(output->Status.Code(), 0);
+        EXPECT_EQ(String(output->Stdout.begin(), output->Stdout.end()),
+            std::format("4\nargv[1]=--input\nargv[2]={}\nargv[3]=--verbose\n", input));
+    }
+}
+
+TEST(PreparedCommand, IsIndependentOfTheCommandItWasPreparedFrom)
+{
+    auto command = Command("sh").WithArgs({ "-c", "exit 3" });
+    auto prepared = PreparedCommand::New(command);
+    ASSERT_TRUE(prepared) << "failed to prepare command: " << prepared.Error();
+
+    command.WithArg("ignored");
+
+    auto status = prepared->Status();
+    ASSERT_TRUE(status) << "status failed: " << status.Error();
+    EXPECT_EQ(status->Code(), 3);
+    EXPECT_EQ(prepared->Args(), 2);
+}
+
+TEST(PreparedCommand, ReusesNullStreams)
+{
+    auto command = Command("sh").WithArgs({ "-c", "echo out; echo err >&2; read line" });
+    command.WithStdin(Stdio::Null()).WithStdout(Stdio::Null()).WithStderr(Stdio::Null());
+
+    auto prepared = PreparedCommand::New(command);
+    ASSERT_TRUE(prepared) << "failed to prepare command: " << prepared.Error();
+
+    for (UInt i = 0; i < 4; i++) {
+        auto child = prepared->Spawn();
+        ASSERT_TRUE(child) << "spawn #" << i << " failed: " << child.Error();
+        EXPECT_FALSE(child->Stdout.HasValue());
+
+        auto status = child->Wait();
+        ASSERT_TRUE(status) << "wait #" << i << " failed: " << status.Error();
+
+        // `read` hits end-of-file on `/dev/null` straight away
+        EXPECT_EQ(status->Code(), 1);
+    }
+}
+
+TEST(PreparedCommand, RunsScriptsThroughTheirInterpreter)
+{
+    char path[] = "/tmp/violet-prepared-XXXXXX";
+    Int32 fd = ::mkstemp(path);
+    ASSERT_GE(fd, 0) << "mkstemp failed: " << errno;
+
+    constexpr Str kScript = "#!/bin/sh\necho \"script: $1\"\n";
+    ASSERT_EQ(::write(fd, kScript.data(), kScript.size()), static_cast<ssize_t>(kScript.size()));
+    ASSERT_EQ(::fchmod(fd, 0755), 0);
+    ::close(fd);
+
+    auto prepared = PreparedCommand::New(Command(path).WithArg("<name>").WithStdout(Stdio::Pipe()));
+    ASSERT_TRUE(prepared) << "failed to prepare command: " << prepared.Error();
+
+    auto output = prepared->WithArg(0, "violet").Output();
+    ::unlink(path);
+
+    ASSERT_TRUE(output) << "spawn failed: " << output.Error();
+    EXPECT_EQ(output->Status.Code(), 0);
+    EXPECT_EQ(String(output->Stdout.begin(), output->Stdout.end()), "script: violet\n");
+}
+
+TEST(PreparedCommand, KeepsRunningTheProgramItOpened)
+{
+    auto program = runfiles::Get("tests/subprocess/runfiles/print_args");
+    ASSERT_TRUE(program) << "runfile fetch for `tests/subprocess/runfiles/print_args` failed?!";
+
+    char path[] = "/tmp/violet-prepared-XXXXXX";
+    Int32 fd = ::mkstemp(path);
+    ASSERT_GE(fd, 0) << "mkstemp failed: " << errno;
+
+    Int32 source = ::open(program->c_str(), O_RDONLY);
+    ASSERT_GE(source, 0);
+
+    char buf[8192];
+    for (ssize_t read = 0; (read = ::read(source, buf, sizeof(buf))) > 0;) {
+        ASSERT_EQ(::write(fd, buf, static_cast<UInt>(read)), read);
+    }
+
+    ::close(source);
+    ASSERT_EQ(::fchmod(fd, 0755), 0);
+    ::close(fd);
+
+    auto prepared = PreparedCommand::New(Command(path).WithArg("still here").WithStdout(Stdio::Pipe()));
+    ASSERT_TRUE(prepared) << "failed to prepare command: " << prepared.Error();
+
+    // children run the file that was resolved when preparing, not whatever the path names now
+    ASSERT_EQ(::unlink(path), 0);
+
+    auto output = prepared->Output();
+    ASSERT_TRUE(output) << "spawn failed: " << output.Error();
+    EXPECT_EQ(output->Status.Code(), 0);
+    EXPECT_EQ(String(output->Stdout.begin(), output->Stdout.end()), "2\nargv[1]=still here\n");
+}
+
+TEST(PreparedCommand, FailsForNonExistentProgram)
+{
+    auto prepared = PreparedCommand::New(Command("violet-program-that-does-not-exist"));
+    ASSERT_FALSE(prepared) << "preparing a missing program should fail";
+    EXPECT_EQ(prepared.Error().RawOSError(), ENOENT);
+}
+
+// NOLINTEND(google-build-using-namespace)
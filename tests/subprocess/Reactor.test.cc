@@ -0,0 +1,134 @@
+// 🌺💜 Violet: Extended C++ standard library
+// Copyright (c) 2025-2026 Noelware, LLC. <team@noelware.org>, et al.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <violet/Subprocess/Reactor.h>
+#include <violet/Testing/Runfiles.h>
+
+using namespace std::chrono_literals;
+
+// NOLINTBEGIN(google-build-using-namespace)
+using namespace violet;
+using namespace violet::subprocess;
+using namespace violet::testing;
+
+TEST(Reactor, RunsManyChildrenConcurrently)
+{
+    auto program = runfiles::Get("tests/subprocess/runfiles/print_args");
+    ASSERT_TRUE(program) << "runfile fetch for `tests/subprocess/runfiles/print_args` failed?!";
+
+    auto reactor = Reactor::New();
+    ASSERT_TRUE(reactor) << "failed to create reactor: " << reactor.Error();
+
+    constexpr UInt kChildren = 64;
+    Vec<Optional<String>> outputs(kChildren);
+
+    for (UInt i = 0; i < kChildren; i++) {
+        auto command = Command(*program).WithArg(violet::ToString(i)).WithStdout(Stdio::Pipe());
+        auto pid = reactor->Spawn(command, [&outputs, i](io::Result<Output> output) -> void {
+            ASSERT_TRUE(output) << "child #" << i << " failed: " << output.Error();
+            EXPECT_EQ(output->Status.Code(), 0);
+
+            outputs[i] = String(output->Stdout.begin(), output->Stdout.end());
+        });
+
+        ASSERT_TRUE(pid) << "failed to spawn child #" << i << ": " << pid.Error();
+    }
+
+    EXPECT_EQ(reactor->Pending(), kChildren);
+
+    auto ran = reactor->Run();
+    ASSERT_TRUE(ran) << "`Run()' failed: " << ran.Error();
+    EXPECT_EQ(reactor->Pending(), 0);
+
+    for (UInt i = 0; i < kChildren; i++) {
+        ASSERT_TRUE(outputs[i]) << "callback of child #" << i << " never ran";
+        EXPECT_EQ(*outputs[i], std::format("2\nargv[1]={}\n", i));
+    }
+}
+
+TEST(Reactor, CapturesStdoutAndStderrSeparately)
+{
+    auto reactor = Reactor::New();
+    ASSERT_TRUE(reactor) << "failed to create reactor: " << reactor.Error();
+
+    Optional<io::Result<Output>> result;
+    auto command = Command("sh")
+                       .WithArgs({ "-c", "echo out; echo err >&2; exit 3" })
+                       .WithStdout(Stdio::Pipe())
+                       .WithStderr(Stdio::Pipe());
+
+    ASSERT_TRUE(reactor->Spawn(command, [&](io::Result<Output> output) -> void { result = VIOLET_MOVE(output); }));
+    ASSERT_TRUE(reactor->Run());
+
+    ASSERT_TRUE(result) << "callback never ran";
+    ASSERT_TRUE(*result) << "child failed: " << result->Error();
+    EXPECT_EQ(String((*result)->Stdout.begin(), (*result)->Stdout.end()), "out\n");
+    EXPECT_EQ(String((*result)->Stderr.begin(), (*result)->Stderr.end()), "err\n");
+    EXPECT_EQ((*result)->Status.Code(), 3);
+}
+
+TEST(Reactor, CallbacksCanWatchMoreChildren)
+{
+    auto reactor = Reactor::New();
+    ASSERT_TRUE(reactor) << "failed to create reactor: " << reactor.Error();
+
+    UInt finished = 0;
+    std::function<void(io::Result<Output>)> next = [&](io::Result<Output> output) -> void {
+        ASSERT_TRUE(output);
+        if (++finished < 5) {
+            auto command = Command("true");
+            ASSERT_TRUE(reactor->Spawn(command, next));
+        }
+    };
+
+    auto command = Command("true");
+    ASSERT_TRUE(reactor->Spawn(command, next));
+    ASSERT_TRUE(reactor->Run());
+    EXPECT_EQ(finished, 5);
+}
+
+TEST(Reactor, PollTimesOutWhileChildrenAreRunning)
+{
+    auto program = runfiles::Get("tests/subprocess/runfiles/hang");
+    ASSERT_TRUE(program) << "runfile `tests/subprocess/runfiles/hang' failed";
+
+    auto reactor = Reactor::New();
+    ASSERT_TRUE(reactor) << "failed to create reactor: " << reactor.Error();
+
+    auto child = Command(*program).Spawn();
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    auto pid = child->PID;
+    bool done = false;
+    ASSERT_TRUE(reactor->Watch(VIOLET_MOVE(child.Value()), [&](io::Result<Output>) -> void { done = true; }));
+
+    auto polled = reactor->Poll(50ms);
+    ASSERT_TRUE(polled) << "`Poll()' failed: " << polled.Error();
+    EXPECT_EQ(*polled, 0);
+    EXPECT_EQ(reactor->Pending(), 1);
+
+    ::kill(pid.Get(), SIGKILL);
+    ASSERT_TRUE(reactor->Run());
+    EXPECT_TRUE(done);
+}
+
+// NOLINTEND(google-build-using-namespace)
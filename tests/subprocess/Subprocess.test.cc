@@ -128,6 +128,32 @@ TEST(Output, StdoutEmptyForQuietCommand)
     EXPECT_TRUE(result->Stderr.empty());
 }
 
+TEST(Output, CapturesStderrSeparately)
+{
+    auto result = Command("sh").WithArgs({ "-c", "echo err >&2" }).WithStderr(Stdio::Pipe()).Output();
+    ASSERT_TRUE(result) << "output failed: " << result.Error();
+
+    String err(result->Stderr.begin(), result->Stderr.end());
+    EXPECT_EQ(err, "err\n");
+    EXPECT_TRUE(result->Stdout.empty());
+}
+
+TEST(Output, CapturesLargeStdoutAndStderrTogether)
+{
+    // Both streams are well past a pipe's capacity, so draining them one after the
+    // other would deadlock the child.
+    auto result = Command("sh")
+                      .WithArgs({ "-c", "head -c 300000 /dev/zero; head -c 200000 /dev/zero >&2; echo done" })
+                      .WithStdout(Stdio::Pipe())
+                      .WithStderr(Stdio::Pipe())
+                      .Output();
+
+    ASSERT_TRUE(result) << "output failed: " << result.Error();
+    EXPECT_EQ(result->Stdout.size(), 300005);
+    EXPECT_EQ(result->Stderr.size(), 200000);
+    EXPECT_EQ(result->Status.Code(), 0);
+}
+
 TEST(Arguments, WithArgPassedToChild)
 {
     auto program = runfiles::Get("tests/subprocess/runfiles/print_args");
@@ -388,6 +414,34 @@ TEST(Stdio, PipeIntoFileWritesOutput)
     EXPECT_EQ(str, "piped into this file\n");
 }
 
+TEST(Stdio, PipeIntoUnopenableFileFailsToSpawn)
+{
+    auto result = Command("echo").WithStdout(Stdio::Pipe("/this/directory/does/not/exist/output.txt")).Spawn();
+    ASSERT_FALSE(result) << "spawning must fail if the output file can't be created";
+    EXPECT_EQ(result.Error().RawOSError(), ENOENT);
+}
+
+TEST(Stdio, TransferStdoutIntoFile)
+{
+    auto file = TempBuilder{ }.MkFile();
+    ASSERT_TRUE(file) << "failed to build temporary file: " << file.Error();
+
+    auto child = Command("head").WithArgs({ "-c", "1048576", "/dev/zero" }).WithStdout(Stdio::Pipe()).Spawn();
+    ASSERT_TRUE(child) << "spawn failed: " << child.Error();
+
+    auto moved = child->TransferStdout(file->File().Descriptor());
+    ASSERT_TRUE(moved) << "transfer failed: " << moved.Error();
+    EXPECT_EQ(*moved, 1048576U);
+
+    auto status = child->Wait();
+    ASSERT_TRUE(status);
+    EXPECT_EQ(status->Code(), 0);
+
+    EXPECT_EQ(::lseek(file->File().Descriptor(), 0, SEEK_CUR), 1048576) << "the file offset must have moved";
+
+    EXPECT_FALSE(child->TransferStderr(file->File().Descriptor())) << "stderr was never piped";
+}
+
 TEST(SubprocessTimeout, DeathTimeoutKillsProcess)
 {
     auto program = runfiles::Get("tests/subprocess/runfiles/hang");
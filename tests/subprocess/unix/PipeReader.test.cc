@@ -129,4 +129,35 @@ TEST(PipeReader, CapturesNoOutputFromPrintEnv)
     EXPECT_TRUE(result->empty()) << "expected no stdout output from `print_env' runfile";
 }
 
+TEST(PipeReader, DrainsSeveralPipesIntoTheirOwnSinks)
+{
+    auto program = runfiles::Get("tests/subprocess/runfiles/print_args");
+    ASSERT_TRUE(program) << "runfile fetch for `tests/subprocess/runfiles/print_args` failed?!";
+
+    auto [first, firstFD] = SpawnWithPipe(*program, { "hello" });
+    auto [second, secondFD] = SpawnWithPipe(*program, { "world", "!" });
+    ASSERT_GE(firstFD, 0);
+    ASSERT_GE(secondFD, 0);
+
+    auto reader = GetPipeReader();
+    ASSERT_TRUE(reader) << "unable to find a proper pipe reader";
+
+    Vec<UInt8> firstSink;
+    Vec<UInt8> secondSink;
+    ASSERT_TRUE(reader->Register(firstFD, firstSink));
+    ASSERT_TRUE(reader->Register(secondFD, secondSink));
+
+    auto result = reader->Drain();
+
+    Int32 status = 0;
+    ::waitpid(first.Get(), &status, 0);
+    ::waitpid(second.Get(), &status, 0);
+    ::close(firstFD);
+    ::close(secondFD);
+
+    ASSERT_TRUE(result) << "`Drain()' failed: " << result.Error();
+    EXPECT_EQ(String(firstSink.begin(), firstSink.end()), "2\nargv[1]=hello\n");
+    EXPECT_EQ(String(secondSink.begin(), secondSink.end()), "3\nargv[1]=world\nargv[2]=!\n");
+}
+
 // NOLINTEND(google-build-using-namespace,cppcoreguidelines-pro-type-const-cast)
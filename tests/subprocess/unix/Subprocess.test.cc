@@ -25,6 +25,10 @@
 #include <violet/Testing/Runfiles.h>
 
 #include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 // NOLINTBEGIN(google-build-using-namespace)
@@ -138,4 +142,81 @@ TEST(ChildKill, InvalidPIDReturnsError)
     EXPECT_FALSE(result) << "Kill() on an invalid PID should return an error";
 }
 
+TEST(Spawn, ResolvesProgramAgainstCommandPath)
+{
+    auto program = runfiles::Get("tests/subprocess/runfiles/print_env");
+    ASSERT_TRUE(program) << "runfile fetch for `tests/subprocess/runfiles/print_env` failed";
+
+    // The executable is looked up in the parent before spawning, against the `PATH`
+    // the child will see rather than the parent's own.
+    auto directory = program->substr(0, program->rfind('/'));
+    auto result = Command("print_env").WithEnv("PATH", directory).WithArg("PATH").Status();
+
+    ASSERT_TRUE(result) << "status failed: " << result.Error();
+    EXPECT_EQ(result->Code(), 0);
+}
+
+TEST(Spawn, UnknownProgramReportsNotFound)
+{
+    auto child = Command("violet-program-that-does-not-exist").Spawn();
+    ASSERT_FALSE(child) << "spawning a missing program should fail";
+
+    auto code = child.Error().RawOSError();
+    ASSERT_TRUE(code);
+    EXPECT_EQ(*code, ENOENT);
+}
+
+TEST(Spawn, RunsFilesWithoutAnInterpreterThroughTheShell)
+{
+    char path[] = "/tmp/violet-spawn-XXXXXX";
+    Int32 fd = ::mkstemp(path);
+    ASSERT_GE(fd, 0) << "mkstemp failed: " << errno;
+
+    // no `#!` line, so `execve` fails with `ENOEXEC` and `/bin/sh` has to run it
+    constexpr Str kScript = "echo \"script: $1\"\n";
+    ASSERT_EQ(::write(fd, kScript.data(), kScript.size()), static_cast<ssize_t>(kScript.size()));
+    ASSERT_EQ(::fchmod(fd, 0755), 0);
+    ::close(fd);
+
+    auto output = Command(path).WithArg("violet").WithStdout(Stdio::Pipe()).Output();
+    ::unlink(path);
+
+    ASSERT_TRUE(output) << "spawn failed: " << output.Error();
+    EXPECT_EQ(output->Status.Code(), 0);
+    EXPECT_EQ(String(output->Stdout.begin(), output->Stdout.end()), "script: violet\n");
+}
+
+TEST(Spawn, ResolvesRelativePathEntriesAgainstTheWorkingDirectory)
+{
+    char directory[] = "/tmp/violet-spawn-XXXXXX";
+    ASSERT_NE(::mkdtemp(directory), nullptr) << "mkdtemp failed: " << errno;
+
+    auto path = std::format("{}/violet-relative", directory);
+    Int32 fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0755);
+    ASSERT_GE(fd, 0) << "open failed: " << errno;
+
+    constexpr Str kScript = "#!/bin/sh\nexit 7\n";
+    ASSERT_EQ(::write(fd, kScript.data(), kScript.size()), static_cast<ssize_t>(kScript.size()));
+    ::close(fd);
+
+    // `.` is where the child will be, not where we are
+    auto result = Command("violet-relative").WithEnv("PATH", ".").WithWorkingDirectory(Str(directory)).Status();
+    ::unlink(path.c_str());
+    ::rmdir(directory);
+
+    ASSERT_TRUE(result) << "status failed: " << result.Error();
+    EXPECT_EQ(result->Code(), 7);
+}
+
+TEST(Spawn, ChildDoesNotInheritBlockedSignals)
+{
+    // The parent blocks every signal around the spawn; the child must get the
+    // original mask back before `execve` or it would ignore the `SIGTERM` below.
+    auto result = Command("sh").WithArgs({ "-c", "kill -TERM $$; exit 0" }).Status();
+
+    ASSERT_TRUE(result) << "status failed: " << result.Error();
+    EXPECT_TRUE(result->Signaled());
+    EXPECT_EQ(result->Signal(), SIGTERM);
+}
+
 // NOLINTEND(google-build-using-namespace)